@@ -0,0 +1,12 @@
+// Generated by nob.c, do not edit
+#if GRID_SIZE == 10
+    #include "grid_tables_10.h"
+#elif GRID_SIZE == 16
+    #include "grid_tables_16.h"
+#elif GRID_SIZE == 32
+    #include "grid_tables_32.h"
+#elif GRID_SIZE == 64
+    #include "grid_tables_64.h"
+#else
+    #error "No lookup tables for this GRID_SIZE, add it to grid_sizes in nob.c"
+#endif
@@ -0,0 +1,423 @@
+// Generated by nob.c, do not edit. Lookup tables for GRID_SIZE 10, see src/grid.h.
+#define GRID_CELLS 1000
+
+// Index of a cell, (z*GRID_SIZE + y)*GRID_SIZE + x
+typedef uint16_t Grid_Cell;
+
+static const unsigned char grid_coords[GRID_CELLS][3] = {
+    {0,0,0}, {1,0,0}, {2,0,0}, {3,0,0}, {4,0,0}, {5,0,0}, {6,0,0}, {7,0,0},
+    {8,0,0}, {9,0,0}, {0,1,0}, {1,1,0}, {2,1,0}, {3,1,0}, {4,1,0}, {5,1,0},
+    {6,1,0}, {7,1,0}, {8,1,0}, {9,1,0}, {0,2,0}, {1,2,0}, {2,2,0}, {3,2,0},
+    {4,2,0}, {5,2,0}, {6,2,0}, {7,2,0}, {8,2,0}, {9,2,0}, {0,3,0}, {1,3,0},
+    {2,3,0}, {3,3,0}, {4,3,0}, {5,3,0}, {6,3,0}, {7,3,0}, {8,3,0}, {9,3,0},
+    {0,4,0}, {1,4,0}, {2,4,0}, {3,4,0}, {4,4,0}, {5,4,0}, {6,4,0}, {7,4,0},
+    {8,4,0}, {9,4,0}, {0,5,0}, {1,5,0}, {2,5,0}, {3,5,0}, {4,5,0}, {5,5,0},
+    {6,5,0}, {7,5,0}, {8,5,0}, {9,5,0}, {0,6,0}, {1,6,0}, {2,6,0}, {3,6,0},
+    {4,6,0}, {5,6,0}, {6,6,0}, {7,6,0}, {8,6,0}, {9,6,0}, {0,7,0}, {1,7,0},
+    {2,7,0}, {3,7,0}, {4,7,0}, {5,7,0}, {6,7,0}, {7,7,0}, {8,7,0}, {9,7,0},
+    {0,8,0}, {1,8,0}, {2,8,0}, {3,8,0}, {4,8,0}, {5,8,0}, {6,8,0}, {7,8,0},
+    {8,8,0}, {9,8,0}, {0,9,0}, {1,9,0}, {2,9,0}, {3,9,0}, {4,9,0}, {5,9,0},
+    {6,9,0}, {7,9,0}, {8,9,0}, {9,9,0}, {0,0,1}, {1,0,1}, {2,0,1}, {3,0,1},
+    {4,0,1}, {5,0,1}, {6,0,1}, {7,0,1}, {8,0,1}, {9,0,1}, {0,1,1}, {1,1,1},
+    {2,1,1}, {3,1,1}, {4,1,1}, {5,1,1}, {6,1,1}, {7,1,1}, {8,1,1}, {9,1,1},
+    {0,2,1}, {1,2,1}, {2,2,1}, {3,2,1}, {4,2,1}, {5,2,1}, {6,2,1}, {7,2,1},
+    {8,2,1}, {9,2,1}, {0,3,1}, {1,3,1}, {2,3,1}, {3,3,1}, {4,3,1}, {5,3,1},
+    {6,3,1}, {7,3,1}, {8,3,1}, {9,3,1}, {0,4,1}, {1,4,1}, {2,4,1}, {3,4,1},
+    {4,4,1}, {5,4,1}, {6,4,1}, {7,4,1}, {8,4,1}, {9,4,1}, {0,5,1}, {1,5,1},
+    {2,5,1}, {3,5,1}, {4,5,1}, {5,5,1}, {6,5,1}, {7,5,1}, {8,5,1}, {9,5,1},
+    {0,6,1}, {1,6,1}, {2,6,1}, {3,6,1}, {4,6,1}, {5,6,1}, {6,6,1}, {7,6,1},
+    {8,6,1}, {9,6,1}, {0,7,1}, {1,7,1}, {2,7,1}, {3,7,1}, {4,7,1}, {5,7,1},
+    {6,7,1}, {7,7,1}, {8,7,1}, {9,7,1}, {0,8,1}, {1,8,1}, {2,8,1}, {3,8,1},
+    {4,8,1}, {5,8,1}, {6,8,1}, {7,8,1}, {8,8,1}, {9,8,1}, {0,9,1}, {1,9,1},
+    {2,9,1}, {3,9,1}, {4,9,1}, {5,9,1}, {6,9,1}, {7,9,1}, {8,9,1}, {9,9,1},
+    {0,0,2}, {1,0,2}, {2,0,2}, {3,0,2}, {4,0,2}, {5,0,2}, {6,0,2}, {7,0,2},
+    {8,0,2}, {9,0,2}, {0,1,2}, {1,1,2}, {2,1,2}, {3,1,2}, {4,1,2}, {5,1,2},
+    {6,1,2}, {7,1,2}, {8,1,2}, {9,1,2}, {0,2,2}, {1,2,2}, {2,2,2}, {3,2,2},
+    {4,2,2}, {5,2,2}, {6,2,2}, {7,2,2}, {8,2,2}, {9,2,2}, {0,3,2}, {1,3,2},
+    {2,3,2}, {3,3,2}, {4,3,2}, {5,3,2}, {6,3,2}, {7,3,2}, {8,3,2}, {9,3,2},
+    {0,4,2}, {1,4,2}, {2,4,2}, {3,4,2}, {4,4,2}, {5,4,2}, {6,4,2}, {7,4,2},
+    {8,4,2}, {9,4,2}, {0,5,2}, {1,5,2}, {2,5,2}, {3,5,2}, {4,5,2}, {5,5,2},
+    {6,5,2}, {7,5,2}, {8,5,2}, {9,5,2}, {0,6,2}, {1,6,2}, {2,6,2}, {3,6,2},
+    {4,6,2}, {5,6,2}, {6,6,2}, {7,6,2}, {8,6,2}, {9,6,2}, {0,7,2}, {1,7,2},
+    {2,7,2}, {3,7,2}, {4,7,2}, {5,7,2}, {6,7,2}, {7,7,2}, {8,7,2}, {9,7,2},
+    {0,8,2}, {1,8,2}, {2,8,2}, {3,8,2}, {4,8,2}, {5,8,2}, {6,8,2}, {7,8,2},
+    {8,8,2}, {9,8,2}, {0,9,2}, {1,9,2}, {2,9,2}, {3,9,2}, {4,9,2}, {5,9,2},
+    {6,9,2}, {7,9,2}, {8,9,2}, {9,9,2}, {0,0,3}, {1,0,3}, {2,0,3}, {3,0,3},
+    {4,0,3}, {5,0,3}, {6,0,3}, {7,0,3}, {8,0,3}, {9,0,3}, {0,1,3}, {1,1,3},
+    {2,1,3}, {3,1,3}, {4,1,3}, {5,1,3}, {6,1,3}, {7,1,3}, {8,1,3}, {9,1,3},
+    {0,2,3}, {1,2,3}, {2,2,3}, {3,2,3}, {4,2,3}, {5,2,3}, {6,2,3}, {7,2,3},
+    {8,2,3}, {9,2,3}, {0,3,3}, {1,3,3}, {2,3,3}, {3,3,3}, {4,3,3}, {5,3,3},
+    {6,3,3}, {7,3,3}, {8,3,3}, {9,3,3}, {0,4,3}, {1,4,3}, {2,4,3}, {3,4,3},
+    {4,4,3}, {5,4,3}, {6,4,3}, {7,4,3}, {8,4,3}, {9,4,3}, {0,5,3}, {1,5,3},
+    {2,5,3}, {3,5,3}, {4,5,3}, {5,5,3}, {6,5,3}, {7,5,3}, {8,5,3}, {9,5,3},
+    {0,6,3}, {1,6,3}, {2,6,3}, {3,6,3}, {4,6,3}, {5,6,3}, {6,6,3}, {7,6,3},
+    {8,6,3}, {9,6,3}, {0,7,3}, {1,7,3}, {2,7,3}, {3,7,3}, {4,7,3}, {5,7,3},
+    {6,7,3}, {7,7,3}, {8,7,3}, {9,7,3}, {0,8,3}, {1,8,3}, {2,8,3}, {3,8,3},
+    {4,8,3}, {5,8,3}, {6,8,3}, {7,8,3}, {8,8,3}, {9,8,3}, {0,9,3}, {1,9,3},
+    {2,9,3}, {3,9,3}, {4,9,3}, {5,9,3}, {6,9,3}, {7,9,3}, {8,9,3}, {9,9,3},
+    {0,0,4}, {1,0,4}, {2,0,4}, {3,0,4}, {4,0,4}, {5,0,4}, {6,0,4}, {7,0,4},
+    {8,0,4}, {9,0,4}, {0,1,4}, {1,1,4}, {2,1,4}, {3,1,4}, {4,1,4}, {5,1,4},
+    {6,1,4}, {7,1,4}, {8,1,4}, {9,1,4}, {0,2,4}, {1,2,4}, {2,2,4}, {3,2,4},
+    {4,2,4}, {5,2,4}, {6,2,4}, {7,2,4}, {8,2,4}, {9,2,4}, {0,3,4}, {1,3,4},
+    {2,3,4}, {3,3,4}, {4,3,4}, {5,3,4}, {6,3,4}, {7,3,4}, {8,3,4}, {9,3,4},
+    {0,4,4}, {1,4,4}, {2,4,4}, {3,4,4}, {4,4,4}, {5,4,4}, {6,4,4}, {7,4,4},
+    {8,4,4}, {9,4,4}, {0,5,4}, {1,5,4}, {2,5,4}, {3,5,4}, {4,5,4}, {5,5,4},
+    {6,5,4}, {7,5,4}, {8,5,4}, {9,5,4}, {0,6,4}, {1,6,4}, {2,6,4}, {3,6,4},
+    {4,6,4}, {5,6,4}, {6,6,4}, {7,6,4}, {8,6,4}, {9,6,4}, {0,7,4}, {1,7,4},
+    {2,7,4}, {3,7,4}, {4,7,4}, {5,7,4}, {6,7,4}, {7,7,4}, {8,7,4}, {9,7,4},
+    {0,8,4}, {1,8,4}, {2,8,4}, {3,8,4}, {4,8,4}, {5,8,4}, {6,8,4}, {7,8,4},
+    {8,8,4}, {9,8,4}, {0,9,4}, {1,9,4}, {2,9,4}, {3,9,4}, {4,9,4}, {5,9,4},
+    {6,9,4}, {7,9,4}, {8,9,4}, {9,9,4}, {0,0,5}, {1,0,5}, {2,0,5}, {3,0,5},
+    {4,0,5}, {5,0,5}, {6,0,5}, {7,0,5}, {8,0,5}, {9,0,5}, {0,1,5}, {1,1,5},
+    {2,1,5}, {3,1,5}, {4,1,5}, {5,1,5}, {6,1,5}, {7,1,5}, {8,1,5}, {9,1,5},
+    {0,2,5}, {1,2,5}, {2,2,5}, {3,2,5}, {4,2,5}, {5,2,5}, {6,2,5}, {7,2,5},
+    {8,2,5}, {9,2,5}, {0,3,5}, {1,3,5}, {2,3,5}, {3,3,5}, {4,3,5}, {5,3,5},
+    {6,3,5}, {7,3,5}, {8,3,5}, {9,3,5}, {0,4,5}, {1,4,5}, {2,4,5}, {3,4,5},
+    {4,4,5}, {5,4,5}, {6,4,5}, {7,4,5}, {8,4,5}, {9,4,5}, {0,5,5}, {1,5,5},
+    {2,5,5}, {3,5,5}, {4,5,5}, {5,5,5}, {6,5,5}, {7,5,5}, {8,5,5}, {9,5,5},
+    {0,6,5}, {1,6,5}, {2,6,5}, {3,6,5}, {4,6,5}, {5,6,5}, {6,6,5}, {7,6,5},
+    {8,6,5}, {9,6,5}, {0,7,5}, {1,7,5}, {2,7,5}, {3,7,5}, {4,7,5}, {5,7,5},
+    {6,7,5}, {7,7,5}, {8,7,5}, {9,7,5}, {0,8,5}, {1,8,5}, {2,8,5}, {3,8,5},
+    {4,8,5}, {5,8,5}, {6,8,5}, {7,8,5}, {8,8,5}, {9,8,5}, {0,9,5}, {1,9,5},
+    {2,9,5}, {3,9,5}, {4,9,5}, {5,9,5}, {6,9,5}, {7,9,5}, {8,9,5}, {9,9,5},
+    {0,0,6}, {1,0,6}, {2,0,6}, {3,0,6}, {4,0,6}, {5,0,6}, {6,0,6}, {7,0,6},
+    {8,0,6}, {9,0,6}, {0,1,6}, {1,1,6}, {2,1,6}, {3,1,6}, {4,1,6}, {5,1,6},
+    {6,1,6}, {7,1,6}, {8,1,6}, {9,1,6}, {0,2,6}, {1,2,6}, {2,2,6}, {3,2,6},
+    {4,2,6}, {5,2,6}, {6,2,6}, {7,2,6}, {8,2,6}, {9,2,6}, {0,3,6}, {1,3,6},
+    {2,3,6}, {3,3,6}, {4,3,6}, {5,3,6}, {6,3,6}, {7,3,6}, {8,3,6}, {9,3,6},
+    {0,4,6}, {1,4,6}, {2,4,6}, {3,4,6}, {4,4,6}, {5,4,6}, {6,4,6}, {7,4,6},
+    {8,4,6}, {9,4,6}, {0,5,6}, {1,5,6}, {2,5,6}, {3,5,6}, {4,5,6}, {5,5,6},
+    {6,5,6}, {7,5,6}, {8,5,6}, {9,5,6}, {0,6,6}, {1,6,6}, {2,6,6}, {3,6,6},
+    {4,6,6}, {5,6,6}, {6,6,6}, {7,6,6}, {8,6,6}, {9,6,6}, {0,7,6}, {1,7,6},
+    {2,7,6}, {3,7,6}, {4,7,6}, {5,7,6}, {6,7,6}, {7,7,6}, {8,7,6}, {9,7,6},
+    {0,8,6}, {1,8,6}, {2,8,6}, {3,8,6}, {4,8,6}, {5,8,6}, {6,8,6}, {7,8,6},
+    {8,8,6}, {9,8,6}, {0,9,6}, {1,9,6}, {2,9,6}, {3,9,6}, {4,9,6}, {5,9,6},
+    {6,9,6}, {7,9,6}, {8,9,6}, {9,9,6}, {0,0,7}, {1,0,7}, {2,0,7}, {3,0,7},
+    {4,0,7}, {5,0,7}, {6,0,7}, {7,0,7}, {8,0,7}, {9,0,7}, {0,1,7}, {1,1,7},
+    {2,1,7}, {3,1,7}, {4,1,7}, {5,1,7}, {6,1,7}, {7,1,7}, {8,1,7}, {9,1,7},
+    {0,2,7}, {1,2,7}, {2,2,7}, {3,2,7}, {4,2,7}, {5,2,7}, {6,2,7}, {7,2,7},
+    {8,2,7}, {9,2,7}, {0,3,7}, {1,3,7}, {2,3,7}, {3,3,7}, {4,3,7}, {5,3,7},
+    {6,3,7}, {7,3,7}, {8,3,7}, {9,3,7}, {0,4,7}, {1,4,7}, {2,4,7}, {3,4,7},
+    {4,4,7}, {5,4,7}, {6,4,7}, {7,4,7}, {8,4,7}, {9,4,7}, {0,5,7}, {1,5,7},
+    {2,5,7}, {3,5,7}, {4,5,7}, {5,5,7}, {6,5,7}, {7,5,7}, {8,5,7}, {9,5,7},
+    {0,6,7}, {1,6,7}, {2,6,7}, {3,6,7}, {4,6,7}, {5,6,7}, {6,6,7}, {7,6,7},
+    {8,6,7}, {9,6,7}, {0,7,7}, {1,7,7}, {2,7,7}, {3,7,7}, {4,7,7}, {5,7,7},
+    {6,7,7}, {7,7,7}, {8,7,7}, {9,7,7}, {0,8,7}, {1,8,7}, {2,8,7}, {3,8,7},
+    {4,8,7}, {5,8,7}, {6,8,7}, {7,8,7}, {8,8,7}, {9,8,7}, {0,9,7}, {1,9,7},
+    {2,9,7}, {3,9,7}, {4,9,7}, {5,9,7}, {6,9,7}, {7,9,7}, {8,9,7}, {9,9,7},
+    {0,0,8}, {1,0,8}, {2,0,8}, {3,0,8}, {4,0,8}, {5,0,8}, {6,0,8}, {7,0,8},
+    {8,0,8}, {9,0,8}, {0,1,8}, {1,1,8}, {2,1,8}, {3,1,8}, {4,1,8}, {5,1,8},
+    {6,1,8}, {7,1,8}, {8,1,8}, {9,1,8}, {0,2,8}, {1,2,8}, {2,2,8}, {3,2,8},
+    {4,2,8}, {5,2,8}, {6,2,8}, {7,2,8}, {8,2,8}, {9,2,8}, {0,3,8}, {1,3,8},
+    {2,3,8}, {3,3,8}, {4,3,8}, {5,3,8}, {6,3,8}, {7,3,8}, {8,3,8}, {9,3,8},
+    {0,4,8}, {1,4,8}, {2,4,8}, {3,4,8}, {4,4,8}, {5,4,8}, {6,4,8}, {7,4,8},
+    {8,4,8}, {9,4,8}, {0,5,8}, {1,5,8}, {2,5,8}, {3,5,8}, {4,5,8}, {5,5,8},
+    {6,5,8}, {7,5,8}, {8,5,8}, {9,5,8}, {0,6,8}, {1,6,8}, {2,6,8}, {3,6,8},
+    {4,6,8}, {5,6,8}, {6,6,8}, {7,6,8}, {8,6,8}, {9,6,8}, {0,7,8}, {1,7,8},
+    {2,7,8}, {3,7,8}, {4,7,8}, {5,7,8}, {6,7,8}, {7,7,8}, {8,7,8}, {9,7,8},
+    {0,8,8}, {1,8,8}, {2,8,8}, {3,8,8}, {4,8,8}, {5,8,8}, {6,8,8}, {7,8,8},
+    {8,8,8}, {9,8,8}, {0,9,8}, {1,9,8}, {2,9,8}, {3,9,8}, {4,9,8}, {5,9,8},
+    {6,9,8}, {7,9,8}, {8,9,8}, {9,9,8}, {0,0,9}, {1,0,9}, {2,0,9}, {3,0,9},
+    {4,0,9}, {5,0,9}, {6,0,9}, {7,0,9}, {8,0,9}, {9,0,9}, {0,1,9}, {1,1,9},
+    {2,1,9}, {3,1,9}, {4,1,9}, {5,1,9}, {6,1,9}, {7,1,9}, {8,1,9}, {9,1,9},
+    {0,2,9}, {1,2,9}, {2,2,9}, {3,2,9}, {4,2,9}, {5,2,9}, {6,2,9}, {7,2,9},
+    {8,2,9}, {9,2,9}, {0,3,9}, {1,3,9}, {2,3,9}, {3,3,9}, {4,3,9}, {5,3,9},
+    {6,3,9}, {7,3,9}, {8,3,9}, {9,3,9}, {0,4,9}, {1,4,9}, {2,4,9}, {3,4,9},
+    {4,4,9}, {5,4,9}, {6,4,9}, {7,4,9}, {8,4,9}, {9,4,9}, {0,5,9}, {1,5,9},
+    {2,5,9}, {3,5,9}, {4,5,9}, {5,5,9}, {6,5,9}, {7,5,9}, {8,5,9}, {9,5,9},
+    {0,6,9}, {1,6,9}, {2,6,9}, {3,6,9}, {4,6,9}, {5,6,9}, {6,6,9}, {7,6,9},
+    {8,6,9}, {9,6,9}, {0,7,9}, {1,7,9}, {2,7,9}, {3,7,9}, {4,7,9}, {5,7,9},
+    {6,7,9}, {7,7,9}, {8,7,9}, {9,7,9}, {0,8,9}, {1,8,9}, {2,8,9}, {3,8,9},
+    {4,8,9}, {5,8,9}, {6,8,9}, {7,8,9}, {8,8,9}, {9,8,9}, {0,9,9}, {1,9,9},
+    {2,9,9}, {3,9,9}, {4,9,9}, {5,9,9}, {6,9,9}, {7,9,9}, {8,9,9}, {9,9,9},
+};
+
+static const Grid_Cell grid_neighbors[GRID_CELLS][6] = {
+    {1,9,10,90,100,900}, {2,0,11,91,101,901}, {3,1,12,92,102,902}, {4,2,13,93,103,903},
+    {5,3,14,94,104,904}, {6,4,15,95,105,905}, {7,5,16,96,106,906}, {8,6,17,97,107,907},
+    {9,7,18,98,108,908}, {0,8,19,99,109,909}, {11,19,20,0,110,910}, {12,10,21,1,111,911},
+    {13,11,22,2,112,912}, {14,12,23,3,113,913}, {15,13,24,4,114,914}, {16,14,25,5,115,915},
+    {17,15,26,6,116,916}, {18,16,27,7,117,917}, {19,17,28,8,118,918}, {10,18,29,9,119,919},
+    {21,29,30,10,120,920}, {22,20,31,11,121,921}, {23,21,32,12,122,922}, {24,22,33,13,123,923},
+    {25,23,34,14,124,924}, {26,24,35,15,125,925}, {27,25,36,16,126,926}, {28,26,37,17,127,927},
+    {29,27,38,18,128,928}, {20,28,39,19,129,929}, {31,39,40,20,130,930}, {32,30,41,21,131,931},
+    {33,31,42,22,132,932}, {34,32,43,23,133,933}, {35,33,44,24,134,934}, {36,34,45,25,135,935},
+    {37,35,46,26,136,936}, {38,36,47,27,137,937}, {39,37,48,28,138,938}, {30,38,49,29,139,939},
+    {41,49,50,30,140,940}, {42,40,51,31,141,941}, {43,41,52,32,142,942}, {44,42,53,33,143,943},
+    {45,43,54,34,144,944}, {46,44,55,35,145,945}, {47,45,56,36,146,946}, {48,46,57,37,147,947},
+    {49,47,58,38,148,948}, {40,48,59,39,149,949}, {51,59,60,40,150,950}, {52,50,61,41,151,951},
+    {53,51,62,42,152,952}, {54,52,63,43,153,953}, {55,53,64,44,154,954}, {56,54,65,45,155,955},
+    {57,55,66,46,156,956}, {58,56,67,47,157,957}, {59,57,68,48,158,958}, {50,58,69,49,159,959},
+    {61,69,70,50,160,960}, {62,60,71,51,161,961}, {63,61,72,52,162,962}, {64,62,73,53,163,963},
+    {65,63,74,54,164,964}, {66,64,75,55,165,965}, {67,65,76,56,166,966}, {68,66,77,57,167,967},
+    {69,67,78,58,168,968}, {60,68,79,59,169,969}, {71,79,80,60,170,970}, {72,70,81,61,171,971},
+    {73,71,82,62,172,972}, {74,72,83,63,173,973}, {75,73,84,64,174,974}, {76,74,85,65,175,975},
+    {77,75,86,66,176,976}, {78,76,87,67,177,977}, {79,77,88,68,178,978}, {70,78,89,69,179,979},
+    {81,89,90,70,180,980}, {82,80,91,71,181,981}, {83,81,92,72,182,982}, {84,82,93,73,183,983},
+    {85,83,94,74,184,984}, {86,84,95,75,185,985}, {87,85,96,76,186,986}, {88,86,97,77,187,987},
+    {89,87,98,78,188,988}, {80,88,99,79,189,989}, {91,99,0,80,190,990}, {92,90,1,81,191,991},
+    {93,91,2,82,192,992}, {94,92,3,83,193,993}, {95,93,4,84,194,994}, {96,94,5,85,195,995},
+    {97,95,6,86,196,996}, {98,96,7,87,197,997}, {99,97,8,88,198,998}, {90,98,9,89,199,999},
+    {101,109,110,190,200,0}, {102,100,111,191,201,1}, {103,101,112,192,202,2}, {104,102,113,193,203,3},
+    {105,103,114,194,204,4}, {106,104,115,195,205,5}, {107,105,116,196,206,6}, {108,106,117,197,207,7},
+    {109,107,118,198,208,8}, {100,108,119,199,209,9}, {111,119,120,100,210,10}, {112,110,121,101,211,11},
+    {113,111,122,102,212,12}, {114,112,123,103,213,13}, {115,113,124,104,214,14}, {116,114,125,105,215,15},
+    {117,115,126,106,216,16}, {118,116,127,107,217,17}, {119,117,128,108,218,18}, {110,118,129,109,219,19},
+    {121,129,130,110,220,20}, {122,120,131,111,221,21}, {123,121,132,112,222,22}, {124,122,133,113,223,23},
+    {125,123,134,114,224,24}, {126,124,135,115,225,25}, {127,125,136,116,226,26}, {128,126,137,117,227,27},
+    {129,127,138,118,228,28}, {120,128,139,119,229,29}, {131,139,140,120,230,30}, {132,130,141,121,231,31},
+    {133,131,142,122,232,32}, {134,132,143,123,233,33}, {135,133,144,124,234,34}, {136,134,145,125,235,35},
+    {137,135,146,126,236,36}, {138,136,147,127,237,37}, {139,137,148,128,238,38}, {130,138,149,129,239,39},
+    {141,149,150,130,240,40}, {142,140,151,131,241,41}, {143,141,152,132,242,42}, {144,142,153,133,243,43},
+    {145,143,154,134,244,44}, {146,144,155,135,245,45}, {147,145,156,136,246,46}, {148,146,157,137,247,47},
+    {149,147,158,138,248,48}, {140,148,159,139,249,49}, {151,159,160,140,250,50}, {152,150,161,141,251,51},
+    {153,151,162,142,252,52}, {154,152,163,143,253,53}, {155,153,164,144,254,54}, {156,154,165,145,255,55},
+    {157,155,166,146,256,56}, {158,156,167,147,257,57}, {159,157,168,148,258,58}, {150,158,169,149,259,59},
+    {161,169,170,150,260,60}, {162,160,171,151,261,61}, {163,161,172,152,262,62}, {164,162,173,153,263,63},
+    {165,163,174,154,264,64}, {166,164,175,155,265,65}, {167,165,176,156,266,66}, {168,166,177,157,267,67},
+    {169,167,178,158,268,68}, {160,168,179,159,269,69}, {171,179,180,160,270,70}, {172,170,181,161,271,71},
+    {173,171,182,162,272,72}, {174,172,183,163,273,73}, {175,173,184,164,274,74}, {176,174,185,165,275,75},
+    {177,175,186,166,276,76}, {178,176,187,167,277,77}, {179,177,188,168,278,78}, {170,178,189,169,279,79},
+    {181,189,190,170,280,80}, {182,180,191,171,281,81}, {183,181,192,172,282,82}, {184,182,193,173,283,83},
+    {185,183,194,174,284,84}, {186,184,195,175,285,85}, {187,185,196,176,286,86}, {188,186,197,177,287,87},
+    {189,187,198,178,288,88}, {180,188,199,179,289,89}, {191,199,100,180,290,90}, {192,190,101,181,291,91},
+    {193,191,102,182,292,92}, {194,192,103,183,293,93}, {195,193,104,184,294,94}, {196,194,105,185,295,95},
+    {197,195,106,186,296,96}, {198,196,107,187,297,97}, {199,197,108,188,298,98}, {190,198,109,189,299,99},
+    {201,209,210,290,300,100}, {202,200,211,291,301,101}, {203,201,212,292,302,102}, {204,202,213,293,303,103},
+    {205,203,214,294,304,104}, {206,204,215,295,305,105}, {207,205,216,296,306,106}, {208,206,217,297,307,107},
+    {209,207,218,298,308,108}, {200,208,219,299,309,109}, {211,219,220,200,310,110}, {212,210,221,201,311,111},
+    {213,211,222,202,312,112}, {214,212,223,203,313,113}, {215,213,224,204,314,114}, {216,214,225,205,315,115},
+    {217,215,226,206,316,116}, {218,216,227,207,317,117}, {219,217,228,208,318,118}, {210,218,229,209,319,119},
+    {221,229,230,210,320,120}, {222,220,231,211,321,121}, {223,221,232,212,322,122}, {224,222,233,213,323,123},
+    {225,223,234,214,324,124}, {226,224,235,215,325,125}, {227,225,236,216,326,126}, {228,226,237,217,327,127},
+    {229,227,238,218,328,128}, {220,228,239,219,329,129}, {231,239,240,220,330,130}, {232,230,241,221,331,131},
+    {233,231,242,222,332,132}, {234,232,243,223,333,133}, {235,233,244,224,334,134}, {236,234,245,225,335,135},
+    {237,235,246,226,336,136}, {238,236,247,227,337,137}, {239,237,248,228,338,138}, {230,238,249,229,339,139},
+    {241,249,250,230,340,140}, {242,240,251,231,341,141}, {243,241,252,232,342,142}, {244,242,253,233,343,143},
+    {245,243,254,234,344,144}, {246,244,255,235,345,145}, {247,245,256,236,346,146}, {248,246,257,237,347,147},
+    {249,247,258,238,348,148}, {240,248,259,239,349,149}, {251,259,260,240,350,150}, {252,250,261,241,351,151},
+    {253,251,262,242,352,152}, {254,252,263,243,353,153}, {255,253,264,244,354,154}, {256,254,265,245,355,155},
+    {257,255,266,246,356,156}, {258,256,267,247,357,157}, {259,257,268,248,358,158}, {250,258,269,249,359,159},
+    {261,269,270,250,360,160}, {262,260,271,251,361,161}, {263,261,272,252,362,162}, {264,262,273,253,363,163},
+    {265,263,274,254,364,164}, {266,264,275,255,365,165}, {267,265,276,256,366,166}, {268,266,277,257,367,167},
+    {269,267,278,258,368,168}, {260,268,279,259,369,169}, {271,279,280,260,370,170}, {272,270,281,261,371,171},
+    {273,271,282,262,372,172}, {274,272,283,263,373,173}, {275,273,284,264,374,174}, {276,274,285,265,375,175},
+    {277,275,286,266,376,176}, {278,276,287,267,377,177}, {279,277,288,268,378,178}, {270,278,289,269,379,179},
+    {281,289,290,270,380,180}, {282,280,291,271,381,181}, {283,281,292,272,382,182}, {284,282,293,273,383,183},
+    {285,283,294,274,384,184}, {286,284,295,275,385,185}, {287,285,296,276,386,186}, {288,286,297,277,387,187},
+    {289,287,298,278,388,188}, {280,288,299,279,389,189}, {291,299,200,280,390,190}, {292,290,201,281,391,191},
+    {293,291,202,282,392,192}, {294,292,203,283,393,193}, {295,293,204,284,394,194}, {296,294,205,285,395,195},
+    {297,295,206,286,396,196}, {298,296,207,287,397,197}, {299,297,208,288,398,198}, {290,298,209,289,399,199},
+    {301,309,310,390,400,200}, {302,300,311,391,401,201}, {303,301,312,392,402,202}, {304,302,313,393,403,203},
+    {305,303,314,394,404,204}, {306,304,315,395,405,205}, {307,305,316,396,406,206}, {308,306,317,397,407,207},
+    {309,307,318,398,408,208}, {300,308,319,399,409,209}, {311,319,320,300,410,210}, {312,310,321,301,411,211},
+    {313,311,322,302,412,212}, {314,312,323,303,413,213}, {315,313,324,304,414,214}, {316,314,325,305,415,215},
+    {317,315,326,306,416,216}, {318,316,327,307,417,217}, {319,317,328,308,418,218}, {310,318,329,309,419,219},
+    {321,329,330,310,420,220}, {322,320,331,311,421,221}, {323,321,332,312,422,222}, {324,322,333,313,423,223},
+    {325,323,334,314,424,224}, {326,324,335,315,425,225}, {327,325,336,316,426,226}, {328,326,337,317,427,227},
+    {329,327,338,318,428,228}, {320,328,339,319,429,229}, {331,339,340,320,430,230}, {332,330,341,321,431,231},
+    {333,331,342,322,432,232}, {334,332,343,323,433,233}, {335,333,344,324,434,234}, {336,334,345,325,435,235},
+    {337,335,346,326,436,236}, {338,336,347,327,437,237}, {339,337,348,328,438,238}, {330,338,349,329,439,239},
+    {341,349,350,330,440,240}, {342,340,351,331,441,241}, {343,341,352,332,442,242}, {344,342,353,333,443,243},
+    {345,343,354,334,444,244}, {346,344,355,335,445,245}, {347,345,356,336,446,246}, {348,346,357,337,447,247},
+    {349,347,358,338,448,248}, {340,348,359,339,449,249}, {351,359,360,340,450,250}, {352,350,361,341,451,251},
+    {353,351,362,342,452,252}, {354,352,363,343,453,253}, {355,353,364,344,454,254}, {356,354,365,345,455,255},
+    {357,355,366,346,456,256}, {358,356,367,347,457,257}, {359,357,368,348,458,258}, {350,358,369,349,459,259},
+    {361,369,370,350,460,260}, {362,360,371,351,461,261}, {363,361,372,352,462,262}, {364,362,373,353,463,263},
+    {365,363,374,354,464,264}, {366,364,375,355,465,265}, {367,365,376,356,466,266}, {368,366,377,357,467,267},
+    {369,367,378,358,468,268}, {360,368,379,359,469,269}, {371,379,380,360,470,270}, {372,370,381,361,471,271},
+    {373,371,382,362,472,272}, {374,372,383,363,473,273}, {375,373,384,364,474,274}, {376,374,385,365,475,275},
+    {377,375,386,366,476,276}, {378,376,387,367,477,277}, {379,377,388,368,478,278}, {370,378,389,369,479,279},
+    {381,389,390,370,480,280}, {382,380,391,371,481,281}, {383,381,392,372,482,282}, {384,382,393,373,483,283},
+    {385,383,394,374,484,284}, {386,384,395,375,485,285}, {387,385,396,376,486,286}, {388,386,397,377,487,287},
+    {389,387,398,378,488,288}, {380,388,399,379,489,289}, {391,399,300,380,490,290}, {392,390,301,381,491,291},
+    {393,391,302,382,492,292}, {394,392,303,383,493,293}, {395,393,304,384,494,294}, {396,394,305,385,495,295},
+    {397,395,306,386,496,296}, {398,396,307,387,497,297}, {399,397,308,388,498,298}, {390,398,309,389,499,299},
+    {401,409,410,490,500,300}, {402,400,411,491,501,301}, {403,401,412,492,502,302}, {404,402,413,493,503,303},
+    {405,403,414,494,504,304}, {406,404,415,495,505,305}, {407,405,416,496,506,306}, {408,406,417,497,507,307},
+    {409,407,418,498,508,308}, {400,408,419,499,509,309}, {411,419,420,400,510,310}, {412,410,421,401,511,311},
+    {413,411,422,402,512,312}, {414,412,423,403,513,313}, {415,413,424,404,514,314}, {416,414,425,405,515,315},
+    {417,415,426,406,516,316}, {418,416,427,407,517,317}, {419,417,428,408,518,318}, {410,418,429,409,519,319},
+    {421,429,430,410,520,320}, {422,420,431,411,521,321}, {423,421,432,412,522,322}, {424,422,433,413,523,323},
+    {425,423,434,414,524,324}, {426,424,435,415,525,325}, {427,425,436,416,526,326}, {428,426,437,417,527,327},
+    {429,427,438,418,528,328}, {420,428,439,419,529,329}, {431,439,440,420,530,330}, {432,430,441,421,531,331},
+    {433,431,442,422,532,332}, {434,432,443,423,533,333}, {435,433,444,424,534,334}, {436,434,445,425,535,335},
+    {437,435,446,426,536,336}, {438,436,447,427,537,337}, {439,437,448,428,538,338}, {430,438,449,429,539,339},
+    {441,449,450,430,540,340}, {442,440,451,431,541,341}, {443,441,452,432,542,342}, {444,442,453,433,543,343},
+    {445,443,454,434,544,344}, {446,444,455,435,545,345}, {447,445,456,436,546,346}, {448,446,457,437,547,347},
+    {449,447,458,438,548,348}, {440,448,459,439,549,349}, {451,459,460,440,550,350}, {452,450,461,441,551,351},
+    {453,451,462,442,552,352}, {454,452,463,443,553,353}, {455,453,464,444,554,354}, {456,454,465,445,555,355},
+    {457,455,466,446,556,356}, {458,456,467,447,557,357}, {459,457,468,448,558,358}, {450,458,469,449,559,359},
+    {461,469,470,450,560,360}, {462,460,471,451,561,361}, {463,461,472,452,562,362}, {464,462,473,453,563,363},
+    {465,463,474,454,564,364}, {466,464,475,455,565,365}, {467,465,476,456,566,366}, {468,466,477,457,567,367},
+    {469,467,478,458,568,368}, {460,468,479,459,569,369}, {471,479,480,460,570,370}, {472,470,481,461,571,371},
+    {473,471,482,462,572,372}, {474,472,483,463,573,373}, {475,473,484,464,574,374}, {476,474,485,465,575,375},
+    {477,475,486,466,576,376}, {478,476,487,467,577,377}, {479,477,488,468,578,378}, {470,478,489,469,579,379},
+    {481,489,490,470,580,380}, {482,480,491,471,581,381}, {483,481,492,472,582,382}, {484,482,493,473,583,383},
+    {485,483,494,474,584,384}, {486,484,495,475,585,385}, {487,485,496,476,586,386}, {488,486,497,477,587,387},
+    {489,487,498,478,588,388}, {480,488,499,479,589,389}, {491,499,400,480,590,390}, {492,490,401,481,591,391},
+    {493,491,402,482,592,392}, {494,492,403,483,593,393}, {495,493,404,484,594,394}, {496,494,405,485,595,395},
+    {497,495,406,486,596,396}, {498,496,407,487,597,397}, {499,497,408,488,598,398}, {490,498,409,489,599,399},
+    {501,509,510,590,600,400}, {502,500,511,591,601,401}, {503,501,512,592,602,402}, {504,502,513,593,603,403},
+    {505,503,514,594,604,404}, {506,504,515,595,605,405}, {507,505,516,596,606,406}, {508,506,517,597,607,407},
+    {509,507,518,598,608,408}, {500,508,519,599,609,409}, {511,519,520,500,610,410}, {512,510,521,501,611,411},
+    {513,511,522,502,612,412}, {514,512,523,503,613,413}, {515,513,524,504,614,414}, {516,514,525,505,615,415},
+    {517,515,526,506,616,416}, {518,516,527,507,617,417}, {519,517,528,508,618,418}, {510,518,529,509,619,419},
+    {521,529,530,510,620,420}, {522,520,531,511,621,421}, {523,521,532,512,622,422}, {524,522,533,513,623,423},
+    {525,523,534,514,624,424}, {526,524,535,515,625,425}, {527,525,536,516,626,426}, {528,526,537,517,627,427},
+    {529,527,538,518,628,428}, {520,528,539,519,629,429}, {531,539,540,520,630,430}, {532,530,541,521,631,431},
+    {533,531,542,522,632,432}, {534,532,543,523,633,433}, {535,533,544,524,634,434}, {536,534,545,525,635,435},
+    {537,535,546,526,636,436}, {538,536,547,527,637,437}, {539,537,548,528,638,438}, {530,538,549,529,639,439},
+    {541,549,550,530,640,440}, {542,540,551,531,641,441}, {543,541,552,532,642,442}, {544,542,553,533,643,443},
+    {545,543,554,534,644,444}, {546,544,555,535,645,445}, {547,545,556,536,646,446}, {548,546,557,537,647,447},
+    {549,547,558,538,648,448}, {540,548,559,539,649,449}, {551,559,560,540,650,450}, {552,550,561,541,651,451},
+    {553,551,562,542,652,452}, {554,552,563,543,653,453}, {555,553,564,544,654,454}, {556,554,565,545,655,455},
+    {557,555,566,546,656,456}, {558,556,567,547,657,457}, {559,557,568,548,658,458}, {550,558,569,549,659,459},
+    {561,569,570,550,660,460}, {562,560,571,551,661,461}, {563,561,572,552,662,462}, {564,562,573,553,663,463},
+    {565,563,574,554,664,464}, {566,564,575,555,665,465}, {567,565,576,556,666,466}, {568,566,577,557,667,467},
+    {569,567,578,558,668,468}, {560,568,579,559,669,469}, {571,579,580,560,670,470}, {572,570,581,561,671,471},
+    {573,571,582,562,672,472}, {574,572,583,563,673,473}, {575,573,584,564,674,474}, {576,574,585,565,675,475},
+    {577,575,586,566,676,476}, {578,576,587,567,677,477}, {579,577,588,568,678,478}, {570,578,589,569,679,479},
+    {581,589,590,570,680,480}, {582,580,591,571,681,481}, {583,581,592,572,682,482}, {584,582,593,573,683,483},
+    {585,583,594,574,684,484}, {586,584,595,575,685,485}, {587,585,596,576,686,486}, {588,586,597,577,687,487},
+    {589,587,598,578,688,488}, {580,588,599,579,689,489}, {591,599,500,580,690,490}, {592,590,501,581,691,491},
+    {593,591,502,582,692,492}, {594,592,503,583,693,493}, {595,593,504,584,694,494}, {596,594,505,585,695,495},
+    {597,595,506,586,696,496}, {598,596,507,587,697,497}, {599,597,508,588,698,498}, {590,598,509,589,699,499},
+    {601,609,610,690,700,500}, {602,600,611,691,701,501}, {603,601,612,692,702,502}, {604,602,613,693,703,503},
+    {605,603,614,694,704,504}, {606,604,615,695,705,505}, {607,605,616,696,706,506}, {608,606,617,697,707,507},
+    {609,607,618,698,708,508}, {600,608,619,699,709,509}, {611,619,620,600,710,510}, {612,610,621,601,711,511},
+    {613,611,622,602,712,512}, {614,612,623,603,713,513}, {615,613,624,604,714,514}, {616,614,625,605,715,515},
+    {617,615,626,606,716,516}, {618,616,627,607,717,517}, {619,617,628,608,718,518}, {610,618,629,609,719,519},
+    {621,629,630,610,720,520}, {622,620,631,611,721,521}, {623,621,632,612,722,522}, {624,622,633,613,723,523},
+    {625,623,634,614,724,524}, {626,624,635,615,725,525}, {627,625,636,616,726,526}, {628,626,637,617,727,527},
+    {629,627,638,618,728,528}, {620,628,639,619,729,529}, {631,639,640,620,730,530}, {632,630,641,621,731,531},
+    {633,631,642,622,732,532}, {634,632,643,623,733,533}, {635,633,644,624,734,534}, {636,634,645,625,735,535},
+    {637,635,646,626,736,536}, {638,636,647,627,737,537}, {639,637,648,628,738,538}, {630,638,649,629,739,539},
+    {641,649,650,630,740,540}, {642,640,651,631,741,541}, {643,641,652,632,742,542}, {644,642,653,633,743,543},
+    {645,643,654,634,744,544}, {646,644,655,635,745,545}, {647,645,656,636,746,546}, {648,646,657,637,747,547},
+    {649,647,658,638,748,548}, {640,648,659,639,749,549}, {651,659,660,640,750,550}, {652,650,661,641,751,551},
+    {653,651,662,642,752,552}, {654,652,663,643,753,553}, {655,653,664,644,754,554}, {656,654,665,645,755,555},
+    {657,655,666,646,756,556}, {658,656,667,647,757,557}, {659,657,668,648,758,558}, {650,658,669,649,759,559},
+    {661,669,670,650,760,560}, {662,660,671,651,761,561}, {663,661,672,652,762,562}, {664,662,673,653,763,563},
+    {665,663,674,654,764,564}, {666,664,675,655,765,565}, {667,665,676,656,766,566}, {668,666,677,657,767,567},
+    {669,667,678,658,768,568}, {660,668,679,659,769,569}, {671,679,680,660,770,570}, {672,670,681,661,771,571},
+    {673,671,682,662,772,572}, {674,672,683,663,773,573}, {675,673,684,664,774,574}, {676,674,685,665,775,575},
+    {677,675,686,666,776,576}, {678,676,687,667,777,577}, {679,677,688,668,778,578}, {670,678,689,669,779,579},
+    {681,689,690,670,780,580}, {682,680,691,671,781,581}, {683,681,692,672,782,582}, {684,682,693,673,783,583},
+    {685,683,694,674,784,584}, {686,684,695,675,785,585}, {687,685,696,676,786,586}, {688,686,697,677,787,587},
+    {689,687,698,678,788,588}, {680,688,699,679,789,589}, {691,699,600,680,790,590}, {692,690,601,681,791,591},
+    {693,691,602,682,792,592}, {694,692,603,683,793,593}, {695,693,604,684,794,594}, {696,694,605,685,795,595},
+    {697,695,606,686,796,596}, {698,696,607,687,797,597}, {699,697,608,688,798,598}, {690,698,609,689,799,599},
+    {701,709,710,790,800,600}, {702,700,711,791,801,601}, {703,701,712,792,802,602}, {704,702,713,793,803,603},
+    {705,703,714,794,804,604}, {706,704,715,795,805,605}, {707,705,716,796,806,606}, {708,706,717,797,807,607},
+    {709,707,718,798,808,608}, {700,708,719,799,809,609}, {711,719,720,700,810,610}, {712,710,721,701,811,611},
+    {713,711,722,702,812,612}, {714,712,723,703,813,613}, {715,713,724,704,814,614}, {716,714,725,705,815,615},
+    {717,715,726,706,816,616}, {718,716,727,707,817,617}, {719,717,728,708,818,618}, {710,718,729,709,819,619},
+    {721,729,730,710,820,620}, {722,720,731,711,821,621}, {723,721,732,712,822,622}, {724,722,733,713,823,623},
+    {725,723,734,714,824,624}, {726,724,735,715,825,625}, {727,725,736,716,826,626}, {728,726,737,717,827,627},
+    {729,727,738,718,828,628}, {720,728,739,719,829,629}, {731,739,740,720,830,630}, {732,730,741,721,831,631},
+    {733,731,742,722,832,632}, {734,732,743,723,833,633}, {735,733,744,724,834,634}, {736,734,745,725,835,635},
+    {737,735,746,726,836,636}, {738,736,747,727,837,637}, {739,737,748,728,838,638}, {730,738,749,729,839,639},
+    {741,749,750,730,840,640}, {742,740,751,731,841,641}, {743,741,752,732,842,642}, {744,742,753,733,843,643},
+    {745,743,754,734,844,644}, {746,744,755,735,845,645}, {747,745,756,736,846,646}, {748,746,757,737,847,647},
+    {749,747,758,738,848,648}, {740,748,759,739,849,649}, {751,759,760,740,850,650}, {752,750,761,741,851,651},
+    {753,751,762,742,852,652}, {754,752,763,743,853,653}, {755,753,764,744,854,654}, {756,754,765,745,855,655},
+    {757,755,766,746,856,656}, {758,756,767,747,857,657}, {759,757,768,748,858,658}, {750,758,769,749,859,659},
+    {761,769,770,750,860,660}, {762,760,771,751,861,661}, {763,761,772,752,862,662}, {764,762,773,753,863,663},
+    {765,763,774,754,864,664}, {766,764,775,755,865,665}, {767,765,776,756,866,666}, {768,766,777,757,867,667},
+    {769,767,778,758,868,668}, {760,768,779,759,869,669}, {771,779,780,760,870,670}, {772,770,781,761,871,671},
+    {773,771,782,762,872,672}, {774,772,783,763,873,673}, {775,773,784,764,874,674}, {776,774,785,765,875,675},
+    {777,775,786,766,876,676}, {778,776,787,767,877,677}, {779,777,788,768,878,678}, {770,778,789,769,879,679},
+    {781,789,790,770,880,680}, {782,780,791,771,881,681}, {783,781,792,772,882,682}, {784,782,793,773,883,683},
+    {785,783,794,774,884,684}, {786,784,795,775,885,685}, {787,785,796,776,886,686}, {788,786,797,777,887,687},
+    {789,787,798,778,888,688}, {780,788,799,779,889,689}, {791,799,700,780,890,690}, {792,790,701,781,891,691},
+    {793,791,702,782,892,692}, {794,792,703,783,893,693}, {795,793,704,784,894,694}, {796,794,705,785,895,695},
+    {797,795,706,786,896,696}, {798,796,707,787,897,697}, {799,797,708,788,898,698}, {790,798,709,789,899,699},
+    {801,809,810,890,900,700}, {802,800,811,891,901,701}, {803,801,812,892,902,702}, {804,802,813,893,903,703},
+    {805,803,814,894,904,704}, {806,804,815,895,905,705}, {807,805,816,896,906,706}, {808,806,817,897,907,707},
+    {809,807,818,898,908,708}, {800,808,819,899,909,709}, {811,819,820,800,910,710}, {812,810,821,801,911,711},
+    {813,811,822,802,912,712}, {814,812,823,803,913,713}, {815,813,824,804,914,714}, {816,814,825,805,915,715},
+    {817,815,826,806,916,716}, {818,816,827,807,917,717}, {819,817,828,808,918,718}, {810,818,829,809,919,719},
+    {821,829,830,810,920,720}, {822,820,831,811,921,721}, {823,821,832,812,922,722}, {824,822,833,813,923,723},
+    {825,823,834,814,924,724}, {826,824,835,815,925,725}, {827,825,836,816,926,726}, {828,826,837,817,927,727},
+    {829,827,838,818,928,728}, {820,828,839,819,929,729}, {831,839,840,820,930,730}, {832,830,841,821,931,731},
+    {833,831,842,822,932,732}, {834,832,843,823,933,733}, {835,833,844,824,934,734}, {836,834,845,825,935,735},
+    {837,835,846,826,936,736}, {838,836,847,827,937,737}, {839,837,848,828,938,738}, {830,838,849,829,939,739},
+    {841,849,850,830,940,740}, {842,840,851,831,941,741}, {843,841,852,832,942,742}, {844,842,853,833,943,743},
+    {845,843,854,834,944,744}, {846,844,855,835,945,745}, {847,845,856,836,946,746}, {848,846,857,837,947,747},
+    {849,847,858,838,948,748}, {840,848,859,839,949,749}, {851,859,860,840,950,750}, {852,850,861,841,951,751},
+    {853,851,862,842,952,752}, {854,852,863,843,953,753}, {855,853,864,844,954,754}, {856,854,865,845,955,755},
+    {857,855,866,846,956,756}, {858,856,867,847,957,757}, {859,857,868,848,958,758}, {850,858,869,849,959,759},
+    {861,869,870,850,960,760}, {862,860,871,851,961,761}, {863,861,872,852,962,762}, {864,862,873,853,963,763},
+    {865,863,874,854,964,764}, {866,864,875,855,965,765}, {867,865,876,856,966,766}, {868,866,877,857,967,767},
+    {869,867,878,858,968,768}, {860,868,879,859,969,769}, {871,879,880,860,970,770}, {872,870,881,861,971,771},
+    {873,871,882,862,972,772}, {874,872,883,863,973,773}, {875,873,884,864,974,774}, {876,874,885,865,975,775},
+    {877,875,886,866,976,776}, {878,876,887,867,977,777}, {879,877,888,868,978,778}, {870,878,889,869,979,779},
+    {881,889,890,870,980,780}, {882,880,891,871,981,781}, {883,881,892,872,982,782}, {884,882,893,873,983,783},
+    {885,883,894,874,984,784}, {886,884,895,875,985,785}, {887,885,896,876,986,786}, {888,886,897,877,987,787},
+    {889,887,898,878,988,788}, {880,888,899,879,989,789}, {891,899,800,880,990,790}, {892,890,801,881,991,791},
+    {893,891,802,882,992,792}, {894,892,803,883,993,793}, {895,893,804,884,994,794}, {896,894,805,885,995,795},
+    {897,895,806,886,996,796}, {898,896,807,887,997,797}, {899,897,808,888,998,798}, {890,898,809,889,999,799},
+    {901,909,910,990,0,800}, {902,900,911,991,1,801}, {903,901,912,992,2,802}, {904,902,913,993,3,803},
+    {905,903,914,994,4,804}, {906,904,915,995,5,805}, {907,905,916,996,6,806}, {908,906,917,997,7,807},
+    {909,907,918,998,8,808}, {900,908,919,999,9,809}, {911,919,920,900,10,810}, {912,910,921,901,11,811},
+    {913,911,922,902,12,812}, {914,912,923,903,13,813}, {915,913,924,904,14,814}, {916,914,925,905,15,815},
+    {917,915,926,906,16,816}, {918,916,927,907,17,817}, {919,917,928,908,18,818}, {910,918,929,909,19,819},
+    {921,929,930,910,20,820}, {922,920,931,911,21,821}, {923,921,932,912,22,822}, {924,922,933,913,23,823},
+    {925,923,934,914,24,824}, {926,924,935,915,25,825}, {927,925,936,916,26,826}, {928,926,937,917,27,827},
+    {929,927,938,918,28,828}, {920,928,939,919,29,829}, {931,939,940,920,30,830}, {932,930,941,921,31,831},
+    {933,931,942,922,32,832}, {934,932,943,923,33,833}, {935,933,944,924,34,834}, {936,934,945,925,35,835},
+    {937,935,946,926,36,836}, {938,936,947,927,37,837}, {939,937,948,928,38,838}, {930,938,949,929,39,839},
+    {941,949,950,930,40,840}, {942,940,951,931,41,841}, {943,941,952,932,42,842}, {944,942,953,933,43,843},
+    {945,943,954,934,44,844}, {946,944,955,935,45,845}, {947,945,956,936,46,846}, {948,946,957,937,47,847},
+    {949,947,958,938,48,848}, {940,948,959,939,49,849}, {951,959,960,940,50,850}, {952,950,961,941,51,851},
+    {953,951,962,942,52,852}, {954,952,963,943,53,853}, {955,953,964,944,54,854}, {956,954,965,945,55,855},
+    {957,955,966,946,56,856}, {958,956,967,947,57,857}, {959,957,968,948,58,858}, {950,958,969,949,59,859},
+    {961,969,970,950,60,860}, {962,960,971,951,61,861}, {963,961,972,952,62,862}, {964,962,973,953,63,863},
+    {965,963,974,954,64,864}, {966,964,975,955,65,865}, {967,965,976,956,66,866}, {968,966,977,957,67,867},
+    {969,967,978,958,68,868}, {960,968,979,959,69,869}, {971,979,980,960,70,870}, {972,970,981,961,71,871},
+    {973,971,982,962,72,872}, {974,972,983,963,73,873}, {975,973,984,964,74,874}, {976,974,985,965,75,875},
+    {977,975,986,966,76,876}, {978,976,987,967,77,877}, {979,977,988,968,78,878}, {970,978,989,969,79,879},
+    {981,989,990,970,80,880}, {982,980,991,971,81,881}, {983,981,992,972,82,882}, {984,982,993,973,83,883},
+    {985,983,994,974,84,884}, {986,984,995,975,85,885}, {987,985,996,976,86,886}, {988,986,997,977,87,887},
+    {989,987,998,978,88,888}, {980,988,999,979,89,889}, {991,999,900,980,90,890}, {992,990,901,981,91,891},
+    {993,991,902,982,92,892}, {994,992,903,983,93,893}, {995,993,904,984,94,894}, {996,994,905,985,95,895},
+    {997,995,906,986,96,896}, {998,996,907,987,97,897}, {999,997,908,988,98,898}, {990,998,909,989,99,899},
+};
+
+// Direction out of every cell along a Hamiltonian cycle, an index into grid_dirs
+static const unsigned char grid_cycle_dir[GRID_CELLS] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0,
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
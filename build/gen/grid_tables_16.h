@@ -0,0 +1,1680 @@
+// Generated by nob.c, do not edit. Lookup tables for GRID_SIZE 16, see src/grid.h.
+#define GRID_CELLS 4096
+
+// Index of a cell, (z*GRID_SIZE + y)*GRID_SIZE + x
+typedef uint16_t Grid_Cell;
+
+static const unsigned char grid_coords[GRID_CELLS][3] = {
+    {0,0,0}, {1,0,0}, {2,0,0}, {3,0,0}, {4,0,0}, {5,0,0}, {6,0,0}, {7,0,0},
+    {8,0,0}, {9,0,0}, {10,0,0}, {11,0,0}, {12,0,0}, {13,0,0}, {14,0,0}, {15,0,0},
+    {0,1,0}, {1,1,0}, {2,1,0}, {3,1,0}, {4,1,0}, {5,1,0}, {6,1,0}, {7,1,0},
+    {8,1,0}, {9,1,0}, {10,1,0}, {11,1,0}, {12,1,0}, {13,1,0}, {14,1,0}, {15,1,0},
+    {0,2,0}, {1,2,0}, {2,2,0}, {3,2,0}, {4,2,0}, {5,2,0}, {6,2,0}, {7,2,0},
+    {8,2,0}, {9,2,0}, {10,2,0}, {11,2,0}, {12,2,0}, {13,2,0}, {14,2,0}, {15,2,0},
+    {0,3,0}, {1,3,0}, {2,3,0}, {3,3,0}, {4,3,0}, {5,3,0}, {6,3,0}, {7,3,0},
+    {8,3,0}, {9,3,0}, {10,3,0}, {11,3,0}, {12,3,0}, {13,3,0}, {14,3,0}, {15,3,0},
+    {0,4,0}, {1,4,0}, {2,4,0}, {3,4,0}, {4,4,0}, {5,4,0}, {6,4,0}, {7,4,0},
+    {8,4,0}, {9,4,0}, {10,4,0}, {11,4,0}, {12,4,0}, {13,4,0}, {14,4,0}, {15,4,0},
+    {0,5,0}, {1,5,0}, {2,5,0}, {3,5,0}, {4,5,0}, {5,5,0}, {6,5,0}, {7,5,0},
+    {8,5,0}, {9,5,0}, {10,5,0}, {11,5,0}, {12,5,0}, {13,5,0}, {14,5,0}, {15,5,0},
+    {0,6,0}, {1,6,0}, {2,6,0}, {3,6,0}, {4,6,0}, {5,6,0}, {6,6,0}, {7,6,0},
+    {8,6,0}, {9,6,0}, {10,6,0}, {11,6,0}, {12,6,0}, {13,6,0}, {14,6,0}, {15,6,0},
+    {0,7,0}, {1,7,0}, {2,7,0}, {3,7,0}, {4,7,0}, {5,7,0}, {6,7,0}, {7,7,0},
+    {8,7,0}, {9,7,0}, {10,7,0}, {11,7,0}, {12,7,0}, {13,7,0}, {14,7,0}, {15,7,0},
+    {0,8,0}, {1,8,0}, {2,8,0}, {3,8,0}, {4,8,0}, {5,8,0}, {6,8,0}, {7,8,0},
+    {8,8,0}, {9,8,0}, {10,8,0}, {11,8,0}, {12,8,0}, {13,8,0}, {14,8,0}, {15,8,0},
+    {0,9,0}, {1,9,0}, {2,9,0}, {3,9,0}, {4,9,0}, {5,9,0}, {6,9,0}, {7,9,0},
+    {8,9,0}, {9,9,0}, {10,9,0}, {11,9,0}, {12,9,0}, {13,9,0}, {14,9,0}, {15,9,0},
+    {0,10,0}, {1,10,0}, {2,10,0}, {3,10,0}, {4,10,0}, {5,10,0}, {6,10,0}, {7,10,0},
+    {8,10,0}, {9,10,0}, {10,10,0}, {11,10,0}, {12,10,0}, {13,10,0}, {14,10,0}, {15,10,0},
+    {0,11,0}, {1,11,0}, {2,11,0}, {3,11,0}, {4,11,0}, {5,11,0}, {6,11,0}, {7,11,0},
+    {8,11,0}, {9,11,0}, {10,11,0}, {11,11,0}, {12,11,0}, {13,11,0}, {14,11,0}, {15,11,0},
+    {0,12,0}, {1,12,0}, {2,12,0}, {3,12,0}, {4,12,0}, {5,12,0}, {6,12,0}, {7,12,0},
+    {8,12,0}, {9,12,0}, {10,12,0}, {11,12,0}, {12,12,0}, {13,12,0}, {14,12,0}, {15,12,0},
+    {0,13,0}, {1,13,0}, {2,13,0}, {3,13,0}, {4,13,0}, {5,13,0}, {6,13,0}, {7,13,0},
+    {8,13,0}, {9,13,0}, {10,13,0}, {11,13,0}, {12,13,0}, {13,13,0}, {14,13,0}, {15,13,0},
+    {0,14,0}, {1,14,0}, {2,14,0}, {3,14,0}, {4,14,0}, {5,14,0}, {6,14,0}, {7,14,0},
+    {8,14,0}, {9,14,0}, {10,14,0}, {11,14,0}, {12,14,0}, {13,14,0}, {14,14,0}, {15,14,0},
+    {0,15,0}, {1,15,0}, {2,15,0}, {3,15,0}, {4,15,0}, {5,15,0}, {6,15,0}, {7,15,0},
+    {8,15,0}, {9,15,0}, {10,15,0}, {11,15,0}, {12,15,0}, {13,15,0}, {14,15,0}, {15,15,0},
+    {0,0,1}, {1,0,1}, {2,0,1}, {3,0,1}, {4,0,1}, {5,0,1}, {6,0,1}, {7,0,1},
+    {8,0,1}, {9,0,1}, {10,0,1}, {11,0,1}, {12,0,1}, {13,0,1}, {14,0,1}, {15,0,1},
+    {0,1,1}, {1,1,1}, {2,1,1}, {3,1,1}, {4,1,1}, {5,1,1}, {6,1,1}, {7,1,1},
+    {8,1,1}, {9,1,1}, {10,1,1}, {11,1,1}, {12,1,1}, {13,1,1}, {14,1,1}, {15,1,1},
+    {0,2,1}, {1,2,1}, {2,2,1}, {3,2,1}, {4,2,1}, {5,2,1}, {6,2,1}, {7,2,1},
+    {8,2,1}, {9,2,1}, {10,2,1}, {11,2,1}, {12,2,1}, {13,2,1}, {14,2,1}, {15,2,1},
+    {0,3,1}, {1,3,1}, {2,3,1}, {3,3,1}, {4,3,1}, {5,3,1}, {6,3,1}, {7,3,1},
+    {8,3,1}, {9,3,1}, {10,3,1}, {11,3,1}, {12,3,1}, {13,3,1}, {14,3,1}, {15,3,1},
+    {0,4,1}, {1,4,1}, {2,4,1}, {3,4,1}, {4,4,1}, {5,4,1}, {6,4,1}, {7,4,1},
+    {8,4,1}, {9,4,1}, {10,4,1}, {11,4,1}, {12,4,1}, {13,4,1}, {14,4,1}, {15,4,1},
+    {0,5,1}, {1,5,1}, {2,5,1}, {3,5,1}, {4,5,1}, {5,5,1}, {6,5,1}, {7,5,1},
+    {8,5,1}, {9,5,1}, {10,5,1}, {11,5,1}, {12,5,1}, {13,5,1}, {14,5,1}, {15,5,1},
+    {0,6,1}, {1,6,1}, {2,6,1}, {3,6,1}, {4,6,1}, {5,6,1}, {6,6,1}, {7,6,1},
+    {8,6,1}, {9,6,1}, {10,6,1}, {11,6,1}, {12,6,1}, {13,6,1}, {14,6,1}, {15,6,1},
+    {0,7,1}, {1,7,1}, {2,7,1}, {3,7,1}, {4,7,1}, {5,7,1}, {6,7,1}, {7,7,1},
+    {8,7,1}, {9,7,1}, {10,7,1}, {11,7,1}, {12,7,1}, {13,7,1}, {14,7,1}, {15,7,1},
+    {0,8,1}, {1,8,1}, {2,8,1}, {3,8,1}, {4,8,1}, {5,8,1}, {6,8,1}, {7,8,1},
+    {8,8,1}, {9,8,1}, {10,8,1}, {11,8,1}, {12,8,1}, {13,8,1}, {14,8,1}, {15,8,1},
+    {0,9,1}, {1,9,1}, {2,9,1}, {3,9,1}, {4,9,1}, {5,9,1}, {6,9,1}, {7,9,1},
+    {8,9,1}, {9,9,1}, {10,9,1}, {11,9,1}, {12,9,1}, {13,9,1}, {14,9,1}, {15,9,1},
+    {0,10,1}, {1,10,1}, {2,10,1}, {3,10,1}, {4,10,1}, {5,10,1}, {6,10,1}, {7,10,1},
+    {8,10,1}, {9,10,1}, {10,10,1}, {11,10,1}, {12,10,1}, {13,10,1}, {14,10,1}, {15,10,1},
+    {0,11,1}, {1,11,1}, {2,11,1}, {3,11,1}, {4,11,1}, {5,11,1}, {6,11,1}, {7,11,1},
+    {8,11,1}, {9,11,1}, {10,11,1}, {11,11,1}, {12,11,1}, {13,11,1}, {14,11,1}, {15,11,1},
+    {0,12,1}, {1,12,1}, {2,12,1}, {3,12,1}, {4,12,1}, {5,12,1}, {6,12,1}, {7,12,1},
+    {8,12,1}, {9,12,1}, {10,12,1}, {11,12,1}, {12,12,1}, {13,12,1}, {14,12,1}, {15,12,1},
+    {0,13,1}, {1,13,1}, {2,13,1}, {3,13,1}, {4,13,1}, {5,13,1}, {6,13,1}, {7,13,1},
+    {8,13,1}, {9,13,1}, {10,13,1}, {11,13,1}, {12,13,1}, {13,13,1}, {14,13,1}, {15,13,1},
+    {0,14,1}, {1,14,1}, {2,14,1}, {3,14,1}, {4,14,1}, {5,14,1}, {6,14,1}, {7,14,1},
+    {8,14,1}, {9,14,1}, {10,14,1}, {11,14,1}, {12,14,1}, {13,14,1}, {14,14,1}, {15,14,1},
+    {0,15,1}, {1,15,1}, {2,15,1}, {3,15,1}, {4,15,1}, {5,15,1}, {6,15,1}, {7,15,1},
+    {8,15,1}, {9,15,1}, {10,15,1}, {11,15,1}, {12,15,1}, {13,15,1}, {14,15,1}, {15,15,1},
+    {0,0,2}, {1,0,2}, {2,0,2}, {3,0,2}, {4,0,2}, {5,0,2}, {6,0,2}, {7,0,2},
+    {8,0,2}, {9,0,2}, {10,0,2}, {11,0,2}, {12,0,2}, {13,0,2}, {14,0,2}, {15,0,2},
+    {0,1,2}, {1,1,2}, {2,1,2}, {3,1,2}, {4,1,2}, {5,1,2}, {6,1,2}, {7,1,2},
+    {8,1,2}, {9,1,2}, {10,1,2}, {11,1,2}, {12,1,2}, {13,1,2}, {14,1,2}, {15,1,2},
+    {0,2,2}, {1,2,2}, {2,2,2}, {3,2,2}, {4,2,2}, {5,2,2}, {6,2,2}, {7,2,2},
+    {8,2,2}, {9,2,2}, {10,2,2}, {11,2,2}, {12,2,2}, {13,2,2}, {14,2,2}, {15,2,2},
+    {0,3,2}, {1,3,2}, {2,3,2}, {3,3,2}, {4,3,2}, {5,3,2}, {6,3,2}, {7,3,2},
+    {8,3,2}, {9,3,2}, {10,3,2}, {11,3,2}, {12,3,2}, {13,3,2}, {14,3,2}, {15,3,2},
+    {0,4,2}, {1,4,2}, {2,4,2}, {3,4,2}, {4,4,2}, {5,4,2}, {6,4,2}, {7,4,2},
+    {8,4,2}, {9,4,2}, {10,4,2}, {11,4,2}, {12,4,2}, {13,4,2}, {14,4,2}, {15,4,2},
+    {0,5,2}, {1,5,2}, {2,5,2}, {3,5,2}, {4,5,2}, {5,5,2}, {6,5,2}, {7,5,2},
+    {8,5,2}, {9,5,2}, {10,5,2}, {11,5,2}, {12,5,2}, {13,5,2}, {14,5,2}, {15,5,2},
+    {0,6,2}, {1,6,2}, {2,6,2}, {3,6,2}, {4,6,2}, {5,6,2}, {6,6,2}, {7,6,2},
+    {8,6,2}, {9,6,2}, {10,6,2}, {11,6,2}, {12,6,2}, {13,6,2}, {14,6,2}, {15,6,2},
+    {0,7,2}, {1,7,2}, {2,7,2}, {3,7,2}, {4,7,2}, {5,7,2}, {6,7,2}, {7,7,2},
+    {8,7,2}, {9,7,2}, {10,7,2}, {11,7,2}, {12,7,2}, {13,7,2}, {14,7,2}, {15,7,2},
+    {0,8,2}, {1,8,2}, {2,8,2}, {3,8,2}, {4,8,2}, {5,8,2}, {6,8,2}, {7,8,2},
+    {8,8,2}, {9,8,2}, {10,8,2}, {11,8,2}, {12,8,2}, {13,8,2}, {14,8,2}, {15,8,2},
+    {0,9,2}, {1,9,2}, {2,9,2}, {3,9,2}, {4,9,2}, {5,9,2}, {6,9,2}, {7,9,2},
+    {8,9,2}, {9,9,2}, {10,9,2}, {11,9,2}, {12,9,2}, {13,9,2}, {14,9,2}, {15,9,2},
+    {0,10,2}, {1,10,2}, {2,10,2}, {3,10,2}, {4,10,2}, {5,10,2}, {6,10,2}, {7,10,2},
+    {8,10,2}, {9,10,2}, {10,10,2}, {11,10,2}, {12,10,2}, {13,10,2}, {14,10,2}, {15,10,2},
+    {0,11,2}, {1,11,2}, {2,11,2}, {3,11,2}, {4,11,2}, {5,11,2}, {6,11,2}, {7,11,2},
+    {8,11,2}, {9,11,2}, {10,11,2}, {11,11,2}, {12,11,2}, {13,11,2}, {14,11,2}, {15,11,2},
+    {0,12,2}, {1,12,2}, {2,12,2}, {3,12,2}, {4,12,2}, {5,12,2}, {6,12,2}, {7,12,2},
+    {8,12,2}, {9,12,2}, {10,12,2}, {11,12,2}, {12,12,2}, {13,12,2}, {14,12,2}, {15,12,2},
+    {0,13,2}, {1,13,2}, {2,13,2}, {3,13,2}, {4,13,2}, {5,13,2}, {6,13,2}, {7,13,2},
+    {8,13,2}, {9,13,2}, {10,13,2}, {11,13,2}, {12,13,2}, {13,13,2}, {14,13,2}, {15,13,2},
+    {0,14,2}, {1,14,2}, {2,14,2}, {3,14,2}, {4,14,2}, {5,14,2}, {6,14,2}, {7,14,2},
+    {8,14,2}, {9,14,2}, {10,14,2}, {11,14,2}, {12,14,2}, {13,14,2}, {14,14,2}, {15,14,2},
+    {0,15,2}, {1,15,2}, {2,15,2}, {3,15,2}, {4,15,2}, {5,15,2}, {6,15,2}, {7,15,2},
+    {8,15,2}, {9,15,2}, {10,15,2}, {11,15,2}, {12,15,2}, {13,15,2}, {14,15,2}, {15,15,2},
+    {0,0,3}, {1,0,3}, {2,0,3}, {3,0,3}, {4,0,3}, {5,0,3}, {6,0,3}, {7,0,3},
+    {8,0,3}, {9,0,3}, {10,0,3}, {11,0,3}, {12,0,3}, {13,0,3}, {14,0,3}, {15,0,3},
+    {0,1,3}, {1,1,3}, {2,1,3}, {3,1,3}, {4,1,3}, {5,1,3}, {6,1,3}, {7,1,3},
+    {8,1,3}, {9,1,3}, {10,1,3}, {11,1,3}, {12,1,3}, {13,1,3}, {14,1,3}, {15,1,3},
+    {0,2,3}, {1,2,3}, {2,2,3}, {3,2,3}, {4,2,3}, {5,2,3}, {6,2,3}, {7,2,3},
+    {8,2,3}, {9,2,3}, {10,2,3}, {11,2,3}, {12,2,3}, {13,2,3}, {14,2,3}, {15,2,3},
+    {0,3,3}, {1,3,3}, {2,3,3}, {3,3,3}, {4,3,3}, {5,3,3}, {6,3,3}, {7,3,3},
+    {8,3,3}, {9,3,3}, {10,3,3}, {11,3,3}, {12,3,3}, {13,3,3}, {14,3,3}, {15,3,3},
+    {0,4,3}, {1,4,3}, {2,4,3}, {3,4,3}, {4,4,3}, {5,4,3}, {6,4,3}, {7,4,3},
+    {8,4,3}, {9,4,3}, {10,4,3}, {11,4,3}, {12,4,3}, {13,4,3}, {14,4,3}, {15,4,3},
+    {0,5,3}, {1,5,3}, {2,5,3}, {3,5,3}, {4,5,3}, {5,5,3}, {6,5,3}, {7,5,3},
+    {8,5,3}, {9,5,3}, {10,5,3}, {11,5,3}, {12,5,3}, {13,5,3}, {14,5,3}, {15,5,3},
+    {0,6,3}, {1,6,3}, {2,6,3}, {3,6,3}, {4,6,3}, {5,6,3}, {6,6,3}, {7,6,3},
+    {8,6,3}, {9,6,3}, {10,6,3}, {11,6,3}, {12,6,3}, {13,6,3}, {14,6,3}, {15,6,3},
+    {0,7,3}, {1,7,3}, {2,7,3}, {3,7,3}, {4,7,3}, {5,7,3}, {6,7,3}, {7,7,3},
+    {8,7,3}, {9,7,3}, {10,7,3}, {11,7,3}, {12,7,3}, {13,7,3}, {14,7,3}, {15,7,3},
+    {0,8,3}, {1,8,3}, {2,8,3}, {3,8,3}, {4,8,3}, {5,8,3}, {6,8,3}, {7,8,3},
+    {8,8,3}, {9,8,3}, {10,8,3}, {11,8,3}, {12,8,3}, {13,8,3}, {14,8,3}, {15,8,3},
+    {0,9,3}, {1,9,3}, {2,9,3}, {3,9,3}, {4,9,3}, {5,9,3}, {6,9,3}, {7,9,3},
+    {8,9,3}, {9,9,3}, {10,9,3}, {11,9,3}, {12,9,3}, {13,9,3}, {14,9,3}, {15,9,3},
+    {0,10,3}, {1,10,3}, {2,10,3}, {3,10,3}, {4,10,3}, {5,10,3}, {6,10,3}, {7,10,3},
+    {8,10,3}, {9,10,3}, {10,10,3}, {11,10,3}, {12,10,3}, {13,10,3}, {14,10,3}, {15,10,3},
+    {0,11,3}, {1,11,3}, {2,11,3}, {3,11,3}, {4,11,3}, {5,11,3}, {6,11,3}, {7,11,3},
+    {8,11,3}, {9,11,3}, {10,11,3}, {11,11,3}, {12,11,3}, {13,11,3}, {14,11,3}, {15,11,3},
+    {0,12,3}, {1,12,3}, {2,12,3}, {3,12,3}, {4,12,3}, {5,12,3}, {6,12,3}, {7,12,3},
+    {8,12,3}, {9,12,3}, {10,12,3}, {11,12,3}, {12,12,3}, {13,12,3}, {14,12,3}, {15,12,3},
+    {0,13,3}, {1,13,3}, {2,13,3}, {3,13,3}, {4,13,3}, {5,13,3}, {6,13,3}, {7,13,3},
+    {8,13,3}, {9,13,3}, {10,13,3}, {11,13,3}, {12,13,3}, {13,13,3}, {14,13,3}, {15,13,3},
+    {0,14,3}, {1,14,3}, {2,14,3}, {3,14,3}, {4,14,3}, {5,14,3}, {6,14,3}, {7,14,3},
+    {8,14,3}, {9,14,3}, {10,14,3}, {11,14,3}, {12,14,3}, {13,14,3}, {14,14,3}, {15,14,3},
+    {0,15,3}, {1,15,3}, {2,15,3}, {3,15,3}, {4,15,3}, {5,15,3}, {6,15,3}, {7,15,3},
+    {8,15,3}, {9,15,3}, {10,15,3}, {11,15,3}, {12,15,3}, {13,15,3}, {14,15,3}, {15,15,3},
+    {0,0,4}, {1,0,4}, {2,0,4}, {3,0,4}, {4,0,4}, {5,0,4}, {6,0,4}, {7,0,4},
+    {8,0,4}, {9,0,4}, {10,0,4}, {11,0,4}, {12,0,4}, {13,0,4}, {14,0,4}, {15,0,4},
+    {0,1,4}, {1,1,4}, {2,1,4}, {3,1,4}, {4,1,4}, {5,1,4}, {6,1,4}, {7,1,4},
+    {8,1,4}, {9,1,4}, {10,1,4}, {11,1,4}, {12,1,4}, {13,1,4}, {14,1,4}, {15,1,4},
+    {0,2,4}, {1,2,4}, {2,2,4}, {3,2,4}, {4,2,4}, {5,2,4}, {6,2,4}, {7,2,4},
+    {8,2,4}, {9,2,4}, {10,2,4}, {11,2,4}, {12,2,4}, {13,2,4}, {14,2,4}, {15,2,4},
+    {0,3,4}, {1,3,4}, {2,3,4}, {3,3,4}, {4,3,4}, {5,3,4}, {6,3,4}, {7,3,4},
+    {8,3,4}, {9,3,4}, {10,3,4}, {11,3,4}, {12,3,4}, {13,3,4}, {14,3,4}, {15,3,4},
+    {0,4,4}, {1,4,4}, {2,4,4}, {3,4,4}, {4,4,4}, {5,4,4}, {6,4,4}, {7,4,4},
+    {8,4,4}, {9,4,4}, {10,4,4}, {11,4,4}, {12,4,4}, {13,4,4}, {14,4,4}, {15,4,4},
+    {0,5,4}, {1,5,4}, {2,5,4}, {3,5,4}, {4,5,4}, {5,5,4}, {6,5,4}, {7,5,4},
+    {8,5,4}, {9,5,4}, {10,5,4}, {11,5,4}, {12,5,4}, {13,5,4}, {14,5,4}, {15,5,4},
+    {0,6,4}, {1,6,4}, {2,6,4}, {3,6,4}, {4,6,4}, {5,6,4}, {6,6,4}, {7,6,4},
+    {8,6,4}, {9,6,4}, {10,6,4}, {11,6,4}, {12,6,4}, {13,6,4}, {14,6,4}, {15,6,4},
+    {0,7,4}, {1,7,4}, {2,7,4}, {3,7,4}, {4,7,4}, {5,7,4}, {6,7,4}, {7,7,4},
+    {8,7,4}, {9,7,4}, {10,7,4}, {11,7,4}, {12,7,4}, {13,7,4}, {14,7,4}, {15,7,4},
+    {0,8,4}, {1,8,4}, {2,8,4}, {3,8,4}, {4,8,4}, {5,8,4}, {6,8,4}, {7,8,4},
+    {8,8,4}, {9,8,4}, {10,8,4}, {11,8,4}, {12,8,4}, {13,8,4}, {14,8,4}, {15,8,4},
+    {0,9,4}, {1,9,4}, {2,9,4}, {3,9,4}, {4,9,4}, {5,9,4}, {6,9,4}, {7,9,4},
+    {8,9,4}, {9,9,4}, {10,9,4}, {11,9,4}, {12,9,4}, {13,9,4}, {14,9,4}, {15,9,4},
+    {0,10,4}, {1,10,4}, {2,10,4}, {3,10,4}, {4,10,4}, {5,10,4}, {6,10,4}, {7,10,4},
+    {8,10,4}, {9,10,4}, {10,10,4}, {11,10,4}, {12,10,4}, {13,10,4}, {14,10,4}, {15,10,4},
+    {0,11,4}, {1,11,4}, {2,11,4}, {3,11,4}, {4,11,4}, {5,11,4}, {6,11,4}, {7,11,4},
+    {8,11,4}, {9,11,4}, {10,11,4}, {11,11,4}, {12,11,4}, {13,11,4}, {14,11,4}, {15,11,4},
+    {0,12,4}, {1,12,4}, {2,12,4}, {3,12,4}, {4,12,4}, {5,12,4}, {6,12,4}, {7,12,4},
+    {8,12,4}, {9,12,4}, {10,12,4}, {11,12,4}, {12,12,4}, {13,12,4}, {14,12,4}, {15,12,4},
+    {0,13,4}, {1,13,4}, {2,13,4}, {3,13,4}, {4,13,4}, {5,13,4}, {6,13,4}, {7,13,4},
+    {8,13,4}, {9,13,4}, {10,13,4}, {11,13,4}, {12,13,4}, {13,13,4}, {14,13,4}, {15,13,4},
+    {0,14,4}, {1,14,4}, {2,14,4}, {3,14,4}, {4,14,4}, {5,14,4}, {6,14,4}, {7,14,4},
+    {8,14,4}, {9,14,4}, {10,14,4}, {11,14,4}, {12,14,4}, {13,14,4}, {14,14,4}, {15,14,4},
+    {0,15,4}, {1,15,4}, {2,15,4}, {3,15,4}, {4,15,4}, {5,15,4}, {6,15,4}, {7,15,4},
+    {8,15,4}, {9,15,4}, {10,15,4}, {11,15,4}, {12,15,4}, {13,15,4}, {14,15,4}, {15,15,4},
+    {0,0,5}, {1,0,5}, {2,0,5}, {3,0,5}, {4,0,5}, {5,0,5}, {6,0,5}, {7,0,5},
+    {8,0,5}, {9,0,5}, {10,0,5}, {11,0,5}, {12,0,5}, {13,0,5}, {14,0,5}, {15,0,5},
+    {0,1,5}, {1,1,5}, {2,1,5}, {3,1,5}, {4,1,5}, {5,1,5}, {6,1,5}, {7,1,5},
+    {8,1,5}, {9,1,5}, {10,1,5}, {11,1,5}, {12,1,5}, {13,1,5}, {14,1,5}, {15,1,5},
+    {0,2,5}, {1,2,5}, {2,2,5}, {3,2,5}, {4,2,5}, {5,2,5}, {6,2,5}, {7,2,5},
+    {8,2,5}, {9,2,5}, {10,2,5}, {11,2,5}, {12,2,5}, {13,2,5}, {14,2,5}, {15,2,5},
+    {0,3,5}, {1,3,5}, {2,3,5}, {3,3,5}, {4,3,5}, {5,3,5}, {6,3,5}, {7,3,5},
+    {8,3,5}, {9,3,5}, {10,3,5}, {11,3,5}, {12,3,5}, {13,3,5}, {14,3,5}, {15,3,5},
+    {0,4,5}, {1,4,5}, {2,4,5}, {3,4,5}, {4,4,5}, {5,4,5}, {6,4,5}, {7,4,5},
+    {8,4,5}, {9,4,5}, {10,4,5}, {11,4,5}, {12,4,5}, {13,4,5}, {14,4,5}, {15,4,5},
+    {0,5,5}, {1,5,5}, {2,5,5}, {3,5,5}, {4,5,5}, {5,5,5}, {6,5,5}, {7,5,5},
+    {8,5,5}, {9,5,5}, {10,5,5}, {11,5,5}, {12,5,5}, {13,5,5}, {14,5,5}, {15,5,5},
+    {0,6,5}, {1,6,5}, {2,6,5}, {3,6,5}, {4,6,5}, {5,6,5}, {6,6,5}, {7,6,5},
+    {8,6,5}, {9,6,5}, {10,6,5}, {11,6,5}, {12,6,5}, {13,6,5}, {14,6,5}, {15,6,5},
+    {0,7,5}, {1,7,5}, {2,7,5}, {3,7,5}, {4,7,5}, {5,7,5}, {6,7,5}, {7,7,5},
+    {8,7,5}, {9,7,5}, {10,7,5}, {11,7,5}, {12,7,5}, {13,7,5}, {14,7,5}, {15,7,5},
+    {0,8,5}, {1,8,5}, {2,8,5}, {3,8,5}, {4,8,5}, {5,8,5}, {6,8,5}, {7,8,5},
+    {8,8,5}, {9,8,5}, {10,8,5}, {11,8,5}, {12,8,5}, {13,8,5}, {14,8,5}, {15,8,5},
+    {0,9,5}, {1,9,5}, {2,9,5}, {3,9,5}, {4,9,5}, {5,9,5}, {6,9,5}, {7,9,5},
+    {8,9,5}, {9,9,5}, {10,9,5}, {11,9,5}, {12,9,5}, {13,9,5}, {14,9,5}, {15,9,5},
+    {0,10,5}, {1,10,5}, {2,10,5}, {3,10,5}, {4,10,5}, {5,10,5}, {6,10,5}, {7,10,5},
+    {8,10,5}, {9,10,5}, {10,10,5}, {11,10,5}, {12,10,5}, {13,10,5}, {14,10,5}, {15,10,5},
+    {0,11,5}, {1,11,5}, {2,11,5}, {3,11,5}, {4,11,5}, {5,11,5}, {6,11,5}, {7,11,5},
+    {8,11,5}, {9,11,5}, {10,11,5}, {11,11,5}, {12,11,5}, {13,11,5}, {14,11,5}, {15,11,5},
+    {0,12,5}, {1,12,5}, {2,12,5}, {3,12,5}, {4,12,5}, {5,12,5}, {6,12,5}, {7,12,5},
+    {8,12,5}, {9,12,5}, {10,12,5}, {11,12,5}, {12,12,5}, {13,12,5}, {14,12,5}, {15,12,5},
+    {0,13,5}, {1,13,5}, {2,13,5}, {3,13,5}, {4,13,5}, {5,13,5}, {6,13,5}, {7,13,5},
+    {8,13,5}, {9,13,5}, {10,13,5}, {11,13,5}, {12,13,5}, {13,13,5}, {14,13,5}, {15,13,5},
+    {0,14,5}, {1,14,5}, {2,14,5}, {3,14,5}, {4,14,5}, {5,14,5}, {6,14,5}, {7,14,5},
+    {8,14,5}, {9,14,5}, {10,14,5}, {11,14,5}, {12,14,5}, {13,14,5}, {14,14,5}, {15,14,5},
+    {0,15,5}, {1,15,5}, {2,15,5}, {3,15,5}, {4,15,5}, {5,15,5}, {6,15,5}, {7,15,5},
+    {8,15,5}, {9,15,5}, {10,15,5}, {11,15,5}, {12,15,5}, {13,15,5}, {14,15,5}, {15,15,5},
+    {0,0,6}, {1,0,6}, {2,0,6}, {3,0,6}, {4,0,6}, {5,0,6}, {6,0,6}, {7,0,6},
+    {8,0,6}, {9,0,6}, {10,0,6}, {11,0,6}, {12,0,6}, {13,0,6}, {14,0,6}, {15,0,6},
+    {0,1,6}, {1,1,6}, {2,1,6}, {3,1,6}, {4,1,6}, {5,1,6}, {6,1,6}, {7,1,6},
+    {8,1,6}, {9,1,6}, {10,1,6}, {11,1,6}, {12,1,6}, {13,1,6}, {14,1,6}, {15,1,6},
+    {0,2,6}, {1,2,6}, {2,2,6}, {3,2,6}, {4,2,6}, {5,2,6}, {6,2,6}, {7,2,6},
+    {8,2,6}, {9,2,6}, {10,2,6}, {11,2,6}, {12,2,6}, {13,2,6}, {14,2,6}, {15,2,6},
+    {0,3,6}, {1,3,6}, {2,3,6}, {3,3,6}, {4,3,6}, {5,3,6}, {6,3,6}, {7,3,6},
+    {8,3,6}, {9,3,6}, {10,3,6}, {11,3,6}, {12,3,6}, {13,3,6}, {14,3,6}, {15,3,6},
+    {0,4,6}, {1,4,6}, {2,4,6}, {3,4,6}, {4,4,6}, {5,4,6}, {6,4,6}, {7,4,6},
+    {8,4,6}, {9,4,6}, {10,4,6}, {11,4,6}, {12,4,6}, {13,4,6}, {14,4,6}, {15,4,6},
+    {0,5,6}, {1,5,6}, {2,5,6}, {3,5,6}, {4,5,6}, {5,5,6}, {6,5,6}, {7,5,6},
+    {8,5,6}, {9,5,6}, {10,5,6}, {11,5,6}, {12,5,6}, {13,5,6}, {14,5,6}, {15,5,6},
+    {0,6,6}, {1,6,6}, {2,6,6}, {3,6,6}, {4,6,6}, {5,6,6}, {6,6,6}, {7,6,6},
+    {8,6,6}, {9,6,6}, {10,6,6}, {11,6,6}, {12,6,6}, {13,6,6}, {14,6,6}, {15,6,6},
+    {0,7,6}, {1,7,6}, {2,7,6}, {3,7,6}, {4,7,6}, {5,7,6}, {6,7,6}, {7,7,6},
+    {8,7,6}, {9,7,6}, {10,7,6}, {11,7,6}, {12,7,6}, {13,7,6}, {14,7,6}, {15,7,6},
+    {0,8,6}, {1,8,6}, {2,8,6}, {3,8,6}, {4,8,6}, {5,8,6}, {6,8,6}, {7,8,6},
+    {8,8,6}, {9,8,6}, {10,8,6}, {11,8,6}, {12,8,6}, {13,8,6}, {14,8,6}, {15,8,6},
+    {0,9,6}, {1,9,6}, {2,9,6}, {3,9,6}, {4,9,6}, {5,9,6}, {6,9,6}, {7,9,6},
+    {8,9,6}, {9,9,6}, {10,9,6}, {11,9,6}, {12,9,6}, {13,9,6}, {14,9,6}, {15,9,6},
+    {0,10,6}, {1,10,6}, {2,10,6}, {3,10,6}, {4,10,6}, {5,10,6}, {6,10,6}, {7,10,6},
+    {8,10,6}, {9,10,6}, {10,10,6}, {11,10,6}, {12,10,6}, {13,10,6}, {14,10,6}, {15,10,6},
+    {0,11,6}, {1,11,6}, {2,11,6}, {3,11,6}, {4,11,6}, {5,11,6}, {6,11,6}, {7,11,6},
+    {8,11,6}, {9,11,6}, {10,11,6}, {11,11,6}, {12,11,6}, {13,11,6}, {14,11,6}, {15,11,6},
+    {0,12,6}, {1,12,6}, {2,12,6}, {3,12,6}, {4,12,6}, {5,12,6}, {6,12,6}, {7,12,6},
+    {8,12,6}, {9,12,6}, {10,12,6}, {11,12,6}, {12,12,6}, {13,12,6}, {14,12,6}, {15,12,6},
+    {0,13,6}, {1,13,6}, {2,13,6}, {3,13,6}, {4,13,6}, {5,13,6}, {6,13,6}, {7,13,6},
+    {8,13,6}, {9,13,6}, {10,13,6}, {11,13,6}, {12,13,6}, {13,13,6}, {14,13,6}, {15,13,6},
+    {0,14,6}, {1,14,6}, {2,14,6}, {3,14,6}, {4,14,6}, {5,14,6}, {6,14,6}, {7,14,6},
+    {8,14,6}, {9,14,6}, {10,14,6}, {11,14,6}, {12,14,6}, {13,14,6}, {14,14,6}, {15,14,6},
+    {0,15,6}, {1,15,6}, {2,15,6}, {3,15,6}, {4,15,6}, {5,15,6}, {6,15,6}, {7,15,6},
+    {8,15,6}, {9,15,6}, {10,15,6}, {11,15,6}, {12,15,6}, {13,15,6}, {14,15,6}, {15,15,6},
+    {0,0,7}, {1,0,7}, {2,0,7}, {3,0,7}, {4,0,7}, {5,0,7}, {6,0,7}, {7,0,7},
+    {8,0,7}, {9,0,7}, {10,0,7}, {11,0,7}, {12,0,7}, {13,0,7}, {14,0,7}, {15,0,7},
+    {0,1,7}, {1,1,7}, {2,1,7}, {3,1,7}, {4,1,7}, {5,1,7}, {6,1,7}, {7,1,7},
+    {8,1,7}, {9,1,7}, {10,1,7}, {11,1,7}, {12,1,7}, {13,1,7}, {14,1,7}, {15,1,7},
+    {0,2,7}, {1,2,7}, {2,2,7}, {3,2,7}, {4,2,7}, {5,2,7}, {6,2,7}, {7,2,7},
+    {8,2,7}, {9,2,7}, {10,2,7}, {11,2,7}, {12,2,7}, {13,2,7}, {14,2,7}, {15,2,7},
+    {0,3,7}, {1,3,7}, {2,3,7}, {3,3,7}, {4,3,7}, {5,3,7}, {6,3,7}, {7,3,7},
+    {8,3,7}, {9,3,7}, {10,3,7}, {11,3,7}, {12,3,7}, {13,3,7}, {14,3,7}, {15,3,7},
+    {0,4,7}, {1,4,7}, {2,4,7}, {3,4,7}, {4,4,7}, {5,4,7}, {6,4,7}, {7,4,7},
+    {8,4,7}, {9,4,7}, {10,4,7}, {11,4,7}, {12,4,7}, {13,4,7}, {14,4,7}, {15,4,7},
+    {0,5,7}, {1,5,7}, {2,5,7}, {3,5,7}, {4,5,7}, {5,5,7}, {6,5,7}, {7,5,7},
+    {8,5,7}, {9,5,7}, {10,5,7}, {11,5,7}, {12,5,7}, {13,5,7}, {14,5,7}, {15,5,7},
+    {0,6,7}, {1,6,7}, {2,6,7}, {3,6,7}, {4,6,7}, {5,6,7}, {6,6,7}, {7,6,7},
+    {8,6,7}, {9,6,7}, {10,6,7}, {11,6,7}, {12,6,7}, {13,6,7}, {14,6,7}, {15,6,7},
+    {0,7,7}, {1,7,7}, {2,7,7}, {3,7,7}, {4,7,7}, {5,7,7}, {6,7,7}, {7,7,7},
+    {8,7,7}, {9,7,7}, {10,7,7}, {11,7,7}, {12,7,7}, {13,7,7}, {14,7,7}, {15,7,7},
+    {0,8,7}, {1,8,7}, {2,8,7}, {3,8,7}, {4,8,7}, {5,8,7}, {6,8,7}, {7,8,7},
+    {8,8,7}, {9,8,7}, {10,8,7}, {11,8,7}, {12,8,7}, {13,8,7}, {14,8,7}, {15,8,7},
+    {0,9,7}, {1,9,7}, {2,9,7}, {3,9,7}, {4,9,7}, {5,9,7}, {6,9,7}, {7,9,7},
+    {8,9,7}, {9,9,7}, {10,9,7}, {11,9,7}, {12,9,7}, {13,9,7}, {14,9,7}, {15,9,7},
+    {0,10,7}, {1,10,7}, {2,10,7}, {3,10,7}, {4,10,7}, {5,10,7}, {6,10,7}, {7,10,7},
+    {8,10,7}, {9,10,7}, {10,10,7}, {11,10,7}, {12,10,7}, {13,10,7}, {14,10,7}, {15,10,7},
+    {0,11,7}, {1,11,7}, {2,11,7}, {3,11,7}, {4,11,7}, {5,11,7}, {6,11,7}, {7,11,7},
+    {8,11,7}, {9,11,7}, {10,11,7}, {11,11,7}, {12,11,7}, {13,11,7}, {14,11,7}, {15,11,7},
+    {0,12,7}, {1,12,7}, {2,12,7}, {3,12,7}, {4,12,7}, {5,12,7}, {6,12,7}, {7,12,7},
+    {8,12,7}, {9,12,7}, {10,12,7}, {11,12,7}, {12,12,7}, {13,12,7}, {14,12,7}, {15,12,7},
+    {0,13,7}, {1,13,7}, {2,13,7}, {3,13,7}, {4,13,7}, {5,13,7}, {6,13,7}, {7,13,7},
+    {8,13,7}, {9,13,7}, {10,13,7}, {11,13,7}, {12,13,7}, {13,13,7}, {14,13,7}, {15,13,7},
+    {0,14,7}, {1,14,7}, {2,14,7}, {3,14,7}, {4,14,7}, {5,14,7}, {6,14,7}, {7,14,7},
+    {8,14,7}, {9,14,7}, {10,14,7}, {11,14,7}, {12,14,7}, {13,14,7}, {14,14,7}, {15,14,7},
+    {0,15,7}, {1,15,7}, {2,15,7}, {3,15,7}, {4,15,7}, {5,15,7}, {6,15,7}, {7,15,7},
+    {8,15,7}, {9,15,7}, {10,15,7}, {11,15,7}, {12,15,7}, {13,15,7}, {14,15,7}, {15,15,7},
+    {0,0,8}, {1,0,8}, {2,0,8}, {3,0,8}, {4,0,8}, {5,0,8}, {6,0,8}, {7,0,8},
+    {8,0,8}, {9,0,8}, {10,0,8}, {11,0,8}, {12,0,8}, {13,0,8}, {14,0,8}, {15,0,8},
+    {0,1,8}, {1,1,8}, {2,1,8}, {3,1,8}, {4,1,8}, {5,1,8}, {6,1,8}, {7,1,8},
+    {8,1,8}, {9,1,8}, {10,1,8}, {11,1,8}, {12,1,8}, {13,1,8}, {14,1,8}, {15,1,8},
+    {0,2,8}, {1,2,8}, {2,2,8}, {3,2,8}, {4,2,8}, {5,2,8}, {6,2,8}, {7,2,8},
+    {8,2,8}, {9,2,8}, {10,2,8}, {11,2,8}, {12,2,8}, {13,2,8}, {14,2,8}, {15,2,8},
+    {0,3,8}, {1,3,8}, {2,3,8}, {3,3,8}, {4,3,8}, {5,3,8}, {6,3,8}, {7,3,8},
+    {8,3,8}, {9,3,8}, {10,3,8}, {11,3,8}, {12,3,8}, {13,3,8}, {14,3,8}, {15,3,8},
+    {0,4,8}, {1,4,8}, {2,4,8}, {3,4,8}, {4,4,8}, {5,4,8}, {6,4,8}, {7,4,8},
+    {8,4,8}, {9,4,8}, {10,4,8}, {11,4,8}, {12,4,8}, {13,4,8}, {14,4,8}, {15,4,8},
+    {0,5,8}, {1,5,8}, {2,5,8}, {3,5,8}, {4,5,8}, {5,5,8}, {6,5,8}, {7,5,8},
+    {8,5,8}, {9,5,8}, {10,5,8}, {11,5,8}, {12,5,8}, {13,5,8}, {14,5,8}, {15,5,8},
+    {0,6,8}, {1,6,8}, {2,6,8}, {3,6,8}, {4,6,8}, {5,6,8}, {6,6,8}, {7,6,8},
+    {8,6,8}, {9,6,8}, {10,6,8}, {11,6,8}, {12,6,8}, {13,6,8}, {14,6,8}, {15,6,8},
+    {0,7,8}, {1,7,8}, {2,7,8}, {3,7,8}, {4,7,8}, {5,7,8}, {6,7,8}, {7,7,8},
+    {8,7,8}, {9,7,8}, {10,7,8}, {11,7,8}, {12,7,8}, {13,7,8}, {14,7,8}, {15,7,8},
+    {0,8,8}, {1,8,8}, {2,8,8}, {3,8,8}, {4,8,8}, {5,8,8}, {6,8,8}, {7,8,8},
+    {8,8,8}, {9,8,8}, {10,8,8}, {11,8,8}, {12,8,8}, {13,8,8}, {14,8,8}, {15,8,8},
+    {0,9,8}, {1,9,8}, {2,9,8}, {3,9,8}, {4,9,8}, {5,9,8}, {6,9,8}, {7,9,8},
+    {8,9,8}, {9,9,8}, {10,9,8}, {11,9,8}, {12,9,8}, {13,9,8}, {14,9,8}, {15,9,8},
+    {0,10,8}, {1,10,8}, {2,10,8}, {3,10,8}, {4,10,8}, {5,10,8}, {6,10,8}, {7,10,8},
+    {8,10,8}, {9,10,8}, {10,10,8}, {11,10,8}, {12,10,8}, {13,10,8}, {14,10,8}, {15,10,8},
+    {0,11,8}, {1,11,8}, {2,11,8}, {3,11,8}, {4,11,8}, {5,11,8}, {6,11,8}, {7,11,8},
+    {8,11,8}, {9,11,8}, {10,11,8}, {11,11,8}, {12,11,8}, {13,11,8}, {14,11,8}, {15,11,8},
+    {0,12,8}, {1,12,8}, {2,12,8}, {3,12,8}, {4,12,8}, {5,12,8}, {6,12,8}, {7,12,8},
+    {8,12,8}, {9,12,8}, {10,12,8}, {11,12,8}, {12,12,8}, {13,12,8}, {14,12,8}, {15,12,8},
+    {0,13,8}, {1,13,8}, {2,13,8}, {3,13,8}, {4,13,8}, {5,13,8}, {6,13,8}, {7,13,8},
+    {8,13,8}, {9,13,8}, {10,13,8}, {11,13,8}, {12,13,8}, {13,13,8}, {14,13,8}, {15,13,8},
+    {0,14,8}, {1,14,8}, {2,14,8}, {3,14,8}, {4,14,8}, {5,14,8}, {6,14,8}, {7,14,8},
+    {8,14,8}, {9,14,8}, {10,14,8}, {11,14,8}, {12,14,8}, {13,14,8}, {14,14,8}, {15,14,8},
+    {0,15,8}, {1,15,8}, {2,15,8}, {3,15,8}, {4,15,8}, {5,15,8}, {6,15,8}, {7,15,8},
+    {8,15,8}, {9,15,8}, {10,15,8}, {11,15,8}, {12,15,8}, {13,15,8}, {14,15,8}, {15,15,8},
+    {0,0,9}, {1,0,9}, {2,0,9}, {3,0,9}, {4,0,9}, {5,0,9}, {6,0,9}, {7,0,9},
+    {8,0,9}, {9,0,9}, {10,0,9}, {11,0,9}, {12,0,9}, {13,0,9}, {14,0,9}, {15,0,9},
+    {0,1,9}, {1,1,9}, {2,1,9}, {3,1,9}, {4,1,9}, {5,1,9}, {6,1,9}, {7,1,9},
+    {8,1,9}, {9,1,9}, {10,1,9}, {11,1,9}, {12,1,9}, {13,1,9}, {14,1,9}, {15,1,9},
+    {0,2,9}, {1,2,9}, {2,2,9}, {3,2,9}, {4,2,9}, {5,2,9}, {6,2,9}, {7,2,9},
+    {8,2,9}, {9,2,9}, {10,2,9}, {11,2,9}, {12,2,9}, {13,2,9}, {14,2,9}, {15,2,9},
+    {0,3,9}, {1,3,9}, {2,3,9}, {3,3,9}, {4,3,9}, {5,3,9}, {6,3,9}, {7,3,9},
+    {8,3,9}, {9,3,9}, {10,3,9}, {11,3,9}, {12,3,9}, {13,3,9}, {14,3,9}, {15,3,9},
+    {0,4,9}, {1,4,9}, {2,4,9}, {3,4,9}, {4,4,9}, {5,4,9}, {6,4,9}, {7,4,9},
+    {8,4,9}, {9,4,9}, {10,4,9}, {11,4,9}, {12,4,9}, {13,4,9}, {14,4,9}, {15,4,9},
+    {0,5,9}, {1,5,9}, {2,5,9}, {3,5,9}, {4,5,9}, {5,5,9}, {6,5,9}, {7,5,9},
+    {8,5,9}, {9,5,9}, {10,5,9}, {11,5,9}, {12,5,9}, {13,5,9}, {14,5,9}, {15,5,9},
+    {0,6,9}, {1,6,9}, {2,6,9}, {3,6,9}, {4,6,9}, {5,6,9}, {6,6,9}, {7,6,9},
+    {8,6,9}, {9,6,9}, {10,6,9}, {11,6,9}, {12,6,9}, {13,6,9}, {14,6,9}, {15,6,9},
+    {0,7,9}, {1,7,9}, {2,7,9}, {3,7,9}, {4,7,9}, {5,7,9}, {6,7,9}, {7,7,9},
+    {8,7,9}, {9,7,9}, {10,7,9}, {11,7,9}, {12,7,9}, {13,7,9}, {14,7,9}, {15,7,9},
+    {0,8,9}, {1,8,9}, {2,8,9}, {3,8,9}, {4,8,9}, {5,8,9}, {6,8,9}, {7,8,9},
+    {8,8,9}, {9,8,9}, {10,8,9}, {11,8,9}, {12,8,9}, {13,8,9}, {14,8,9}, {15,8,9},
+    {0,9,9}, {1,9,9}, {2,9,9}, {3,9,9}, {4,9,9}, {5,9,9}, {6,9,9}, {7,9,9},
+    {8,9,9}, {9,9,9}, {10,9,9}, {11,9,9}, {12,9,9}, {13,9,9}, {14,9,9}, {15,9,9},
+    {0,10,9}, {1,10,9}, {2,10,9}, {3,10,9}, {4,10,9}, {5,10,9}, {6,10,9}, {7,10,9},
+    {8,10,9}, {9,10,9}, {10,10,9}, {11,10,9}, {12,10,9}, {13,10,9}, {14,10,9}, {15,10,9},
+    {0,11,9}, {1,11,9}, {2,11,9}, {3,11,9}, {4,11,9}, {5,11,9}, {6,11,9}, {7,11,9},
+    {8,11,9}, {9,11,9}, {10,11,9}, {11,11,9}, {12,11,9}, {13,11,9}, {14,11,9}, {15,11,9},
+    {0,12,9}, {1,12,9}, {2,12,9}, {3,12,9}, {4,12,9}, {5,12,9}, {6,12,9}, {7,12,9},
+    {8,12,9}, {9,12,9}, {10,12,9}, {11,12,9}, {12,12,9}, {13,12,9}, {14,12,9}, {15,12,9},
+    {0,13,9}, {1,13,9}, {2,13,9}, {3,13,9}, {4,13,9}, {5,13,9}, {6,13,9}, {7,13,9},
+    {8,13,9}, {9,13,9}, {10,13,9}, {11,13,9}, {12,13,9}, {13,13,9}, {14,13,9}, {15,13,9},
+    {0,14,9}, {1,14,9}, {2,14,9}, {3,14,9}, {4,14,9}, {5,14,9}, {6,14,9}, {7,14,9},
+    {8,14,9}, {9,14,9}, {10,14,9}, {11,14,9}, {12,14,9}, {13,14,9}, {14,14,9}, {15,14,9},
+    {0,15,9}, {1,15,9}, {2,15,9}, {3,15,9}, {4,15,9}, {5,15,9}, {6,15,9}, {7,15,9},
+    {8,15,9}, {9,15,9}, {10,15,9}, {11,15,9}, {12,15,9}, {13,15,9}, {14,15,9}, {15,15,9},
+    {0,0,10}, {1,0,10}, {2,0,10}, {3,0,10}, {4,0,10}, {5,0,10}, {6,0,10}, {7,0,10},
+    {8,0,10}, {9,0,10}, {10,0,10}, {11,0,10}, {12,0,10}, {13,0,10}, {14,0,10}, {15,0,10},
+    {0,1,10}, {1,1,10}, {2,1,10}, {3,1,10}, {4,1,10}, {5,1,10}, {6,1,10}, {7,1,10},
+    {8,1,10}, {9,1,10}, {10,1,10}, {11,1,10}, {12,1,10}, {13,1,10}, {14,1,10}, {15,1,10},
+    {0,2,10}, {1,2,10}, {2,2,10}, {3,2,10}, {4,2,10}, {5,2,10}, {6,2,10}, {7,2,10},
+    {8,2,10}, {9,2,10}, {10,2,10}, {11,2,10}, {12,2,10}, {13,2,10}, {14,2,10}, {15,2,10},
+    {0,3,10}, {1,3,10}, {2,3,10}, {3,3,10}, {4,3,10}, {5,3,10}, {6,3,10}, {7,3,10},
+    {8,3,10}, {9,3,10}, {10,3,10}, {11,3,10}, {12,3,10}, {13,3,10}, {14,3,10}, {15,3,10},
+    {0,4,10}, {1,4,10}, {2,4,10}, {3,4,10}, {4,4,10}, {5,4,10}, {6,4,10}, {7,4,10},
+    {8,4,10}, {9,4,10}, {10,4,10}, {11,4,10}, {12,4,10}, {13,4,10}, {14,4,10}, {15,4,10},
+    {0,5,10}, {1,5,10}, {2,5,10}, {3,5,10}, {4,5,10}, {5,5,10}, {6,5,10}, {7,5,10},
+    {8,5,10}, {9,5,10}, {10,5,10}, {11,5,10}, {12,5,10}, {13,5,10}, {14,5,10}, {15,5,10},
+    {0,6,10}, {1,6,10}, {2,6,10}, {3,6,10}, {4,6,10}, {5,6,10}, {6,6,10}, {7,6,10},
+    {8,6,10}, {9,6,10}, {10,6,10}, {11,6,10}, {12,6,10}, {13,6,10}, {14,6,10}, {15,6,10},
+    {0,7,10}, {1,7,10}, {2,7,10}, {3,7,10}, {4,7,10}, {5,7,10}, {6,7,10}, {7,7,10},
+    {8,7,10}, {9,7,10}, {10,7,10}, {11,7,10}, {12,7,10}, {13,7,10}, {14,7,10}, {15,7,10},
+    {0,8,10}, {1,8,10}, {2,8,10}, {3,8,10}, {4,8,10}, {5,8,10}, {6,8,10}, {7,8,10},
+    {8,8,10}, {9,8,10}, {10,8,10}, {11,8,10}, {12,8,10}, {13,8,10}, {14,8,10}, {15,8,10},
+    {0,9,10}, {1,9,10}, {2,9,10}, {3,9,10}, {4,9,10}, {5,9,10}, {6,9,10}, {7,9,10},
+    {8,9,10}, {9,9,10}, {10,9,10}, {11,9,10}, {12,9,10}, {13,9,10}, {14,9,10}, {15,9,10},
+    {0,10,10}, {1,10,10}, {2,10,10}, {3,10,10}, {4,10,10}, {5,10,10}, {6,10,10}, {7,10,10},
+    {8,10,10}, {9,10,10}, {10,10,10}, {11,10,10}, {12,10,10}, {13,10,10}, {14,10,10}, {15,10,10},
+    {0,11,10}, {1,11,10}, {2,11,10}, {3,11,10}, {4,11,10}, {5,11,10}, {6,11,10}, {7,11,10},
+    {8,11,10}, {9,11,10}, {10,11,10}, {11,11,10}, {12,11,10}, {13,11,10}, {14,11,10}, {15,11,10},
+    {0,12,10}, {1,12,10}, {2,12,10}, {3,12,10}, {4,12,10}, {5,12,10}, {6,12,10}, {7,12,10},
+    {8,12,10}, {9,12,10}, {10,12,10}, {11,12,10}, {12,12,10}, {13,12,10}, {14,12,10}, {15,12,10},
+    {0,13,10}, {1,13,10}, {2,13,10}, {3,13,10}, {4,13,10}, {5,13,10}, {6,13,10}, {7,13,10},
+    {8,13,10}, {9,13,10}, {10,13,10}, {11,13,10}, {12,13,10}, {13,13,10}, {14,13,10}, {15,13,10},
+    {0,14,10}, {1,14,10}, {2,14,10}, {3,14,10}, {4,14,10}, {5,14,10}, {6,14,10}, {7,14,10},
+    {8,14,10}, {9,14,10}, {10,14,10}, {11,14,10}, {12,14,10}, {13,14,10}, {14,14,10}, {15,14,10},
+    {0,15,10}, {1,15,10}, {2,15,10}, {3,15,10}, {4,15,10}, {5,15,10}, {6,15,10}, {7,15,10},
+    {8,15,10}, {9,15,10}, {10,15,10}, {11,15,10}, {12,15,10}, {13,15,10}, {14,15,10}, {15,15,10},
+    {0,0,11}, {1,0,11}, {2,0,11}, {3,0,11}, {4,0,11}, {5,0,11}, {6,0,11}, {7,0,11},
+    {8,0,11}, {9,0,11}, {10,0,11}, {11,0,11}, {12,0,11}, {13,0,11}, {14,0,11}, {15,0,11},
+    {0,1,11}, {1,1,11}, {2,1,11}, {3,1,11}, {4,1,11}, {5,1,11}, {6,1,11}, {7,1,11},
+    {8,1,11}, {9,1,11}, {10,1,11}, {11,1,11}, {12,1,11}, {13,1,11}, {14,1,11}, {15,1,11},
+    {0,2,11}, {1,2,11}, {2,2,11}, {3,2,11}, {4,2,11}, {5,2,11}, {6,2,11}, {7,2,11},
+    {8,2,11}, {9,2,11}, {10,2,11}, {11,2,11}, {12,2,11}, {13,2,11}, {14,2,11}, {15,2,11},
+    {0,3,11}, {1,3,11}, {2,3,11}, {3,3,11}, {4,3,11}, {5,3,11}, {6,3,11}, {7,3,11},
+    {8,3,11}, {9,3,11}, {10,3,11}, {11,3,11}, {12,3,11}, {13,3,11}, {14,3,11}, {15,3,11},
+    {0,4,11}, {1,4,11}, {2,4,11}, {3,4,11}, {4,4,11}, {5,4,11}, {6,4,11}, {7,4,11},
+    {8,4,11}, {9,4,11}, {10,4,11}, {11,4,11}, {12,4,11}, {13,4,11}, {14,4,11}, {15,4,11},
+    {0,5,11}, {1,5,11}, {2,5,11}, {3,5,11}, {4,5,11}, {5,5,11}, {6,5,11}, {7,5,11},
+    {8,5,11}, {9,5,11}, {10,5,11}, {11,5,11}, {12,5,11}, {13,5,11}, {14,5,11}, {15,5,11},
+    {0,6,11}, {1,6,11}, {2,6,11}, {3,6,11}, {4,6,11}, {5,6,11}, {6,6,11}, {7,6,11},
+    {8,6,11}, {9,6,11}, {10,6,11}, {11,6,11}, {12,6,11}, {13,6,11}, {14,6,11}, {15,6,11},
+    {0,7,11}, {1,7,11}, {2,7,11}, {3,7,11}, {4,7,11}, {5,7,11}, {6,7,11}, {7,7,11},
+    {8,7,11}, {9,7,11}, {10,7,11}, {11,7,11}, {12,7,11}, {13,7,11}, {14,7,11}, {15,7,11},
+    {0,8,11}, {1,8,11}, {2,8,11}, {3,8,11}, {4,8,11}, {5,8,11}, {6,8,11}, {7,8,11},
+    {8,8,11}, {9,8,11}, {10,8,11}, {11,8,11}, {12,8,11}, {13,8,11}, {14,8,11}, {15,8,11},
+    {0,9,11}, {1,9,11}, {2,9,11}, {3,9,11}, {4,9,11}, {5,9,11}, {6,9,11}, {7,9,11},
+    {8,9,11}, {9,9,11}, {10,9,11}, {11,9,11}, {12,9,11}, {13,9,11}, {14,9,11}, {15,9,11},
+    {0,10,11}, {1,10,11}, {2,10,11}, {3,10,11}, {4,10,11}, {5,10,11}, {6,10,11}, {7,10,11},
+    {8,10,11}, {9,10,11}, {10,10,11}, {11,10,11}, {12,10,11}, {13,10,11}, {14,10,11}, {15,10,11},
+    {0,11,11}, {1,11,11}, {2,11,11}, {3,11,11}, {4,11,11}, {5,11,11}, {6,11,11}, {7,11,11},
+    {8,11,11}, {9,11,11}, {10,11,11}, {11,11,11}, {12,11,11}, {13,11,11}, {14,11,11}, {15,11,11},
+    {0,12,11}, {1,12,11}, {2,12,11}, {3,12,11}, {4,12,11}, {5,12,11}, {6,12,11}, {7,12,11},
+    {8,12,11}, {9,12,11}, {10,12,11}, {11,12,11}, {12,12,11}, {13,12,11}, {14,12,11}, {15,12,11},
+    {0,13,11}, {1,13,11}, {2,13,11}, {3,13,11}, {4,13,11}, {5,13,11}, {6,13,11}, {7,13,11},
+    {8,13,11}, {9,13,11}, {10,13,11}, {11,13,11}, {12,13,11}, {13,13,11}, {14,13,11}, {15,13,11},
+    {0,14,11}, {1,14,11}, {2,14,11}, {3,14,11}, {4,14,11}, {5,14,11}, {6,14,11}, {7,14,11},
+    {8,14,11}, {9,14,11}, {10,14,11}, {11,14,11}, {12,14,11}, {13,14,11}, {14,14,11}, {15,14,11},
+    {0,15,11}, {1,15,11}, {2,15,11}, {3,15,11}, {4,15,11}, {5,15,11}, {6,15,11}, {7,15,11},
+    {8,15,11}, {9,15,11}, {10,15,11}, {11,15,11}, {12,15,11}, {13,15,11}, {14,15,11}, {15,15,11},
+    {0,0,12}, {1,0,12}, {2,0,12}, {3,0,12}, {4,0,12}, {5,0,12}, {6,0,12}, {7,0,12},
+    {8,0,12}, {9,0,12}, {10,0,12}, {11,0,12}, {12,0,12}, {13,0,12}, {14,0,12}, {15,0,12},
+    {0,1,12}, {1,1,12}, {2,1,12}, {3,1,12}, {4,1,12}, {5,1,12}, {6,1,12}, {7,1,12},
+    {8,1,12}, {9,1,12}, {10,1,12}, {11,1,12}, {12,1,12}, {13,1,12}, {14,1,12}, {15,1,12},
+    {0,2,12}, {1,2,12}, {2,2,12}, {3,2,12}, {4,2,12}, {5,2,12}, {6,2,12}, {7,2,12},
+    {8,2,12}, {9,2,12}, {10,2,12}, {11,2,12}, {12,2,12}, {13,2,12}, {14,2,12}, {15,2,12},
+    {0,3,12}, {1,3,12}, {2,3,12}, {3,3,12}, {4,3,12}, {5,3,12}, {6,3,12}, {7,3,12},
+    {8,3,12}, {9,3,12}, {10,3,12}, {11,3,12}, {12,3,12}, {13,3,12}, {14,3,12}, {15,3,12},
+    {0,4,12}, {1,4,12}, {2,4,12}, {3,4,12}, {4,4,12}, {5,4,12}, {6,4,12}, {7,4,12},
+    {8,4,12}, {9,4,12}, {10,4,12}, {11,4,12}, {12,4,12}, {13,4,12}, {14,4,12}, {15,4,12},
+    {0,5,12}, {1,5,12}, {2,5,12}, {3,5,12}, {4,5,12}, {5,5,12}, {6,5,12}, {7,5,12},
+    {8,5,12}, {9,5,12}, {10,5,12}, {11,5,12}, {12,5,12}, {13,5,12}, {14,5,12}, {15,5,12},
+    {0,6,12}, {1,6,12}, {2,6,12}, {3,6,12}, {4,6,12}, {5,6,12}, {6,6,12}, {7,6,12},
+    {8,6,12}, {9,6,12}, {10,6,12}, {11,6,12}, {12,6,12}, {13,6,12}, {14,6,12}, {15,6,12},
+    {0,7,12}, {1,7,12}, {2,7,12}, {3,7,12}, {4,7,12}, {5,7,12}, {6,7,12}, {7,7,12},
+    {8,7,12}, {9,7,12}, {10,7,12}, {11,7,12}, {12,7,12}, {13,7,12}, {14,7,12}, {15,7,12},
+    {0,8,12}, {1,8,12}, {2,8,12}, {3,8,12}, {4,8,12}, {5,8,12}, {6,8,12}, {7,8,12},
+    {8,8,12}, {9,8,12}, {10,8,12}, {11,8,12}, {12,8,12}, {13,8,12}, {14,8,12}, {15,8,12},
+    {0,9,12}, {1,9,12}, {2,9,12}, {3,9,12}, {4,9,12}, {5,9,12}, {6,9,12}, {7,9,12},
+    {8,9,12}, {9,9,12}, {10,9,12}, {11,9,12}, {12,9,12}, {13,9,12}, {14,9,12}, {15,9,12},
+    {0,10,12}, {1,10,12}, {2,10,12}, {3,10,12}, {4,10,12}, {5,10,12}, {6,10,12}, {7,10,12},
+    {8,10,12}, {9,10,12}, {10,10,12}, {11,10,12}, {12,10,12}, {13,10,12}, {14,10,12}, {15,10,12},
+    {0,11,12}, {1,11,12}, {2,11,12}, {3,11,12}, {4,11,12}, {5,11,12}, {6,11,12}, {7,11,12},
+    {8,11,12}, {9,11,12}, {10,11,12}, {11,11,12}, {12,11,12}, {13,11,12}, {14,11,12}, {15,11,12},
+    {0,12,12}, {1,12,12}, {2,12,12}, {3,12,12}, {4,12,12}, {5,12,12}, {6,12,12}, {7,12,12},
+    {8,12,12}, {9,12,12}, {10,12,12}, {11,12,12}, {12,12,12}, {13,12,12}, {14,12,12}, {15,12,12},
+    {0,13,12}, {1,13,12}, {2,13,12}, {3,13,12}, {4,13,12}, {5,13,12}, {6,13,12}, {7,13,12},
+    {8,13,12}, {9,13,12}, {10,13,12}, {11,13,12}, {12,13,12}, {13,13,12}, {14,13,12}, {15,13,12},
+    {0,14,12}, {1,14,12}, {2,14,12}, {3,14,12}, {4,14,12}, {5,14,12}, {6,14,12}, {7,14,12},
+    {8,14,12}, {9,14,12}, {10,14,12}, {11,14,12}, {12,14,12}, {13,14,12}, {14,14,12}, {15,14,12},
+    {0,15,12}, {1,15,12}, {2,15,12}, {3,15,12}, {4,15,12}, {5,15,12}, {6,15,12}, {7,15,12},
+    {8,15,12}, {9,15,12}, {10,15,12}, {11,15,12}, {12,15,12}, {13,15,12}, {14,15,12}, {15,15,12},
+    {0,0,13}, {1,0,13}, {2,0,13}, {3,0,13}, {4,0,13}, {5,0,13}, {6,0,13}, {7,0,13},
+    {8,0,13}, {9,0,13}, {10,0,13}, {11,0,13}, {12,0,13}, {13,0,13}, {14,0,13}, {15,0,13},
+    {0,1,13}, {1,1,13}, {2,1,13}, {3,1,13}, {4,1,13}, {5,1,13}, {6,1,13}, {7,1,13},
+    {8,1,13}, {9,1,13}, {10,1,13}, {11,1,13}, {12,1,13}, {13,1,13}, {14,1,13}, {15,1,13},
+    {0,2,13}, {1,2,13}, {2,2,13}, {3,2,13}, {4,2,13}, {5,2,13}, {6,2,13}, {7,2,13},
+    {8,2,13}, {9,2,13}, {10,2,13}, {11,2,13}, {12,2,13}, {13,2,13}, {14,2,13}, {15,2,13},
+    {0,3,13}, {1,3,13}, {2,3,13}, {3,3,13}, {4,3,13}, {5,3,13}, {6,3,13}, {7,3,13},
+    {8,3,13}, {9,3,13}, {10,3,13}, {11,3,13}, {12,3,13}, {13,3,13}, {14,3,13}, {15,3,13},
+    {0,4,13}, {1,4,13}, {2,4,13}, {3,4,13}, {4,4,13}, {5,4,13}, {6,4,13}, {7,4,13},
+    {8,4,13}, {9,4,13}, {10,4,13}, {11,4,13}, {12,4,13}, {13,4,13}, {14,4,13}, {15,4,13},
+    {0,5,13}, {1,5,13}, {2,5,13}, {3,5,13}, {4,5,13}, {5,5,13}, {6,5,13}, {7,5,13},
+    {8,5,13}, {9,5,13}, {10,5,13}, {11,5,13}, {12,5,13}, {13,5,13}, {14,5,13}, {15,5,13},
+    {0,6,13}, {1,6,13}, {2,6,13}, {3,6,13}, {4,6,13}, {5,6,13}, {6,6,13}, {7,6,13},
+    {8,6,13}, {9,6,13}, {10,6,13}, {11,6,13}, {12,6,13}, {13,6,13}, {14,6,13}, {15,6,13},
+    {0,7,13}, {1,7,13}, {2,7,13}, {3,7,13}, {4,7,13}, {5,7,13}, {6,7,13}, {7,7,13},
+    {8,7,13}, {9,7,13}, {10,7,13}, {11,7,13}, {12,7,13}, {13,7,13}, {14,7,13}, {15,7,13},
+    {0,8,13}, {1,8,13}, {2,8,13}, {3,8,13}, {4,8,13}, {5,8,13}, {6,8,13}, {7,8,13},
+    {8,8,13}, {9,8,13}, {10,8,13}, {11,8,13}, {12,8,13}, {13,8,13}, {14,8,13}, {15,8,13},
+    {0,9,13}, {1,9,13}, {2,9,13}, {3,9,13}, {4,9,13}, {5,9,13}, {6,9,13}, {7,9,13},
+    {8,9,13}, {9,9,13}, {10,9,13}, {11,9,13}, {12,9,13}, {13,9,13}, {14,9,13}, {15,9,13},
+    {0,10,13}, {1,10,13}, {2,10,13}, {3,10,13}, {4,10,13}, {5,10,13}, {6,10,13}, {7,10,13},
+    {8,10,13}, {9,10,13}, {10,10,13}, {11,10,13}, {12,10,13}, {13,10,13}, {14,10,13}, {15,10,13},
+    {0,11,13}, {1,11,13}, {2,11,13}, {3,11,13}, {4,11,13}, {5,11,13}, {6,11,13}, {7,11,13},
+    {8,11,13}, {9,11,13}, {10,11,13}, {11,11,13}, {12,11,13}, {13,11,13}, {14,11,13}, {15,11,13},
+    {0,12,13}, {1,12,13}, {2,12,13}, {3,12,13}, {4,12,13}, {5,12,13}, {6,12,13}, {7,12,13},
+    {8,12,13}, {9,12,13}, {10,12,13}, {11,12,13}, {12,12,13}, {13,12,13}, {14,12,13}, {15,12,13},
+    {0,13,13}, {1,13,13}, {2,13,13}, {3,13,13}, {4,13,13}, {5,13,13}, {6,13,13}, {7,13,13},
+    {8,13,13}, {9,13,13}, {10,13,13}, {11,13,13}, {12,13,13}, {13,13,13}, {14,13,13}, {15,13,13},
+    {0,14,13}, {1,14,13}, {2,14,13}, {3,14,13}, {4,14,13}, {5,14,13}, {6,14,13}, {7,14,13},
+    {8,14,13}, {9,14,13}, {10,14,13}, {11,14,13}, {12,14,13}, {13,14,13}, {14,14,13}, {15,14,13},
+    {0,15,13}, {1,15,13}, {2,15,13}, {3,15,13}, {4,15,13}, {5,15,13}, {6,15,13}, {7,15,13},
+    {8,15,13}, {9,15,13}, {10,15,13}, {11,15,13}, {12,15,13}, {13,15,13}, {14,15,13}, {15,15,13},
+    {0,0,14}, {1,0,14}, {2,0,14}, {3,0,14}, {4,0,14}, {5,0,14}, {6,0,14}, {7,0,14},
+    {8,0,14}, {9,0,14}, {10,0,14}, {11,0,14}, {12,0,14}, {13,0,14}, {14,0,14}, {15,0,14},
+    {0,1,14}, {1,1,14}, {2,1,14}, {3,1,14}, {4,1,14}, {5,1,14}, {6,1,14}, {7,1,14},
+    {8,1,14}, {9,1,14}, {10,1,14}, {11,1,14}, {12,1,14}, {13,1,14}, {14,1,14}, {15,1,14},
+    {0,2,14}, {1,2,14}, {2,2,14}, {3,2,14}, {4,2,14}, {5,2,14}, {6,2,14}, {7,2,14},
+    {8,2,14}, {9,2,14}, {10,2,14}, {11,2,14}, {12,2,14}, {13,2,14}, {14,2,14}, {15,2,14},
+    {0,3,14}, {1,3,14}, {2,3,14}, {3,3,14}, {4,3,14}, {5,3,14}, {6,3,14}, {7,3,14},
+    {8,3,14}, {9,3,14}, {10,3,14}, {11,3,14}, {12,3,14}, {13,3,14}, {14,3,14}, {15,3,14},
+    {0,4,14}, {1,4,14}, {2,4,14}, {3,4,14}, {4,4,14}, {5,4,14}, {6,4,14}, {7,4,14},
+    {8,4,14}, {9,4,14}, {10,4,14}, {11,4,14}, {12,4,14}, {13,4,14}, {14,4,14}, {15,4,14},
+    {0,5,14}, {1,5,14}, {2,5,14}, {3,5,14}, {4,5,14}, {5,5,14}, {6,5,14}, {7,5,14},
+    {8,5,14}, {9,5,14}, {10,5,14}, {11,5,14}, {12,5,14}, {13,5,14}, {14,5,14}, {15,5,14},
+    {0,6,14}, {1,6,14}, {2,6,14}, {3,6,14}, {4,6,14}, {5,6,14}, {6,6,14}, {7,6,14},
+    {8,6,14}, {9,6,14}, {10,6,14}, {11,6,14}, {12,6,14}, {13,6,14}, {14,6,14}, {15,6,14},
+    {0,7,14}, {1,7,14}, {2,7,14}, {3,7,14}, {4,7,14}, {5,7,14}, {6,7,14}, {7,7,14},
+    {8,7,14}, {9,7,14}, {10,7,14}, {11,7,14}, {12,7,14}, {13,7,14}, {14,7,14}, {15,7,14},
+    {0,8,14}, {1,8,14}, {2,8,14}, {3,8,14}, {4,8,14}, {5,8,14}, {6,8,14}, {7,8,14},
+    {8,8,14}, {9,8,14}, {10,8,14}, {11,8,14}, {12,8,14}, {13,8,14}, {14,8,14}, {15,8,14},
+    {0,9,14}, {1,9,14}, {2,9,14}, {3,9,14}, {4,9,14}, {5,9,14}, {6,9,14}, {7,9,14},
+    {8,9,14}, {9,9,14}, {10,9,14}, {11,9,14}, {12,9,14}, {13,9,14}, {14,9,14}, {15,9,14},
+    {0,10,14}, {1,10,14}, {2,10,14}, {3,10,14}, {4,10,14}, {5,10,14}, {6,10,14}, {7,10,14},
+    {8,10,14}, {9,10,14}, {10,10,14}, {11,10,14}, {12,10,14}, {13,10,14}, {14,10,14}, {15,10,14},
+    {0,11,14}, {1,11,14}, {2,11,14}, {3,11,14}, {4,11,14}, {5,11,14}, {6,11,14}, {7,11,14},
+    {8,11,14}, {9,11,14}, {10,11,14}, {11,11,14}, {12,11,14}, {13,11,14}, {14,11,14}, {15,11,14},
+    {0,12,14}, {1,12,14}, {2,12,14}, {3,12,14}, {4,12,14}, {5,12,14}, {6,12,14}, {7,12,14},
+    {8,12,14}, {9,12,14}, {10,12,14}, {11,12,14}, {12,12,14}, {13,12,14}, {14,12,14}, {15,12,14},
+    {0,13,14}, {1,13,14}, {2,13,14}, {3,13,14}, {4,13,14}, {5,13,14}, {6,13,14}, {7,13,14},
+    {8,13,14}, {9,13,14}, {10,13,14}, {11,13,14}, {12,13,14}, {13,13,14}, {14,13,14}, {15,13,14},
+    {0,14,14}, {1,14,14}, {2,14,14}, {3,14,14}, {4,14,14}, {5,14,14}, {6,14,14}, {7,14,14},
+    {8,14,14}, {9,14,14}, {10,14,14}, {11,14,14}, {12,14,14}, {13,14,14}, {14,14,14}, {15,14,14},
+    {0,15,14}, {1,15,14}, {2,15,14}, {3,15,14}, {4,15,14}, {5,15,14}, {6,15,14}, {7,15,14},
+    {8,15,14}, {9,15,14}, {10,15,14}, {11,15,14}, {12,15,14}, {13,15,14}, {14,15,14}, {15,15,14},
+    {0,0,15}, {1,0,15}, {2,0,15}, {3,0,15}, {4,0,15}, {5,0,15}, {6,0,15}, {7,0,15},
+    {8,0,15}, {9,0,15}, {10,0,15}, {11,0,15}, {12,0,15}, {13,0,15}, {14,0,15}, {15,0,15},
+    {0,1,15}, {1,1,15}, {2,1,15}, {3,1,15}, {4,1,15}, {5,1,15}, {6,1,15}, {7,1,15},
+    {8,1,15}, {9,1,15}, {10,1,15}, {11,1,15}, {12,1,15}, {13,1,15}, {14,1,15}, {15,1,15},
+    {0,2,15}, {1,2,15}, {2,2,15}, {3,2,15}, {4,2,15}, {5,2,15}, {6,2,15}, {7,2,15},
+    {8,2,15}, {9,2,15}, {10,2,15}, {11,2,15}, {12,2,15}, {13,2,15}, {14,2,15}, {15,2,15},
+    {0,3,15}, {1,3,15}, {2,3,15}, {3,3,15}, {4,3,15}, {5,3,15}, {6,3,15}, {7,3,15},
+    {8,3,15}, {9,3,15}, {10,3,15}, {11,3,15}, {12,3,15}, {13,3,15}, {14,3,15}, {15,3,15},
+    {0,4,15}, {1,4,15}, {2,4,15}, {3,4,15}, {4,4,15}, {5,4,15}, {6,4,15}, {7,4,15},
+    {8,4,15}, {9,4,15}, {10,4,15}, {11,4,15}, {12,4,15}, {13,4,15}, {14,4,15}, {15,4,15},
+    {0,5,15}, {1,5,15}, {2,5,15}, {3,5,15}, {4,5,15}, {5,5,15}, {6,5,15}, {7,5,15},
+    {8,5,15}, {9,5,15}, {10,5,15}, {11,5,15}, {12,5,15}, {13,5,15}, {14,5,15}, {15,5,15},
+    {0,6,15}, {1,6,15}, {2,6,15}, {3,6,15}, {4,6,15}, {5,6,15}, {6,6,15}, {7,6,15},
+    {8,6,15}, {9,6,15}, {10,6,15}, {11,6,15}, {12,6,15}, {13,6,15}, {14,6,15}, {15,6,15},
+    {0,7,15}, {1,7,15}, {2,7,15}, {3,7,15}, {4,7,15}, {5,7,15}, {6,7,15}, {7,7,15},
+    {8,7,15}, {9,7,15}, {10,7,15}, {11,7,15}, {12,7,15}, {13,7,15}, {14,7,15}, {15,7,15},
+    {0,8,15}, {1,8,15}, {2,8,15}, {3,8,15}, {4,8,15}, {5,8,15}, {6,8,15}, {7,8,15},
+    {8,8,15}, {9,8,15}, {10,8,15}, {11,8,15}, {12,8,15}, {13,8,15}, {14,8,15}, {15,8,15},
+    {0,9,15}, {1,9,15}, {2,9,15}, {3,9,15}, {4,9,15}, {5,9,15}, {6,9,15}, {7,9,15},
+    {8,9,15}, {9,9,15}, {10,9,15}, {11,9,15}, {12,9,15}, {13,9,15}, {14,9,15}, {15,9,15},
+    {0,10,15}, {1,10,15}, {2,10,15}, {3,10,15}, {4,10,15}, {5,10,15}, {6,10,15}, {7,10,15},
+    {8,10,15}, {9,10,15}, {10,10,15}, {11,10,15}, {12,10,15}, {13,10,15}, {14,10,15}, {15,10,15},
+    {0,11,15}, {1,11,15}, {2,11,15}, {3,11,15}, {4,11,15}, {5,11,15}, {6,11,15}, {7,11,15},
+    {8,11,15}, {9,11,15}, {10,11,15}, {11,11,15}, {12,11,15}, {13,11,15}, {14,11,15}, {15,11,15},
+    {0,12,15}, {1,12,15}, {2,12,15}, {3,12,15}, {4,12,15}, {5,12,15}, {6,12,15}, {7,12,15},
+    {8,12,15}, {9,12,15}, {10,12,15}, {11,12,15}, {12,12,15}, {13,12,15}, {14,12,15}, {15,12,15},
+    {0,13,15}, {1,13,15}, {2,13,15}, {3,13,15}, {4,13,15}, {5,13,15}, {6,13,15}, {7,13,15},
+    {8,13,15}, {9,13,15}, {10,13,15}, {11,13,15}, {12,13,15}, {13,13,15}, {14,13,15}, {15,13,15},
+    {0,14,15}, {1,14,15}, {2,14,15}, {3,14,15}, {4,14,15}, {5,14,15}, {6,14,15}, {7,14,15},
+    {8,14,15}, {9,14,15}, {10,14,15}, {11,14,15}, {12,14,15}, {13,14,15}, {14,14,15}, {15,14,15},
+    {0,15,15}, {1,15,15}, {2,15,15}, {3,15,15}, {4,15,15}, {5,15,15}, {6,15,15}, {7,15,15},
+    {8,15,15}, {9,15,15}, {10,15,15}, {11,15,15}, {12,15,15}, {13,15,15}, {14,15,15}, {15,15,15},
+};
+
+static const Grid_Cell grid_neighbors[GRID_CELLS][6] = {
+    {1,15,16,240,256,3840}, {2,0,17,241,257,3841}, {3,1,18,242,258,3842}, {4,2,19,243,259,3843},
+    {5,3,20,244,260,3844}, {6,4,21,245,261,3845}, {7,5,22,246,262,3846}, {8,6,23,247,263,3847},
+    {9,7,24,248,264,3848}, {10,8,25,249,265,3849}, {11,9,26,250,266,3850}, {12,10,27,251,267,3851},
+    {13,11,28,252,268,3852}, {14,12,29,253,269,3853}, {15,13,30,254,270,3854}, {0,14,31,255,271,3855},
+    {17,31,32,0,272,3856}, {18,16,33,1,273,3857}, {19,17,34,2,274,3858}, {20,18,35,3,275,3859},
+    {21,19,36,4,276,3860}, {22,20,37,5,277,3861}, {23,21,38,6,278,3862}, {24,22,39,7,279,3863},
+    {25,23,40,8,280,3864}, {26,24,41,9,281,3865}, {27,25,42,10,282,3866}, {28,26,43,11,283,3867},
+    {29,27,44,12,284,3868}, {30,28,45,13,285,3869}, {31,29,46,14,286,3870}, {16,30,47,15,287,3871},
+    {33,47,48,16,288,3872}, {34,32,49,17,289,3873}, {35,33,50,18,290,3874}, {36,34,51,19,291,3875},
+    {37,35,52,20,292,3876}, {38,36,53,21,293,3877}, {39,37,54,22,294,3878}, {40,38,55,23,295,3879},
+    {41,39,56,24,296,3880}, {42,40,57,25,297,3881}, {43,41,58,26,298,3882}, {44,42,59,27,299,3883},
+    {45,43,60,28,300,3884}, {46,44,61,29,301,3885}, {47,45,62,30,302,3886}, {32,46,63,31,303,3887},
+    {49,63,64,32,304,3888}, {50,48,65,33,305,3889}, {51,49,66,34,306,3890}, {52,50,67,35,307,3891},
+    {53,51,68,36,308,3892}, {54,52,69,37,309,3893}, {55,53,70,38,310,3894}, {56,54,71,39,311,3895},
+    {57,55,72,40,312,3896}, {58,56,73,41,313,3897}, {59,57,74,42,314,3898}, {60,58,75,43,315,3899},
+    {61,59,76,44,316,3900}, {62,60,77,45,317,3901}, {63,61,78,46,318,3902}, {48,62,79,47,319,3903},
+    {65,79,80,48,320,3904}, {66,64,81,49,321,3905}, {67,65,82,50,322,3906}, {68,66,83,51,323,3907},
+    {69,67,84,52,324,3908}, {70,68,85,53,325,3909}, {71,69,86,54,326,3910}, {72,70,87,55,327,3911},
+    {73,71,88,56,328,3912}, {74,72,89,57,329,3913}, {75,73,90,58,330,3914}, {76,74,91,59,331,3915},
+    {77,75,92,60,332,3916}, {78,76,93,61,333,3917}, {79,77,94,62,334,3918}, {64,78,95,63,335,3919},
+    {81,95,96,64,336,3920}, {82,80,97,65,337,3921}, {83,81,98,66,338,3922}, {84,82,99,67,339,3923},
+    {85,83,100,68,340,3924}, {86,84,101,69,341,3925}, {87,85,102,70,342,3926}, {88,86,103,71,343,3927},
+    {89,87,104,72,344,3928}, {90,88,105,73,345,3929}, {91,89,106,74,346,3930}, {92,90,107,75,347,3931},
+    {93,91,108,76,348,3932}, {94,92,109,77,349,3933}, {95,93,110,78,350,3934}, {80,94,111,79,351,3935},
+    {97,111,112,80,352,3936}, {98,96,113,81,353,3937}, {99,97,114,82,354,3938}, {100,98,115,83,355,3939},
+    {101,99,116,84,356,3940}, {102,100,117,85,357,3941}, {103,101,118,86,358,3942}, {104,102,119,87,359,3943},
+    {105,103,120,88,360,3944}, {106,104,121,89,361,3945}, {107,105,122,90,362,3946}, {108,106,123,91,363,3947},
+    {109,107,124,92,364,3948}, {110,108,125,93,365,3949}, {111,109,126,94,366,3950}, {96,110,127,95,367,3951},
+    {113,127,128,96,368,3952}, {114,112,129,97,369,3953}, {115,113,130,98,370,3954}, {116,114,131,99,371,3955},
+    {117,115,132,100,372,3956}, {118,116,133,101,373,3957}, {119,117,134,102,374,3958}, {120,118,135,103,375,3959},
+    {121,119,136,104,376,3960}, {122,120,137,105,377,3961}, {123,121,138,106,378,3962}, {124,122,139,107,379,3963},
+    {125,123,140,108,380,3964}, {126,124,141,109,381,3965}, {127,125,142,110,382,3966}, {112,126,143,111,383,3967},
+    {129,143,144,112,384,3968}, {130,128,145,113,385,3969}, {131,129,146,114,386,3970}, {132,130,147,115,387,3971},
+    {133,131,148,116,388,3972}, {134,132,149,117,389,3973}, {135,133,150,118,390,3974}, {136,134,151,119,391,3975},
+    {137,135,152,120,392,3976}, {138,136,153,121,393,3977}, {139,137,154,122,394,3978}, {140,138,155,123,395,3979},
+    {141,139,156,124,396,3980}, {142,140,157,125,397,3981}, {143,141,158,126,398,3982}, {128,142,159,127,399,3983},
+    {145,159,160,128,400,3984}, {146,144,161,129,401,3985}, {147,145,162,130,402,3986}, {148,146,163,131,403,3987},
+    {149,147,164,132,404,3988}, {150,148,165,133,405,3989}, {151,149,166,134,406,3990}, {152,150,167,135,407,3991},
+    {153,151,168,136,408,3992}, {154,152,169,137,409,3993}, {155,153,170,138,410,3994}, {156,154,171,139,411,3995},
+    {157,155,172,140,412,3996}, {158,156,173,141,413,3997}, {159,157,174,142,414,3998}, {144,158,175,143,415,3999},
+    {161,175,176,144,416,4000}, {162,160,177,145,417,4001}, {163,161,178,146,418,4002}, {164,162,179,147,419,4003},
+    {165,163,180,148,420,4004}, {166,164,181,149,421,4005}, {167,165,182,150,422,4006}, {168,166,183,151,423,4007},
+    {169,167,184,152,424,4008}, {170,168,185,153,425,4009}, {171,169,186,154,426,4010}, {172,170,187,155,427,4011},
+    {173,171,188,156,428,4012}, {174,172,189,157,429,4013}, {175,173,190,158,430,4014}, {160,174,191,159,431,4015},
+    {177,191,192,160,432,4016}, {178,176,193,161,433,4017}, {179,177,194,162,434,4018}, {180,178,195,163,435,4019},
+    {181,179,196,164,436,4020}, {182,180,197,165,437,4021}, {183,181,198,166,438,4022}, {184,182,199,167,439,4023},
+    {185,183,200,168,440,4024}, {186,184,201,169,441,4025}, {187,185,202,170,442,4026}, {188,186,203,171,443,4027},
+    {189,187,204,172,444,4028}, {190,188,205,173,445,4029}, {191,189,206,174,446,4030}, {176,190,207,175,447,4031},
+    {193,207,208,176,448,4032}, {194,192,209,177,449,4033}, {195,193,210,178,450,4034}, {196,194,211,179,451,4035},
+    {197,195,212,180,452,4036}, {198,196,213,181,453,4037}, {199,197,214,182,454,4038}, {200,198,215,183,455,4039},
+    {201,199,216,184,456,4040}, {202,200,217,185,457,4041}, {203,201,218,186,458,4042}, {204,202,219,187,459,4043},
+    {205,203,220,188,460,4044}, {206,204,221,189,461,4045}, {207,205,222,190,462,4046}, {192,206,223,191,463,4047},
+    {209,223,224,192,464,4048}, {210,208,225,193,465,4049}, {211,209,226,194,466,4050}, {212,210,227,195,467,4051},
+    {213,211,228,196,468,4052}, {214,212,229,197,469,4053}, {215,213,230,198,470,4054}, {216,214,231,199,471,4055},
+    {217,215,232,200,472,4056}, {218,216,233,201,473,4057}, {219,217,234,202,474,4058}, {220,218,235,203,475,4059},
+    {221,219,236,204,476,4060}, {222,220,237,205,477,4061}, {223,221,238,206,478,4062}, {208,222,239,207,479,4063},
+    {225,239,240,208,480,4064}, {226,224,241,209,481,4065}, {227,225,242,210,482,4066}, {228,226,243,211,483,4067},
+    {229,227,244,212,484,4068}, {230,228,245,213,485,4069}, {231,229,246,214,486,4070}, {232,230,247,215,487,4071},
+    {233,231,248,216,488,4072}, {234,232,249,217,489,4073}, {235,233,250,218,490,4074}, {236,234,251,219,491,4075},
+    {237,235,252,220,492,4076}, {238,236,253,221,493,4077}, {239,237,254,222,494,4078}, {224,238,255,223,495,4079},
+    {241,255,0,224,496,4080}, {242,240,1,225,497,4081}, {243,241,2,226,498,4082}, {244,242,3,227,499,4083},
+    {245,243,4,228,500,4084}, {246,244,5,229,501,4085}, {247,245,6,230,502,4086}, {248,246,7,231,503,4087},
+    {249,247,8,232,504,4088}, {250,248,9,233,505,4089}, {251,249,10,234,506,4090}, {252,250,11,235,507,4091},
+    {253,251,12,236,508,4092}, {254,252,13,237,509,4093}, {255,253,14,238,510,4094}, {240,254,15,239,511,4095},
+    {257,271,272,496,512,0}, {258,256,273,497,513,1}, {259,257,274,498,514,2}, {260,258,275,499,515,3},
+    {261,259,276,500,516,4}, {262,260,277,501,517,5}, {263,261,278,502,518,6}, {264,262,279,503,519,7},
+    {265,263,280,504,520,8}, {266,264,281,505,521,9}, {267,265,282,506,522,10}, {268,266,283,507,523,11},
+    {269,267,284,508,524,12}, {270,268,285,509,525,13}, {271,269,286,510,526,14}, {256,270,287,511,527,15},
+    {273,287,288,256,528,16}, {274,272,289,257,529,17}, {275,273,290,258,530,18}, {276,274,291,259,531,19},
+    {277,275,292,260,532,20}, {278,276,293,261,533,21}, {279,277,294,262,534,22}, {280,278,295,263,535,23},
+    {281,279,296,264,536,24}, {282,280,297,265,537,25}, {283,281,298,266,538,26}, {284,282,299,267,539,27},
+    {285,283,300,268,540,28}, {286,284,301,269,541,29}, {287,285,302,270,542,30}, {272,286,303,271,543,31},
+    {289,303,304,272,544,32}, {290,288,305,273,545,33}, {291,289,306,274,546,34}, {292,290,307,275,547,35},
+    {293,291,308,276,548,36}, {294,292,309,277,549,37}, {295,293,310,278,550,38}, {296,294,311,279,551,39},
+    {297,295,312,280,552,40}, {298,296,313,281,553,41}, {299,297,314,282,554,42}, {300,298,315,283,555,43},
+    {301,299,316,284,556,44}, {302,300,317,285,557,45}, {303,301,318,286,558,46}, {288,302,319,287,559,47},
+    {305,319,320,288,560,48}, {306,304,321,289,561,49}, {307,305,322,290,562,50}, {308,306,323,291,563,51},
+    {309,307,324,292,564,52}, {310,308,325,293,565,53}, {311,309,326,294,566,54}, {312,310,327,295,567,55},
+    {313,311,328,296,568,56}, {314,312,329,297,569,57}, {315,313,330,298,570,58}, {316,314,331,299,571,59},
+    {317,315,332,300,572,60}, {318,316,333,301,573,61}, {319,317,334,302,574,62}, {304,318,335,303,575,63},
+    {321,335,336,304,576,64}, {322,320,337,305,577,65}, {323,321,338,306,578,66}, {324,322,339,307,579,67},
+    {325,323,340,308,580,68}, {326,324,341,309,581,69}, {327,325,342,310,582,70}, {328,326,343,311,583,71},
+    {329,327,344,312,584,72}, {330,328,345,313,585,73}, {331,329,346,314,586,74}, {332,330,347,315,587,75},
+    {333,331,348,316,588,76}, {334,332,349,317,589,77}, {335,333,350,318,590,78}, {320,334,351,319,591,79},
+    {337,351,352,320,592,80}, {338,336,353,321,593,81}, {339,337,354,322,594,82}, {340,338,355,323,595,83},
+    {341,339,356,324,596,84}, {342,340,357,325,597,85}, {343,341,358,326,598,86}, {344,342,359,327,599,87},
+    {345,343,360,328,600,88}, {346,344,361,329,601,89}, {347,345,362,330,602,90}, {348,346,363,331,603,91},
+    {349,347,364,332,604,92}, {350,348,365,333,605,93}, {351,349,366,334,606,94}, {336,350,367,335,607,95},
+    {353,367,368,336,608,96}, {354,352,369,337,609,97}, {355,353,370,338,610,98}, {356,354,371,339,611,99},
+    {357,355,372,340,612,100}, {358,356,373,341,613,101}, {359,357,374,342,614,102}, {360,358,375,343,615,103},
+    {361,359,376,344,616,104}, {362,360,377,345,617,105}, {363,361,378,346,618,106}, {364,362,379,347,619,107},
+    {365,363,380,348,620,108}, {366,364,381,349,621,109}, {367,365,382,350,622,110}, {352,366,383,351,623,111},
+    {369,383,384,352,624,112}, {370,368,385,353,625,113}, {371,369,386,354,626,114}, {372,370,387,355,627,115},
+    {373,371,388,356,628,116}, {374,372,389,357,629,117}, {375,373,390,358,630,118}, {376,374,391,359,631,119},
+    {377,375,392,360,632,120}, {378,376,393,361,633,121}, {379,377,394,362,634,122}, {380,378,395,363,635,123},
+    {381,379,396,364,636,124}, {382,380,397,365,637,125}, {383,381,398,366,638,126}, {368,382,399,367,639,127},
+    {385,399,400,368,640,128}, {386,384,401,369,641,129}, {387,385,402,370,642,130}, {388,386,403,371,643,131},
+    {389,387,404,372,644,132}, {390,388,405,373,645,133}, {391,389,406,374,646,134}, {392,390,407,375,647,135},
+    {393,391,408,376,648,136}, {394,392,409,377,649,137}, {395,393,410,378,650,138}, {396,394,411,379,651,139},
+    {397,395,412,380,652,140}, {398,396,413,381,653,141}, {399,397,414,382,654,142}, {384,398,415,383,655,143},
+    {401,415,416,384,656,144}, {402,400,417,385,657,145}, {403,401,418,386,658,146}, {404,402,419,387,659,147},
+    {405,403,420,388,660,148}, {406,404,421,389,661,149}, {407,405,422,390,662,150}, {408,406,423,391,663,151},
+    {409,407,424,392,664,152}, {410,408,425,393,665,153}, {411,409,426,394,666,154}, {412,410,427,395,667,155},
+    {413,411,428,396,668,156}, {414,412,429,397,669,157}, {415,413,430,398,670,158}, {400,414,431,399,671,159},
+    {417,431,432,400,672,160}, {418,416,433,401,673,161}, {419,417,434,402,674,162}, {420,418,435,403,675,163},
+    {421,419,436,404,676,164}, {422,420,437,405,677,165}, {423,421,438,406,678,166}, {424,422,439,407,679,167},
+    {425,423,440,408,680,168}, {426,424,441,409,681,169}, {427,425,442,410,682,170}, {428,426,443,411,683,171},
+    {429,427,444,412,684,172}, {430,428,445,413,685,173}, {431,429,446,414,686,174}, {416,430,447,415,687,175},
+    {433,447,448,416,688,176}, {434,432,449,417,689,177}, {435,433,450,418,690,178}, {436,434,451,419,691,179},
+    {437,435,452,420,692,180}, {438,436,453,421,693,181}, {439,437,454,422,694,182}, {440,438,455,423,695,183},
+    {441,439,456,424,696,184}, {442,440,457,425,697,185}, {443,441,458,426,698,186}, {444,442,459,427,699,187},
+    {445,443,460,428,700,188}, {446,444,461,429,701,189}, {447,445,462,430,702,190}, {432,446,463,431,703,191},
+    {449,463,464,432,704,192}, {450,448,465,433,705,193}, {451,449,466,434,706,194}, {452,450,467,435,707,195},
+    {453,451,468,436,708,196}, {454,452,469,437,709,197}, {455,453,470,438,710,198}, {456,454,471,439,711,199},
+    {457,455,472,440,712,200}, {458,456,473,441,713,201}, {459,457,474,442,714,202}, {460,458,475,443,715,203},
+    {461,459,476,444,716,204}, {462,460,477,445,717,205}, {463,461,478,446,718,206}, {448,462,479,447,719,207},
+    {465,479,480,448,720,208}, {466,464,481,449,721,209}, {467,465,482,450,722,210}, {468,466,483,451,723,211},
+    {469,467,484,452,724,212}, {470,468,485,453,725,213}, {471,469,486,454,726,214}, {472,470,487,455,727,215},
+    {473,471,488,456,728,216}, {474,472,489,457,729,217}, {475,473,490,458,730,218}, {476,474,491,459,731,219},
+    {477,475,492,460,732,220}, {478,476,493,461,733,221}, {479,477,494,462,734,222}, {464,478,495,463,735,223},
+    {481,495,496,464,736,224}, {482,480,497,465,737,225}, {483,481,498,466,738,226}, {484,482,499,467,739,227},
+    {485,483,500,468,740,228}, {486,484,501,469,741,229}, {487,485,502,470,742,230}, {488,486,503,471,743,231},
+    {489,487,504,472,744,232}, {490,488,505,473,745,233}, {491,489,506,474,746,234}, {492,490,507,475,747,235},
+    {493,491,508,476,748,236}, {494,492,509,477,749,237}, {495,493,510,478,750,238}, {480,494,511,479,751,239},
+    {497,511,256,480,752,240}, {498,496,257,481,753,241}, {499,497,258,482,754,242}, {500,498,259,483,755,243},
+    {501,499,260,484,756,244}, {502,500,261,485,757,245}, {503,501,262,486,758,246}, {504,502,263,487,759,247},
+    {505,503,264,488,760,248}, {506,504,265,489,761,249}, {507,505,266,490,762,250}, {508,506,267,491,763,251},
+    {509,507,268,492,764,252}, {510,508,269,493,765,253}, {511,509,270,494,766,254}, {496,510,271,495,767,255},
+    {513,527,528,752,768,256}, {514,512,529,753,769,257}, {515,513,530,754,770,258}, {516,514,531,755,771,259},
+    {517,515,532,756,772,260}, {518,516,533,757,773,261}, {519,517,534,758,774,262}, {520,518,535,759,775,263},
+    {521,519,536,760,776,264}, {522,520,537,761,777,265}, {523,521,538,762,778,266}, {524,522,539,763,779,267},
+    {525,523,540,764,780,268}, {526,524,541,765,781,269}, {527,525,542,766,782,270}, {512,526,543,767,783,271},
+    {529,543,544,512,784,272}, {530,528,545,513,785,273}, {531,529,546,514,786,274}, {532,530,547,515,787,275},
+    {533,531,548,516,788,276}, {534,532,549,517,789,277}, {535,533,550,518,790,278}, {536,534,551,519,791,279},
+    {537,535,552,520,792,280}, {538,536,553,521,793,281}, {539,537,554,522,794,282}, {540,538,555,523,795,283},
+    {541,539,556,524,796,284}, {542,540,557,525,797,285}, {543,541,558,526,798,286}, {528,542,559,527,799,287},
+    {545,559,560,528,800,288}, {546,544,561,529,801,289}, {547,545,562,530,802,290}, {548,546,563,531,803,291},
+    {549,547,564,532,804,292}, {550,548,565,533,805,293}, {551,549,566,534,806,294}, {552,550,567,535,807,295},
+    {553,551,568,536,808,296}, {554,552,569,537,809,297}, {555,553,570,538,810,298}, {556,554,571,539,811,299},
+    {557,555,572,540,812,300}, {558,556,573,541,813,301}, {559,557,574,542,814,302}, {544,558,575,543,815,303},
+    {561,575,576,544,816,304}, {562,560,577,545,817,305}, {563,561,578,546,818,306}, {564,562,579,547,819,307},
+    {565,563,580,548,820,308}, {566,564,581,549,821,309}, {567,565,582,550,822,310}, {568,566,583,551,823,311},
+    {569,567,584,552,824,312}, {570,568,585,553,825,313}, {571,569,586,554,826,314}, {572,570,587,555,827,315},
+    {573,571,588,556,828,316}, {574,572,589,557,829,317}, {575,573,590,558,830,318}, {560,574,591,559,831,319},
+    {577,591,592,560,832,320}, {578,576,593,561,833,321}, {579,577,594,562,834,322}, {580,578,595,563,835,323},
+    {581,579,596,564,836,324}, {582,580,597,565,837,325}, {583,581,598,566,838,326}, {584,582,599,567,839,327},
+    {585,583,600,568,840,328}, {586,584,601,569,841,329}, {587,585,602,570,842,330}, {588,586,603,571,843,331},
+    {589,587,604,572,844,332}, {590,588,605,573,845,333}, {591,589,606,574,846,334}, {576,590,607,575,847,335},
+    {593,607,608,576,848,336}, {594,592,609,577,849,337}, {595,593,610,578,850,338}, {596,594,611,579,851,339},
+    {597,595,612,580,852,340}, {598,596,613,581,853,341}, {599,597,614,582,854,342}, {600,598,615,583,855,343},
+    {601,599,616,584,856,344}, {602,600,617,585,857,345}, {603,601,618,586,858,346}, {604,602,619,587,859,347},
+    {605,603,620,588,860,348}, {606,604,621,589,861,349}, {607,605,622,590,862,350}, {592,606,623,591,863,351},
+    {609,623,624,592,864,352}, {610,608,625,593,865,353}, {611,609,626,594,866,354}, {612,610,627,595,867,355},
+    {613,611,628,596,868,356}, {614,612,629,597,869,357}, {615,613,630,598,870,358}, {616,614,631,599,871,359},
+    {617,615,632,600,872,360}, {618,616,633,601,873,361}, {619,617,634,602,874,362}, {620,618,635,603,875,363},
+    {621,619,636,604,876,364}, {622,620,637,605,877,365}, {623,621,638,606,878,366}, {608,622,639,607,879,367},
+    {625,639,640,608,880,368}, {626,624,641,609,881,369}, {627,625,642,610,882,370}, {628,626,643,611,883,371},
+    {629,627,644,612,884,372}, {630,628,645,613,885,373}, {631,629,646,614,886,374}, {632,630,647,615,887,375},
+    {633,631,648,616,888,376}, {634,632,649,617,889,377}, {635,633,650,618,890,378}, {636,634,651,619,891,379},
+    {637,635,652,620,892,380}, {638,636,653,621,893,381}, {639,637,654,622,894,382}, {624,638,655,623,895,383},
+    {641,655,656,624,896,384}, {642,640,657,625,897,385}, {643,641,658,626,898,386}, {644,642,659,627,899,387},
+    {645,643,660,628,900,388}, {646,644,661,629,901,389}, {647,645,662,630,902,390}, {648,646,663,631,903,391},
+    {649,647,664,632,904,392}, {650,648,665,633,905,393}, {651,649,666,634,906,394}, {652,650,667,635,907,395},
+    {653,651,668,636,908,396}, {654,652,669,637,909,397}, {655,653,670,638,910,398}, {640,654,671,639,911,399},
+    {657,671,672,640,912,400}, {658,656,673,641,913,401}, {659,657,674,642,914,402}, {660,658,675,643,915,403},
+    {661,659,676,644,916,404}, {662,660,677,645,917,405}, {663,661,678,646,918,406}, {664,662,679,647,919,407},
+    {665,663,680,648,920,408}, {666,664,681,649,921,409}, {667,665,682,650,922,410}, {668,666,683,651,923,411},
+    {669,667,684,652,924,412}, {670,668,685,653,925,413}, {671,669,686,654,926,414}, {656,670,687,655,927,415},
+    {673,687,688,656,928,416}, {674,672,689,657,929,417}, {675,673,690,658,930,418}, {676,674,691,659,931,419},
+    {677,675,692,660,932,420}, {678,676,693,661,933,421}, {679,677,694,662,934,422}, {680,678,695,663,935,423},
+    {681,679,696,664,936,424}, {682,680,697,665,937,425}, {683,681,698,666,938,426}, {684,682,699,667,939,427},
+    {685,683,700,668,940,428}, {686,684,701,669,941,429}, {687,685,702,670,942,430}, {672,686,703,671,943,431},
+    {689,703,704,672,944,432}, {690,688,705,673,945,433}, {691,689,706,674,946,434}, {692,690,707,675,947,435},
+    {693,691,708,676,948,436}, {694,692,709,677,949,437}, {695,693,710,678,950,438}, {696,694,711,679,951,439},
+    {697,695,712,680,952,440}, {698,696,713,681,953,441}, {699,697,714,682,954,442}, {700,698,715,683,955,443},
+    {701,699,716,684,956,444}, {702,700,717,685,957,445}, {703,701,718,686,958,446}, {688,702,719,687,959,447},
+    {705,719,720,688,960,448}, {706,704,721,689,961,449}, {707,705,722,690,962,450}, {708,706,723,691,963,451},
+    {709,707,724,692,964,452}, {710,708,725,693,965,453}, {711,709,726,694,966,454}, {712,710,727,695,967,455},
+    {713,711,728,696,968,456}, {714,712,729,697,969,457}, {715,713,730,698,970,458}, {716,714,731,699,971,459},
+    {717,715,732,700,972,460}, {718,716,733,701,973,461}, {719,717,734,702,974,462}, {704,718,735,703,975,463},
+    {721,735,736,704,976,464}, {722,720,737,705,977,465}, {723,721,738,706,978,466}, {724,722,739,707,979,467},
+    {725,723,740,708,980,468}, {726,724,741,709,981,469}, {727,725,742,710,982,470}, {728,726,743,711,983,471},
+    {729,727,744,712,984,472}, {730,728,745,713,985,473}, {731,729,746,714,986,474}, {732,730,747,715,987,475},
+    {733,731,748,716,988,476}, {734,732,749,717,989,477}, {735,733,750,718,990,478}, {720,734,751,719,991,479},
+    {737,751,752,720,992,480}, {738,736,753,721,993,481}, {739,737,754,722,994,482}, {740,738,755,723,995,483},
+    {741,739,756,724,996,484}, {742,740,757,725,997,485}, {743,741,758,726,998,486}, {744,742,759,727,999,487},
+    {745,743,760,728,1000,488}, {746,744,761,729,1001,489}, {747,745,762,730,1002,490}, {748,746,763,731,1003,491},
+    {749,747,764,732,1004,492}, {750,748,765,733,1005,493}, {751,749,766,734,1006,494}, {736,750,767,735,1007,495},
+    {753,767,512,736,1008,496}, {754,752,513,737,1009,497}, {755,753,514,738,1010,498}, {756,754,515,739,1011,499},
+    {757,755,516,740,1012,500}, {758,756,517,741,1013,501}, {759,757,518,742,1014,502}, {760,758,519,743,1015,503},
+    {761,759,520,744,1016,504}, {762,760,521,745,1017,505}, {763,761,522,746,1018,506}, {764,762,523,747,1019,507},
+    {765,763,524,748,1020,508}, {766,764,525,749,1021,509}, {767,765,526,750,1022,510}, {752,766,527,751,1023,511},
+    {769,783,784,1008,1024,512}, {770,768,785,1009,1025,513}, {771,769,786,1010,1026,514}, {772,770,787,1011,1027,515},
+    {773,771,788,1012,1028,516}, {774,772,789,1013,1029,517}, {775,773,790,1014,1030,518}, {776,774,791,1015,1031,519},
+    {777,775,792,1016,1032,520}, {778,776,793,1017,1033,521}, {779,777,794,1018,1034,522}, {780,778,795,1019,1035,523},
+    {781,779,796,1020,1036,524}, {782,780,797,1021,1037,525}, {783,781,798,1022,1038,526}, {768,782,799,1023,1039,527},
+    {785,799,800,768,1040,528}, {786,784,801,769,1041,529}, {787,785,802,770,1042,530}, {788,786,803,771,1043,531},
+    {789,787,804,772,1044,532}, {790,788,805,773,1045,533}, {791,789,806,774,1046,534}, {792,790,807,775,1047,535},
+    {793,791,808,776,1048,536}, {794,792,809,777,1049,537}, {795,793,810,778,1050,538}, {796,794,811,779,1051,539},
+    {797,795,812,780,1052,540}, {798,796,813,781,1053,541}, {799,797,814,782,1054,542}, {784,798,815,783,1055,543},
+    {801,815,816,784,1056,544}, {802,800,817,785,1057,545}, {803,801,818,786,1058,546}, {804,802,819,787,1059,547},
+    {805,803,820,788,1060,548}, {806,804,821,789,1061,549}, {807,805,822,790,1062,550}, {808,806,823,791,1063,551},
+    {809,807,824,792,1064,552}, {810,808,825,793,1065,553}, {811,809,826,794,1066,554}, {812,810,827,795,1067,555},
+    {813,811,828,796,1068,556}, {814,812,829,797,1069,557}, {815,813,830,798,1070,558}, {800,814,831,799,1071,559},
+    {817,831,832,800,1072,560}, {818,816,833,801,1073,561}, {819,817,834,802,1074,562}, {820,818,835,803,1075,563},
+    {821,819,836,804,1076,564}, {822,820,837,805,1077,565}, {823,821,838,806,1078,566}, {824,822,839,807,1079,567},
+    {825,823,840,808,1080,568}, {826,824,841,809,1081,569}, {827,825,842,810,1082,570}, {828,826,843,811,1083,571},
+    {829,827,844,812,1084,572}, {830,828,845,813,1085,573}, {831,829,846,814,1086,574}, {816,830,847,815,1087,575},
+    {833,847,848,816,1088,576}, {834,832,849,817,1089,577}, {835,833,850,818,1090,578}, {836,834,851,819,1091,579},
+    {837,835,852,820,1092,580}, {838,836,853,821,1093,581}, {839,837,854,822,1094,582}, {840,838,855,823,1095,583},
+    {841,839,856,824,1096,584}, {842,840,857,825,1097,585}, {843,841,858,826,1098,586}, {844,842,859,827,1099,587},
+    {845,843,860,828,1100,588}, {846,844,861,829,1101,589}, {847,845,862,830,1102,590}, {832,846,863,831,1103,591},
+    {849,863,864,832,1104,592}, {850,848,865,833,1105,593}, {851,849,866,834,1106,594}, {852,850,867,835,1107,595},
+    {853,851,868,836,1108,596}, {854,852,869,837,1109,597}, {855,853,870,838,1110,598}, {856,854,871,839,1111,599},
+    {857,855,872,840,1112,600}, {858,856,873,841,1113,601}, {859,857,874,842,1114,602}, {860,858,875,843,1115,603},
+    {861,859,876,844,1116,604}, {862,860,877,845,1117,605}, {863,861,878,846,1118,606}, {848,862,879,847,1119,607},
+    {865,879,880,848,1120,608}, {866,864,881,849,1121,609}, {867,865,882,850,1122,610}, {868,866,883,851,1123,611},
+    {869,867,884,852,1124,612}, {870,868,885,853,1125,613}, {871,869,886,854,1126,614}, {872,870,887,855,1127,615},
+    {873,871,888,856,1128,616}, {874,872,889,857,1129,617}, {875,873,890,858,1130,618}, {876,874,891,859,1131,619},
+    {877,875,892,860,1132,620}, {878,876,893,861,1133,621}, {879,877,894,862,1134,622}, {864,878,895,863,1135,623},
+    {881,895,896,864,1136,624}, {882,880,897,865,1137,625}, {883,881,898,866,1138,626}, {884,882,899,867,1139,627},
+    {885,883,900,868,1140,628}, {886,884,901,869,1141,629}, {887,885,902,870,1142,630}, {888,886,903,871,1143,631},
+    {889,887,904,872,1144,632}, {890,888,905,873,1145,633}, {891,889,906,874,1146,634}, {892,890,907,875,1147,635},
+    {893,891,908,876,1148,636}, {894,892,909,877,1149,637}, {895,893,910,878,1150,638}, {880,894,911,879,1151,639},
+    {897,911,912,880,1152,640}, {898,896,913,881,1153,641}, {899,897,914,882,1154,642}, {900,898,915,883,1155,643},
+    {901,899,916,884,1156,644}, {902,900,917,885,1157,645}, {903,901,918,886,1158,646}, {904,902,919,887,1159,647},
+    {905,903,920,888,1160,648}, {906,904,921,889,1161,649}, {907,905,922,890,1162,650}, {908,906,923,891,1163,651},
+    {909,907,924,892,1164,652}, {910,908,925,893,1165,653}, {911,909,926,894,1166,654}, {896,910,927,895,1167,655},
+    {913,927,928,896,1168,656}, {914,912,929,897,1169,657}, {915,913,930,898,1170,658}, {916,914,931,899,1171,659},
+    {917,915,932,900,1172,660}, {918,916,933,901,1173,661}, {919,917,934,902,1174,662}, {920,918,935,903,1175,663},
+    {921,919,936,904,1176,664}, {922,920,937,905,1177,665}, {923,921,938,906,1178,666}, {924,922,939,907,1179,667},
+    {925,923,940,908,1180,668}, {926,924,941,909,1181,669}, {927,925,942,910,1182,670}, {912,926,943,911,1183,671},
+    {929,943,944,912,1184,672}, {930,928,945,913,1185,673}, {931,929,946,914,1186,674}, {932,930,947,915,1187,675},
+    {933,931,948,916,1188,676}, {934,932,949,917,1189,677}, {935,933,950,918,1190,678}, {936,934,951,919,1191,679},
+    {937,935,952,920,1192,680}, {938,936,953,921,1193,681}, {939,937,954,922,1194,682}, {940,938,955,923,1195,683},
+    {941,939,956,924,1196,684}, {942,940,957,925,1197,685}, {943,941,958,926,1198,686}, {928,942,959,927,1199,687},
+    {945,959,960,928,1200,688}, {946,944,961,929,1201,689}, {947,945,962,930,1202,690}, {948,946,963,931,1203,691},
+    {949,947,964,932,1204,692}, {950,948,965,933,1205,693}, {951,949,966,934,1206,694}, {952,950,967,935,1207,695},
+    {953,951,968,936,1208,696}, {954,952,969,937,1209,697}, {955,953,970,938,1210,698}, {956,954,971,939,1211,699},
+    {957,955,972,940,1212,700}, {958,956,973,941,1213,701}, {959,957,974,942,1214,702}, {944,958,975,943,1215,703},
+    {961,975,976,944,1216,704}, {962,960,977,945,1217,705}, {963,961,978,946,1218,706}, {964,962,979,947,1219,707},
+    {965,963,980,948,1220,708}, {966,964,981,949,1221,709}, {967,965,982,950,1222,710}, {968,966,983,951,1223,711},
+    {969,967,984,952,1224,712}, {970,968,985,953,1225,713}, {971,969,986,954,1226,714}, {972,970,987,955,1227,715},
+    {973,971,988,956,1228,716}, {974,972,989,957,1229,717}, {975,973,990,958,1230,718}, {960,974,991,959,1231,719},
+    {977,991,992,960,1232,720}, {978,976,993,961,1233,721}, {979,977,994,962,1234,722}, {980,978,995,963,1235,723},
+    {981,979,996,964,1236,724}, {982,980,997,965,1237,725}, {983,981,998,966,1238,726}, {984,982,999,967,1239,727},
+    {985,983,1000,968,1240,728}, {986,984,1001,969,1241,729}, {987,985,1002,970,1242,730}, {988,986,1003,971,1243,731},
+    {989,987,1004,972,1244,732}, {990,988,1005,973,1245,733}, {991,989,1006,974,1246,734}, {976,990,1007,975,1247,735},
+    {993,1007,1008,976,1248,736}, {994,992,1009,977,1249,737}, {995,993,1010,978,1250,738}, {996,994,1011,979,1251,739},
+    {997,995,1012,980,1252,740}, {998,996,1013,981,1253,741}, {999,997,1014,982,1254,742}, {1000,998,1015,983,1255,743},
+    {1001,999,1016,984,1256,744}, {1002,1000,1017,985,1257,745}, {1003,1001,1018,986,1258,746}, {1004,1002,1019,987,1259,747},
+    {1005,1003,1020,988,1260,748}, {1006,1004,1021,989,1261,749}, {1007,1005,1022,990,1262,750}, {992,1006,1023,991,1263,751},
+    {1009,1023,768,992,1264,752}, {1010,1008,769,993,1265,753}, {1011,1009,770,994,1266,754}, {1012,1010,771,995,1267,755},
+    {1013,1011,772,996,1268,756}, {1014,1012,773,997,1269,757}, {1015,1013,774,998,1270,758}, {1016,1014,775,999,1271,759},
+    {1017,1015,776,1000,1272,760}, {1018,1016,777,1001,1273,761}, {1019,1017,778,1002,1274,762}, {1020,1018,779,1003,1275,763},
+    {1021,1019,780,1004,1276,764}, {1022,1020,781,1005,1277,765}, {1023,1021,782,1006,1278,766}, {1008,1022,783,1007,1279,767},
+    {1025,1039,1040,1264,1280,768}, {1026,1024,1041,1265,1281,769}, {1027,1025,1042,1266,1282,770}, {1028,1026,1043,1267,1283,771},
+    {1029,1027,1044,1268,1284,772}, {1030,1028,1045,1269,1285,773}, {1031,1029,1046,1270,1286,774}, {1032,1030,1047,1271,1287,775},
+    {1033,1031,1048,1272,1288,776}, {1034,1032,1049,1273,1289,777}, {1035,1033,1050,1274,1290,778}, {1036,1034,1051,1275,1291,779},
+    {1037,1035,1052,1276,1292,780}, {1038,1036,1053,1277,1293,781}, {1039,1037,1054,1278,1294,782}, {1024,1038,1055,1279,1295,783},
+    {1041,1055,1056,1024,1296,784}, {1042,1040,1057,1025,1297,785}, {1043,1041,1058,1026,1298,786}, {1044,1042,1059,1027,1299,787},
+    {1045,1043,1060,1028,1300,788}, {1046,1044,1061,1029,1301,789}, {1047,1045,1062,1030,1302,790}, {1048,1046,1063,1031,1303,791},
+    {1049,1047,1064,1032,1304,792}, {1050,1048,1065,1033,1305,793}, {1051,1049,1066,1034,1306,794}, {1052,1050,1067,1035,1307,795},
+    {1053,1051,1068,1036,1308,796}, {1054,1052,1069,1037,1309,797}, {1055,1053,1070,1038,1310,798}, {1040,1054,1071,1039,1311,799},
+    {1057,1071,1072,1040,1312,800}, {1058,1056,1073,1041,1313,801}, {1059,1057,1074,1042,1314,802}, {1060,1058,1075,1043,1315,803},
+    {1061,1059,1076,1044,1316,804}, {1062,1060,1077,1045,1317,805}, {1063,1061,1078,1046,1318,806}, {1064,1062,1079,1047,1319,807},
+    {1065,1063,1080,1048,1320,808}, {1066,1064,1081,1049,1321,809}, {1067,1065,1082,1050,1322,810}, {1068,1066,1083,1051,1323,811},
+    {1069,1067,1084,1052,1324,812}, {1070,1068,1085,1053,1325,813}, {1071,1069,1086,1054,1326,814}, {1056,1070,1087,1055,1327,815},
+    {1073,1087,1088,1056,1328,816}, {1074,1072,1089,1057,1329,817}, {1075,1073,1090,1058,1330,818}, {1076,1074,1091,1059,1331,819},
+    {1077,1075,1092,1060,1332,820}, {1078,1076,1093,1061,1333,821}, {1079,1077,1094,1062,1334,822}, {1080,1078,1095,1063,1335,823},
+    {1081,1079,1096,1064,1336,824}, {1082,1080,1097,1065,1337,825}, {1083,1081,1098,1066,1338,826}, {1084,1082,1099,1067,1339,827},
+    {1085,1083,1100,1068,1340,828}, {1086,1084,1101,1069,1341,829}, {1087,1085,1102,1070,1342,830}, {1072,1086,1103,1071,1343,831},
+    {1089,1103,1104,1072,1344,832}, {1090,1088,1105,1073,1345,833}, {1091,1089,1106,1074,1346,834}, {1092,1090,1107,1075,1347,835},
+    {1093,1091,1108,1076,1348,836}, {1094,1092,1109,1077,1349,837}, {1095,1093,1110,1078,1350,838}, {1096,1094,1111,1079,1351,839},
+    {1097,1095,1112,1080,1352,840}, {1098,1096,1113,1081,1353,841}, {1099,1097,1114,1082,1354,842}, {1100,1098,1115,1083,1355,843},
+    {1101,1099,1116,1084,1356,844}, {1102,1100,1117,1085,1357,845}, {1103,1101,1118,1086,1358,846}, {1088,1102,1119,1087,1359,847},
+    {1105,1119,1120,1088,1360,848}, {1106,1104,1121,1089,1361,849}, {1107,1105,1122,1090,1362,850}, {1108,1106,1123,1091,1363,851},
+    {1109,1107,1124,1092,1364,852}, {1110,1108,1125,1093,1365,853}, {1111,1109,1126,1094,1366,854}, {1112,1110,1127,1095,1367,855},
+    {1113,1111,1128,1096,1368,856}, {1114,1112,1129,1097,1369,857}, {1115,1113,1130,1098,1370,858}, {1116,1114,1131,1099,1371,859},
+    {1117,1115,1132,1100,1372,860}, {1118,1116,1133,1101,1373,861}, {1119,1117,1134,1102,1374,862}, {1104,1118,1135,1103,1375,863},
+    {1121,1135,1136,1104,1376,864}, {1122,1120,1137,1105,1377,865}, {1123,1121,1138,1106,1378,866}, {1124,1122,1139,1107,1379,867},
+    {1125,1123,1140,1108,1380,868}, {1126,1124,1141,1109,1381,869}, {1127,1125,1142,1110,1382,870}, {1128,1126,1143,1111,1383,871},
+    {1129,1127,1144,1112,1384,872}, {1130,1128,1145,1113,1385,873}, {1131,1129,1146,1114,1386,874}, {1132,1130,1147,1115,1387,875},
+    {1133,1131,1148,1116,1388,876}, {1134,1132,1149,1117,1389,877}, {1135,1133,1150,1118,1390,878}, {1120,1134,1151,1119,1391,879},
+    {1137,1151,1152,1120,1392,880}, {1138,1136,1153,1121,1393,881}, {1139,1137,1154,1122,1394,882}, {1140,1138,1155,1123,1395,883},
+    {1141,1139,1156,1124,1396,884}, {1142,1140,1157,1125,1397,885}, {1143,1141,1158,1126,1398,886}, {1144,1142,1159,1127,1399,887},
+    {1145,1143,1160,1128,1400,888}, {1146,1144,1161,1129,1401,889}, {1147,1145,1162,1130,1402,890}, {1148,1146,1163,1131,1403,891},
+    {1149,1147,1164,1132,1404,892}, {1150,1148,1165,1133,1405,893}, {1151,1149,1166,1134,1406,894}, {1136,1150,1167,1135,1407,895},
+    {1153,1167,1168,1136,1408,896}, {1154,1152,1169,1137,1409,897}, {1155,1153,1170,1138,1410,898}, {1156,1154,1171,1139,1411,899},
+    {1157,1155,1172,1140,1412,900}, {1158,1156,1173,1141,1413,901}, {1159,1157,1174,1142,1414,902}, {1160,1158,1175,1143,1415,903},
+    {1161,1159,1176,1144,1416,904}, {1162,1160,1177,1145,1417,905}, {1163,1161,1178,1146,1418,906}, {1164,1162,1179,1147,1419,907},
+    {1165,1163,1180,1148,1420,908}, {1166,1164,1181,1149,1421,909}, {1167,1165,1182,1150,1422,910}, {1152,1166,1183,1151,1423,911},
+    {1169,1183,1184,1152,1424,912}, {1170,1168,1185,1153,1425,913}, {1171,1169,1186,1154,1426,914}, {1172,1170,1187,1155,1427,915},
+    {1173,1171,1188,1156,1428,916}, {1174,1172,1189,1157,1429,917}, {1175,1173,1190,1158,1430,918}, {1176,1174,1191,1159,1431,919},
+    {1177,1175,1192,1160,1432,920}, {1178,1176,1193,1161,1433,921}, {1179,1177,1194,1162,1434,922}, {1180,1178,1195,1163,1435,923},
+    {1181,1179,1196,1164,1436,924}, {1182,1180,1197,1165,1437,925}, {1183,1181,1198,1166,1438,926}, {1168,1182,1199,1167,1439,927},
+    {1185,1199,1200,1168,1440,928}, {1186,1184,1201,1169,1441,929}, {1187,1185,1202,1170,1442,930}, {1188,1186,1203,1171,1443,931},
+    {1189,1187,1204,1172,1444,932}, {1190,1188,1205,1173,1445,933}, {1191,1189,1206,1174,1446,934}, {1192,1190,1207,1175,1447,935},
+    {1193,1191,1208,1176,1448,936}, {1194,1192,1209,1177,1449,937}, {1195,1193,1210,1178,1450,938}, {1196,1194,1211,1179,1451,939},
+    {1197,1195,1212,1180,1452,940}, {1198,1196,1213,1181,1453,941}, {1199,1197,1214,1182,1454,942}, {1184,1198,1215,1183,1455,943},
+    {1201,1215,1216,1184,1456,944}, {1202,1200,1217,1185,1457,945}, {1203,1201,1218,1186,1458,946}, {1204,1202,1219,1187,1459,947},
+    {1205,1203,1220,1188,1460,948}, {1206,1204,1221,1189,1461,949}, {1207,1205,1222,1190,1462,950}, {1208,1206,1223,1191,1463,951},
+    {1209,1207,1224,1192,1464,952}, {1210,1208,1225,1193,1465,953}, {1211,1209,1226,1194,1466,954}, {1212,1210,1227,1195,1467,955},
+    {1213,1211,1228,1196,1468,956}, {1214,1212,1229,1197,1469,957}, {1215,1213,1230,1198,1470,958}, {1200,1214,1231,1199,1471,959},
+    {1217,1231,1232,1200,1472,960}, {1218,1216,1233,1201,1473,961}, {1219,1217,1234,1202,1474,962}, {1220,1218,1235,1203,1475,963},
+    {1221,1219,1236,1204,1476,964}, {1222,1220,1237,1205,1477,965}, {1223,1221,1238,1206,1478,966}, {1224,1222,1239,1207,1479,967},
+    {1225,1223,1240,1208,1480,968}, {1226,1224,1241,1209,1481,969}, {1227,1225,1242,1210,1482,970}, {1228,1226,1243,1211,1483,971},
+    {1229,1227,1244,1212,1484,972}, {1230,1228,1245,1213,1485,973}, {1231,1229,1246,1214,1486,974}, {1216,1230,1247,1215,1487,975},
+    {1233,1247,1248,1216,1488,976}, {1234,1232,1249,1217,1489,977}, {1235,1233,1250,1218,1490,978}, {1236,1234,1251,1219,1491,979},
+    {1237,1235,1252,1220,1492,980}, {1238,1236,1253,1221,1493,981}, {1239,1237,1254,1222,1494,982}, {1240,1238,1255,1223,1495,983},
+    {1241,1239,1256,1224,1496,984}, {1242,1240,1257,1225,1497,985}, {1243,1241,1258,1226,1498,986}, {1244,1242,1259,1227,1499,987},
+    {1245,1243,1260,1228,1500,988}, {1246,1244,1261,1229,1501,989}, {1247,1245,1262,1230,1502,990}, {1232,1246,1263,1231,1503,991},
+    {1249,1263,1264,1232,1504,992}, {1250,1248,1265,1233,1505,993}, {1251,1249,1266,1234,1506,994}, {1252,1250,1267,1235,1507,995},
+    {1253,1251,1268,1236,1508,996}, {1254,1252,1269,1237,1509,997}, {1255,1253,1270,1238,1510,998}, {1256,1254,1271,1239,1511,999},
+    {1257,1255,1272,1240,1512,1000}, {1258,1256,1273,1241,1513,1001}, {1259,1257,1274,1242,1514,1002}, {1260,1258,1275,1243,1515,1003},
+    {1261,1259,1276,1244,1516,1004}, {1262,1260,1277,1245,1517,1005}, {1263,1261,1278,1246,1518,1006}, {1248,1262,1279,1247,1519,1007},
+    {1265,1279,1024,1248,1520,1008}, {1266,1264,1025,1249,1521,1009}, {1267,1265,1026,1250,1522,1010}, {1268,1266,1027,1251,1523,1011},
+    {1269,1267,1028,1252,1524,1012}, {1270,1268,1029,1253,1525,1013}, {1271,1269,1030,1254,1526,1014}, {1272,1270,1031,1255,1527,1015},
+    {1273,1271,1032,1256,1528,1016}, {1274,1272,1033,1257,1529,1017}, {1275,1273,1034,1258,1530,1018}, {1276,1274,1035,1259,1531,1019},
+    {1277,1275,1036,1260,1532,1020}, {1278,1276,1037,1261,1533,1021}, {1279,1277,1038,1262,1534,1022}, {1264,1278,1039,1263,1535,1023},
+    {1281,1295,1296,1520,1536,1024}, {1282,1280,1297,1521,1537,1025}, {1283,1281,1298,1522,1538,1026}, {1284,1282,1299,1523,1539,1027},
+    {1285,1283,1300,1524,1540,1028}, {1286,1284,1301,1525,1541,1029}, {1287,1285,1302,1526,1542,1030}, {1288,1286,1303,1527,1543,1031},
+    {1289,1287,1304,1528,1544,1032}, {1290,1288,1305,1529,1545,1033}, {1291,1289,1306,1530,1546,1034}, {1292,1290,1307,1531,1547,1035},
+    {1293,1291,1308,1532,1548,1036}, {1294,1292,1309,1533,1549,1037}, {1295,1293,1310,1534,1550,1038}, {1280,1294,1311,1535,1551,1039},
+    {1297,1311,1312,1280,1552,1040}, {1298,1296,1313,1281,1553,1041}, {1299,1297,1314,1282,1554,1042}, {1300,1298,1315,1283,1555,1043},
+    {1301,1299,1316,1284,1556,1044}, {1302,1300,1317,1285,1557,1045}, {1303,1301,1318,1286,1558,1046}, {1304,1302,1319,1287,1559,1047},
+    {1305,1303,1320,1288,1560,1048}, {1306,1304,1321,1289,1561,1049}, {1307,1305,1322,1290,1562,1050}, {1308,1306,1323,1291,1563,1051},
+    {1309,1307,1324,1292,1564,1052}, {1310,1308,1325,1293,1565,1053}, {1311,1309,1326,1294,1566,1054}, {1296,1310,1327,1295,1567,1055},
+    {1313,1327,1328,1296,1568,1056}, {1314,1312,1329,1297,1569,1057}, {1315,1313,1330,1298,1570,1058}, {1316,1314,1331,1299,1571,1059},
+    {1317,1315,1332,1300,1572,1060}, {1318,1316,1333,1301,1573,1061}, {1319,1317,1334,1302,1574,1062}, {1320,1318,1335,1303,1575,1063},
+    {1321,1319,1336,1304,1576,1064}, {1322,1320,1337,1305,1577,1065}, {1323,1321,1338,1306,1578,1066}, {1324,1322,1339,1307,1579,1067},
+    {1325,1323,1340,1308,1580,1068}, {1326,1324,1341,1309,1581,1069}, {1327,1325,1342,1310,1582,1070}, {1312,1326,1343,1311,1583,1071},
+    {1329,1343,1344,1312,1584,1072}, {1330,1328,1345,1313,1585,1073}, {1331,1329,1346,1314,1586,1074}, {1332,1330,1347,1315,1587,1075},
+    {1333,1331,1348,1316,1588,1076}, {1334,1332,1349,1317,1589,1077}, {1335,1333,1350,1318,1590,1078}, {1336,1334,1351,1319,1591,1079},
+    {1337,1335,1352,1320,1592,1080}, {1338,1336,1353,1321,1593,1081}, {1339,1337,1354,1322,1594,1082}, {1340,1338,1355,1323,1595,1083},
+    {1341,1339,1356,1324,1596,1084}, {1342,1340,1357,1325,1597,1085}, {1343,1341,1358,1326,1598,1086}, {1328,1342,1359,1327,1599,1087},
+    {1345,1359,1360,1328,1600,1088}, {1346,1344,1361,1329,1601,1089}, {1347,1345,1362,1330,1602,1090}, {1348,1346,1363,1331,1603,1091},
+    {1349,1347,1364,1332,1604,1092}, {1350,1348,1365,1333,1605,1093}, {1351,1349,1366,1334,1606,1094}, {1352,1350,1367,1335,1607,1095},
+    {1353,1351,1368,1336,1608,1096}, {1354,1352,1369,1337,1609,1097}, {1355,1353,1370,1338,1610,1098}, {1356,1354,1371,1339,1611,1099},
+    {1357,1355,1372,1340,1612,1100}, {1358,1356,1373,1341,1613,1101}, {1359,1357,1374,1342,1614,1102}, {1344,1358,1375,1343,1615,1103},
+    {1361,1375,1376,1344,1616,1104}, {1362,1360,1377,1345,1617,1105}, {1363,1361,1378,1346,1618,1106}, {1364,1362,1379,1347,1619,1107},
+    {1365,1363,1380,1348,1620,1108}, {1366,1364,1381,1349,1621,1109}, {1367,1365,1382,1350,1622,1110}, {1368,1366,1383,1351,1623,1111},
+    {1369,1367,1384,1352,1624,1112}, {1370,1368,1385,1353,1625,1113}, {1371,1369,1386,1354,1626,1114}, {1372,1370,1387,1355,1627,1115},
+    {1373,1371,1388,1356,1628,1116}, {1374,1372,1389,1357,1629,1117}, {1375,1373,1390,1358,1630,1118}, {1360,1374,1391,1359,1631,1119},
+    {1377,1391,1392,1360,1632,1120}, {1378,1376,1393,1361,1633,1121}, {1379,1377,1394,1362,1634,1122}, {1380,1378,1395,1363,1635,1123},
+    {1381,1379,1396,1364,1636,1124}, {1382,1380,1397,1365,1637,1125}, {1383,1381,1398,1366,1638,1126}, {1384,1382,1399,1367,1639,1127},
+    {1385,1383,1400,1368,1640,1128}, {1386,1384,1401,1369,1641,1129}, {1387,1385,1402,1370,1642,1130}, {1388,1386,1403,1371,1643,1131},
+    {1389,1387,1404,1372,1644,1132}, {1390,1388,1405,1373,1645,1133}, {1391,1389,1406,1374,1646,1134}, {1376,1390,1407,1375,1647,1135},
+    {1393,1407,1408,1376,1648,1136}, {1394,1392,1409,1377,1649,1137}, {1395,1393,1410,1378,1650,1138}, {1396,1394,1411,1379,1651,1139},
+    {1397,1395,1412,1380,1652,1140}, {1398,1396,1413,1381,1653,1141}, {1399,1397,1414,1382,1654,1142}, {1400,1398,1415,1383,1655,1143},
+    {1401,1399,1416,1384,1656,1144}, {1402,1400,1417,1385,1657,1145}, {1403,1401,1418,1386,1658,1146}, {1404,1402,1419,1387,1659,1147},
+    {1405,1403,1420,1388,1660,1148}, {1406,1404,1421,1389,1661,1149}, {1407,1405,1422,1390,1662,1150}, {1392,1406,1423,1391,1663,1151},
+    {1409,1423,1424,1392,1664,1152}, {1410,1408,1425,1393,1665,1153}, {1411,1409,1426,1394,1666,1154}, {1412,1410,1427,1395,1667,1155},
+    {1413,1411,1428,1396,1668,1156}, {1414,1412,1429,1397,1669,1157}, {1415,1413,1430,1398,1670,1158}, {1416,1414,1431,1399,1671,1159},
+    {1417,1415,1432,1400,1672,1160}, {1418,1416,1433,1401,1673,1161}, {1419,1417,1434,1402,1674,1162}, {1420,1418,1435,1403,1675,1163},
+    {1421,1419,1436,1404,1676,1164}, {1422,1420,1437,1405,1677,1165}, {1423,1421,1438,1406,1678,1166}, {1408,1422,1439,1407,1679,1167},
+    {1425,1439,1440,1408,1680,1168}, {1426,1424,1441,1409,1681,1169}, {1427,1425,1442,1410,1682,1170}, {1428,1426,1443,1411,1683,1171},
+    {1429,1427,1444,1412,1684,1172}, {1430,1428,1445,1413,1685,1173}, {1431,1429,1446,1414,1686,1174}, {1432,1430,1447,1415,1687,1175},
+    {1433,1431,1448,1416,1688,1176}, {1434,1432,1449,1417,1689,1177}, {1435,1433,1450,1418,1690,1178}, {1436,1434,1451,1419,1691,1179},
+    {1437,1435,1452,1420,1692,1180}, {1438,1436,1453,1421,1693,1181}, {1439,1437,1454,1422,1694,1182}, {1424,1438,1455,1423,1695,1183},
+    {1441,1455,1456,1424,1696,1184}, {1442,1440,1457,1425,1697,1185}, {1443,1441,1458,1426,1698,1186}, {1444,1442,1459,1427,1699,1187},
+    {1445,1443,1460,1428,1700,1188}, {1446,1444,1461,1429,1701,1189}, {1447,1445,1462,1430,1702,1190}, {1448,1446,1463,1431,1703,1191},
+    {1449,1447,1464,1432,1704,1192}, {1450,1448,1465,1433,1705,1193}, {1451,1449,1466,1434,1706,1194}, {1452,1450,1467,1435,1707,1195},
+    {1453,1451,1468,1436,1708,1196}, {1454,1452,1469,1437,1709,1197}, {1455,1453,1470,1438,1710,1198}, {1440,1454,1471,1439,1711,1199},
+    {1457,1471,1472,1440,1712,1200}, {1458,1456,1473,1441,1713,1201}, {1459,1457,1474,1442,1714,1202}, {1460,1458,1475,1443,1715,1203},
+    {1461,1459,1476,1444,1716,1204}, {1462,1460,1477,1445,1717,1205}, {1463,1461,1478,1446,1718,1206}, {1464,1462,1479,1447,1719,1207},
+    {1465,1463,1480,1448,1720,1208}, {1466,1464,1481,1449,1721,1209}, {1467,1465,1482,1450,1722,1210}, {1468,1466,1483,1451,1723,1211},
+    {1469,1467,1484,1452,1724,1212}, {1470,1468,1485,1453,1725,1213}, {1471,1469,1486,1454,1726,1214}, {1456,1470,1487,1455,1727,1215},
+    {1473,1487,1488,1456,1728,1216}, {1474,1472,1489,1457,1729,1217}, {1475,1473,1490,1458,1730,1218}, {1476,1474,1491,1459,1731,1219},
+    {1477,1475,1492,1460,1732,1220}, {1478,1476,1493,1461,1733,1221}, {1479,1477,1494,1462,1734,1222}, {1480,1478,1495,1463,1735,1223},
+    {1481,1479,1496,1464,1736,1224}, {1482,1480,1497,1465,1737,1225}, {1483,1481,1498,1466,1738,1226}, {1484,1482,1499,1467,1739,1227},
+    {1485,1483,1500,1468,1740,1228}, {1486,1484,1501,1469,1741,1229}, {1487,1485,1502,1470,1742,1230}, {1472,1486,1503,1471,1743,1231},
+    {1489,1503,1504,1472,1744,1232}, {1490,1488,1505,1473,1745,1233}, {1491,1489,1506,1474,1746,1234}, {1492,1490,1507,1475,1747,1235},
+    {1493,1491,1508,1476,1748,1236}, {1494,1492,1509,1477,1749,1237}, {1495,1493,1510,1478,1750,1238}, {1496,1494,1511,1479,1751,1239},
+    {1497,1495,1512,1480,1752,1240}, {1498,1496,1513,1481,1753,1241}, {1499,1497,1514,1482,1754,1242}, {1500,1498,1515,1483,1755,1243},
+    {1501,1499,1516,1484,1756,1244}, {1502,1500,1517,1485,1757,1245}, {1503,1501,1518,1486,1758,1246}, {1488,1502,1519,1487,1759,1247},
+    {1505,1519,1520,1488,1760,1248}, {1506,1504,1521,1489,1761,1249}, {1507,1505,1522,1490,1762,1250}, {1508,1506,1523,1491,1763,1251},
+    {1509,1507,1524,1492,1764,1252}, {1510,1508,1525,1493,1765,1253}, {1511,1509,1526,1494,1766,1254}, {1512,1510,1527,1495,1767,1255},
+    {1513,1511,1528,1496,1768,1256}, {1514,1512,1529,1497,1769,1257}, {1515,1513,1530,1498,1770,1258}, {1516,1514,1531,1499,1771,1259},
+    {1517,1515,1532,1500,1772,1260}, {1518,1516,1533,1501,1773,1261}, {1519,1517,1534,1502,1774,1262}, {1504,1518,1535,1503,1775,1263},
+    {1521,1535,1280,1504,1776,1264}, {1522,1520,1281,1505,1777,1265}, {1523,1521,1282,1506,1778,1266}, {1524,1522,1283,1507,1779,1267},
+    {1525,1523,1284,1508,1780,1268}, {1526,1524,1285,1509,1781,1269}, {1527,1525,1286,1510,1782,1270}, {1528,1526,1287,1511,1783,1271},
+    {1529,1527,1288,1512,1784,1272}, {1530,1528,1289,1513,1785,1273}, {1531,1529,1290,1514,1786,1274}, {1532,1530,1291,1515,1787,1275},
+    {1533,1531,1292,1516,1788,1276}, {1534,1532,1293,1517,1789,1277}, {1535,1533,1294,1518,1790,1278}, {1520,1534,1295,1519,1791,1279},
+    {1537,1551,1552,1776,1792,1280}, {1538,1536,1553,1777,1793,1281}, {1539,1537,1554,1778,1794,1282}, {1540,1538,1555,1779,1795,1283},
+    {1541,1539,1556,1780,1796,1284}, {1542,1540,1557,1781,1797,1285}, {1543,1541,1558,1782,1798,1286}, {1544,1542,1559,1783,1799,1287},
+    {1545,1543,1560,1784,1800,1288}, {1546,1544,1561,1785,1801,1289}, {1547,1545,1562,1786,1802,1290}, {1548,1546,1563,1787,1803,1291},
+    {1549,1547,1564,1788,1804,1292}, {1550,1548,1565,1789,1805,1293}, {1551,1549,1566,1790,1806,1294}, {1536,1550,1567,1791,1807,1295},
+    {1553,1567,1568,1536,1808,1296}, {1554,1552,1569,1537,1809,1297}, {1555,1553,1570,1538,1810,1298}, {1556,1554,1571,1539,1811,1299},
+    {1557,1555,1572,1540,1812,1300}, {1558,1556,1573,1541,1813,1301}, {1559,1557,1574,1542,1814,1302}, {1560,1558,1575,1543,1815,1303},
+    {1561,1559,1576,1544,1816,1304}, {1562,1560,1577,1545,1817,1305}, {1563,1561,1578,1546,1818,1306}, {1564,1562,1579,1547,1819,1307},
+    {1565,1563,1580,1548,1820,1308}, {1566,1564,1581,1549,1821,1309}, {1567,1565,1582,1550,1822,1310}, {1552,1566,1583,1551,1823,1311},
+    {1569,1583,1584,1552,1824,1312}, {1570,1568,1585,1553,1825,1313}, {1571,1569,1586,1554,1826,1314}, {1572,1570,1587,1555,1827,1315},
+    {1573,1571,1588,1556,1828,1316}, {1574,1572,1589,1557,1829,1317}, {1575,1573,1590,1558,1830,1318}, {1576,1574,1591,1559,1831,1319},
+    {1577,1575,1592,1560,1832,1320}, {1578,1576,1593,1561,1833,1321}, {1579,1577,1594,1562,1834,1322}, {1580,1578,1595,1563,1835,1323},
+    {1581,1579,1596,1564,1836,1324}, {1582,1580,1597,1565,1837,1325}, {1583,1581,1598,1566,1838,1326}, {1568,1582,1599,1567,1839,1327},
+    {1585,1599,1600,1568,1840,1328}, {1586,1584,1601,1569,1841,1329}, {1587,1585,1602,1570,1842,1330}, {1588,1586,1603,1571,1843,1331},
+    {1589,1587,1604,1572,1844,1332}, {1590,1588,1605,1573,1845,1333}, {1591,1589,1606,1574,1846,1334}, {1592,1590,1607,1575,1847,1335},
+    {1593,1591,1608,1576,1848,1336}, {1594,1592,1609,1577,1849,1337}, {1595,1593,1610,1578,1850,1338}, {1596,1594,1611,1579,1851,1339},
+    {1597,1595,1612,1580,1852,1340}, {1598,1596,1613,1581,1853,1341}, {1599,1597,1614,1582,1854,1342}, {1584,1598,1615,1583,1855,1343},
+    {1601,1615,1616,1584,1856,1344}, {1602,1600,1617,1585,1857,1345}, {1603,1601,1618,1586,1858,1346}, {1604,1602,1619,1587,1859,1347},
+    {1605,1603,1620,1588,1860,1348}, {1606,1604,1621,1589,1861,1349}, {1607,1605,1622,1590,1862,1350}, {1608,1606,1623,1591,1863,1351},
+    {1609,1607,1624,1592,1864,1352}, {1610,1608,1625,1593,1865,1353}, {1611,1609,1626,1594,1866,1354}, {1612,1610,1627,1595,1867,1355},
+    {1613,1611,1628,1596,1868,1356}, {1614,1612,1629,1597,1869,1357}, {1615,1613,1630,1598,1870,1358}, {1600,1614,1631,1599,1871,1359},
+    {1617,1631,1632,1600,1872,1360}, {1618,1616,1633,1601,1873,1361}, {1619,1617,1634,1602,1874,1362}, {1620,1618,1635,1603,1875,1363},
+    {1621,1619,1636,1604,1876,1364}, {1622,1620,1637,1605,1877,1365}, {1623,1621,1638,1606,1878,1366}, {1624,1622,1639,1607,1879,1367},
+    {1625,1623,1640,1608,1880,1368}, {1626,1624,1641,1609,1881,1369}, {1627,1625,1642,1610,1882,1370}, {1628,1626,1643,1611,1883,1371},
+    {1629,1627,1644,1612,1884,1372}, {1630,1628,1645,1613,1885,1373}, {1631,1629,1646,1614,1886,1374}, {1616,1630,1647,1615,1887,1375},
+    {1633,1647,1648,1616,1888,1376}, {1634,1632,1649,1617,1889,1377}, {1635,1633,1650,1618,1890,1378}, {1636,1634,1651,1619,1891,1379},
+    {1637,1635,1652,1620,1892,1380}, {1638,1636,1653,1621,1893,1381}, {1639,1637,1654,1622,1894,1382}, {1640,1638,1655,1623,1895,1383},
+    {1641,1639,1656,1624,1896,1384}, {1642,1640,1657,1625,1897,1385}, {1643,1641,1658,1626,1898,1386}, {1644,1642,1659,1627,1899,1387},
+    {1645,1643,1660,1628,1900,1388}, {1646,1644,1661,1629,1901,1389}, {1647,1645,1662,1630,1902,1390}, {1632,1646,1663,1631,1903,1391},
+    {1649,1663,1664,1632,1904,1392}, {1650,1648,1665,1633,1905,1393}, {1651,1649,1666,1634,1906,1394}, {1652,1650,1667,1635,1907,1395},
+    {1653,1651,1668,1636,1908,1396}, {1654,1652,1669,1637,1909,1397}, {1655,1653,1670,1638,1910,1398}, {1656,1654,1671,1639,1911,1399},
+    {1657,1655,1672,1640,1912,1400}, {1658,1656,1673,1641,1913,1401}, {1659,1657,1674,1642,1914,1402}, {1660,1658,1675,1643,1915,1403},
+    {1661,1659,1676,1644,1916,1404}, {1662,1660,1677,1645,1917,1405}, {1663,1661,1678,1646,1918,1406}, {1648,1662,1679,1647,1919,1407},
+    {1665,1679,1680,1648,1920,1408}, {1666,1664,1681,1649,1921,1409}, {1667,1665,1682,1650,1922,1410}, {1668,1666,1683,1651,1923,1411},
+    {1669,1667,1684,1652,1924,1412}, {1670,1668,1685,1653,1925,1413}, {1671,1669,1686,1654,1926,1414}, {1672,1670,1687,1655,1927,1415},
+    {1673,1671,1688,1656,1928,1416}, {1674,1672,1689,1657,1929,1417}, {1675,1673,1690,1658,1930,1418}, {1676,1674,1691,1659,1931,1419},
+    {1677,1675,1692,1660,1932,1420}, {1678,1676,1693,1661,1933,1421}, {1679,1677,1694,1662,1934,1422}, {1664,1678,1695,1663,1935,1423},
+    {1681,1695,1696,1664,1936,1424}, {1682,1680,1697,1665,1937,1425}, {1683,1681,1698,1666,1938,1426}, {1684,1682,1699,1667,1939,1427},
+    {1685,1683,1700,1668,1940,1428}, {1686,1684,1701,1669,1941,1429}, {1687,1685,1702,1670,1942,1430}, {1688,1686,1703,1671,1943,1431},
+    {1689,1687,1704,1672,1944,1432}, {1690,1688,1705,1673,1945,1433}, {1691,1689,1706,1674,1946,1434}, {1692,1690,1707,1675,1947,1435},
+    {1693,1691,1708,1676,1948,1436}, {1694,1692,1709,1677,1949,1437}, {1695,1693,1710,1678,1950,1438}, {1680,1694,1711,1679,1951,1439},
+    {1697,1711,1712,1680,1952,1440}, {1698,1696,1713,1681,1953,1441}, {1699,1697,1714,1682,1954,1442}, {1700,1698,1715,1683,1955,1443},
+    {1701,1699,1716,1684,1956,1444}, {1702,1700,1717,1685,1957,1445}, {1703,1701,1718,1686,1958,1446}, {1704,1702,1719,1687,1959,1447},
+    {1705,1703,1720,1688,1960,1448}, {1706,1704,1721,1689,1961,1449}, {1707,1705,1722,1690,1962,1450}, {1708,1706,1723,1691,1963,1451},
+    {1709,1707,1724,1692,1964,1452}, {1710,1708,1725,1693,1965,1453}, {1711,1709,1726,1694,1966,1454}, {1696,1710,1727,1695,1967,1455},
+    {1713,1727,1728,1696,1968,1456}, {1714,1712,1729,1697,1969,1457}, {1715,1713,1730,1698,1970,1458}, {1716,1714,1731,1699,1971,1459},
+    {1717,1715,1732,1700,1972,1460}, {1718,1716,1733,1701,1973,1461}, {1719,1717,1734,1702,1974,1462}, {1720,1718,1735,1703,1975,1463},
+    {1721,1719,1736,1704,1976,1464}, {1722,1720,1737,1705,1977,1465}, {1723,1721,1738,1706,1978,1466}, {1724,1722,1739,1707,1979,1467},
+    {1725,1723,1740,1708,1980,1468}, {1726,1724,1741,1709,1981,1469}, {1727,1725,1742,1710,1982,1470}, {1712,1726,1743,1711,1983,1471},
+    {1729,1743,1744,1712,1984,1472}, {1730,1728,1745,1713,1985,1473}, {1731,1729,1746,1714,1986,1474}, {1732,1730,1747,1715,1987,1475},
+    {1733,1731,1748,1716,1988,1476}, {1734,1732,1749,1717,1989,1477}, {1735,1733,1750,1718,1990,1478}, {1736,1734,1751,1719,1991,1479},
+    {1737,1735,1752,1720,1992,1480}, {1738,1736,1753,1721,1993,1481}, {1739,1737,1754,1722,1994,1482}, {1740,1738,1755,1723,1995,1483},
+    {1741,1739,1756,1724,1996,1484}, {1742,1740,1757,1725,1997,1485}, {1743,1741,1758,1726,1998,1486}, {1728,1742,1759,1727,1999,1487},
+    {1745,1759,1760,1728,2000,1488}, {1746,1744,1761,1729,2001,1489}, {1747,1745,1762,1730,2002,1490}, {1748,1746,1763,1731,2003,1491},
+    {1749,1747,1764,1732,2004,1492}, {1750,1748,1765,1733,2005,1493}, {1751,1749,1766,1734,2006,1494}, {1752,1750,1767,1735,2007,1495},
+    {1753,1751,1768,1736,2008,1496}, {1754,1752,1769,1737,2009,1497}, {1755,1753,1770,1738,2010,1498}, {1756,1754,1771,1739,2011,1499},
+    {1757,1755,1772,1740,2012,1500}, {1758,1756,1773,1741,2013,1501}, {1759,1757,1774,1742,2014,1502}, {1744,1758,1775,1743,2015,1503},
+    {1761,1775,1776,1744,2016,1504}, {1762,1760,1777,1745,2017,1505}, {1763,1761,1778,1746,2018,1506}, {1764,1762,1779,1747,2019,1507},
+    {1765,1763,1780,1748,2020,1508}, {1766,1764,1781,1749,2021,1509}, {1767,1765,1782,1750,2022,1510}, {1768,1766,1783,1751,2023,1511},
+    {1769,1767,1784,1752,2024,1512}, {1770,1768,1785,1753,2025,1513}, {1771,1769,1786,1754,2026,1514}, {1772,1770,1787,1755,2027,1515},
+    {1773,1771,1788,1756,2028,1516}, {1774,1772,1789,1757,2029,1517}, {1775,1773,1790,1758,2030,1518}, {1760,1774,1791,1759,2031,1519},
+    {1777,1791,1536,1760,2032,1520}, {1778,1776,1537,1761,2033,1521}, {1779,1777,1538,1762,2034,1522}, {1780,1778,1539,1763,2035,1523},
+    {1781,1779,1540,1764,2036,1524}, {1782,1780,1541,1765,2037,1525}, {1783,1781,1542,1766,2038,1526}, {1784,1782,1543,1767,2039,1527},
+    {1785,1783,1544,1768,2040,1528}, {1786,1784,1545,1769,2041,1529}, {1787,1785,1546,1770,2042,1530}, {1788,1786,1547,1771,2043,1531},
+    {1789,1787,1548,1772,2044,1532}, {1790,1788,1549,1773,2045,1533}, {1791,1789,1550,1774,2046,1534}, {1776,1790,1551,1775,2047,1535},
+    {1793,1807,1808,2032,2048,1536}, {1794,1792,1809,2033,2049,1537}, {1795,1793,1810,2034,2050,1538}, {1796,1794,1811,2035,2051,1539},
+    {1797,1795,1812,2036,2052,1540}, {1798,1796,1813,2037,2053,1541}, {1799,1797,1814,2038,2054,1542}, {1800,1798,1815,2039,2055,1543},
+    {1801,1799,1816,2040,2056,1544}, {1802,1800,1817,2041,2057,1545}, {1803,1801,1818,2042,2058,1546}, {1804,1802,1819,2043,2059,1547},
+    {1805,1803,1820,2044,2060,1548}, {1806,1804,1821,2045,2061,1549}, {1807,1805,1822,2046,2062,1550}, {1792,1806,1823,2047,2063,1551},
+    {1809,1823,1824,1792,2064,1552}, {1810,1808,1825,1793,2065,1553}, {1811,1809,1826,1794,2066,1554}, {1812,1810,1827,1795,2067,1555},
+    {1813,1811,1828,1796,2068,1556}, {1814,1812,1829,1797,2069,1557}, {1815,1813,1830,1798,2070,1558}, {1816,1814,1831,1799,2071,1559},
+    {1817,1815,1832,1800,2072,1560}, {1818,1816,1833,1801,2073,1561}, {1819,1817,1834,1802,2074,1562}, {1820,1818,1835,1803,2075,1563},
+    {1821,1819,1836,1804,2076,1564}, {1822,1820,1837,1805,2077,1565}, {1823,1821,1838,1806,2078,1566}, {1808,1822,1839,1807,2079,1567},
+    {1825,1839,1840,1808,2080,1568}, {1826,1824,1841,1809,2081,1569}, {1827,1825,1842,1810,2082,1570}, {1828,1826,1843,1811,2083,1571},
+    {1829,1827,1844,1812,2084,1572}, {1830,1828,1845,1813,2085,1573}, {1831,1829,1846,1814,2086,1574}, {1832,1830,1847,1815,2087,1575},
+    {1833,1831,1848,1816,2088,1576}, {1834,1832,1849,1817,2089,1577}, {1835,1833,1850,1818,2090,1578}, {1836,1834,1851,1819,2091,1579},
+    {1837,1835,1852,1820,2092,1580}, {1838,1836,1853,1821,2093,1581}, {1839,1837,1854,1822,2094,1582}, {1824,1838,1855,1823,2095,1583},
+    {1841,1855,1856,1824,2096,1584}, {1842,1840,1857,1825,2097,1585}, {1843,1841,1858,1826,2098,1586}, {1844,1842,1859,1827,2099,1587},
+    {1845,1843,1860,1828,2100,1588}, {1846,1844,1861,1829,2101,1589}, {1847,1845,1862,1830,2102,1590}, {1848,1846,1863,1831,2103,1591},
+    {1849,1847,1864,1832,2104,1592}, {1850,1848,1865,1833,2105,1593}, {1851,1849,1866,1834,2106,1594}, {1852,1850,1867,1835,2107,1595},
+    {1853,1851,1868,1836,2108,1596}, {1854,1852,1869,1837,2109,1597}, {1855,1853,1870,1838,2110,1598}, {1840,1854,1871,1839,2111,1599},
+    {1857,1871,1872,1840,2112,1600}, {1858,1856,1873,1841,2113,1601}, {1859,1857,1874,1842,2114,1602}, {1860,1858,1875,1843,2115,1603},
+    {1861,1859,1876,1844,2116,1604}, {1862,1860,1877,1845,2117,1605}, {1863,1861,1878,1846,2118,1606}, {1864,1862,1879,1847,2119,1607},
+    {1865,1863,1880,1848,2120,1608}, {1866,1864,1881,1849,2121,1609}, {1867,1865,1882,1850,2122,1610}, {1868,1866,1883,1851,2123,1611},
+    {1869,1867,1884,1852,2124,1612}, {1870,1868,1885,1853,2125,1613}, {1871,1869,1886,1854,2126,1614}, {1856,1870,1887,1855,2127,1615},
+    {1873,1887,1888,1856,2128,1616}, {1874,1872,1889,1857,2129,1617}, {1875,1873,1890,1858,2130,1618}, {1876,1874,1891,1859,2131,1619},
+    {1877,1875,1892,1860,2132,1620}, {1878,1876,1893,1861,2133,1621}, {1879,1877,1894,1862,2134,1622}, {1880,1878,1895,1863,2135,1623},
+    {1881,1879,1896,1864,2136,1624}, {1882,1880,1897,1865,2137,1625}, {1883,1881,1898,1866,2138,1626}, {1884,1882,1899,1867,2139,1627},
+    {1885,1883,1900,1868,2140,1628}, {1886,1884,1901,1869,2141,1629}, {1887,1885,1902,1870,2142,1630}, {1872,1886,1903,1871,2143,1631},
+    {1889,1903,1904,1872,2144,1632}, {1890,1888,1905,1873,2145,1633}, {1891,1889,1906,1874,2146,1634}, {1892,1890,1907,1875,2147,1635},
+    {1893,1891,1908,1876,2148,1636}, {1894,1892,1909,1877,2149,1637}, {1895,1893,1910,1878,2150,1638}, {1896,1894,1911,1879,2151,1639},
+    {1897,1895,1912,1880,2152,1640}, {1898,1896,1913,1881,2153,1641}, {1899,1897,1914,1882,2154,1642}, {1900,1898,1915,1883,2155,1643},
+    {1901,1899,1916,1884,2156,1644}, {1902,1900,1917,1885,2157,1645}, {1903,1901,1918,1886,2158,1646}, {1888,1902,1919,1887,2159,1647},
+    {1905,1919,1920,1888,2160,1648}, {1906,1904,1921,1889,2161,1649}, {1907,1905,1922,1890,2162,1650}, {1908,1906,1923,1891,2163,1651},
+    {1909,1907,1924,1892,2164,1652}, {1910,1908,1925,1893,2165,1653}, {1911,1909,1926,1894,2166,1654}, {1912,1910,1927,1895,2167,1655},
+    {1913,1911,1928,1896,2168,1656}, {1914,1912,1929,1897,2169,1657}, {1915,1913,1930,1898,2170,1658}, {1916,1914,1931,1899,2171,1659},
+    {1917,1915,1932,1900,2172,1660}, {1918,1916,1933,1901,2173,1661}, {1919,1917,1934,1902,2174,1662}, {1904,1918,1935,1903,2175,1663},
+    {1921,1935,1936,1904,2176,1664}, {1922,1920,1937,1905,2177,1665}, {1923,1921,1938,1906,2178,1666}, {1924,1922,1939,1907,2179,1667},
+    {1925,1923,1940,1908,2180,1668}, {1926,1924,1941,1909,2181,1669}, {1927,1925,1942,1910,2182,1670}, {1928,1926,1943,1911,2183,1671},
+    {1929,1927,1944,1912,2184,1672}, {1930,1928,1945,1913,2185,1673}, {1931,1929,1946,1914,2186,1674}, {1932,1930,1947,1915,2187,1675},
+    {1933,1931,1948,1916,2188,1676}, {1934,1932,1949,1917,2189,1677}, {1935,1933,1950,1918,2190,1678}, {1920,1934,1951,1919,2191,1679},
+    {1937,1951,1952,1920,2192,1680}, {1938,1936,1953,1921,2193,1681}, {1939,1937,1954,1922,2194,1682}, {1940,1938,1955,1923,2195,1683},
+    {1941,1939,1956,1924,2196,1684}, {1942,1940,1957,1925,2197,1685}, {1943,1941,1958,1926,2198,1686}, {1944,1942,1959,1927,2199,1687},
+    {1945,1943,1960,1928,2200,1688}, {1946,1944,1961,1929,2201,1689}, {1947,1945,1962,1930,2202,1690}, {1948,1946,1963,1931,2203,1691},
+    {1949,1947,1964,1932,2204,1692}, {1950,1948,1965,1933,2205,1693}, {1951,1949,1966,1934,2206,1694}, {1936,1950,1967,1935,2207,1695},
+    {1953,1967,1968,1936,2208,1696}, {1954,1952,1969,1937,2209,1697}, {1955,1953,1970,1938,2210,1698}, {1956,1954,1971,1939,2211,1699},
+    {1957,1955,1972,1940,2212,1700}, {1958,1956,1973,1941,2213,1701}, {1959,1957,1974,1942,2214,1702}, {1960,1958,1975,1943,2215,1703},
+    {1961,1959,1976,1944,2216,1704}, {1962,1960,1977,1945,2217,1705}, {1963,1961,1978,1946,2218,1706}, {1964,1962,1979,1947,2219,1707},
+    {1965,1963,1980,1948,2220,1708}, {1966,1964,1981,1949,2221,1709}, {1967,1965,1982,1950,2222,1710}, {1952,1966,1983,1951,2223,1711},
+    {1969,1983,1984,1952,2224,1712}, {1970,1968,1985,1953,2225,1713}, {1971,1969,1986,1954,2226,1714}, {1972,1970,1987,1955,2227,1715},
+    {1973,1971,1988,1956,2228,1716}, {1974,1972,1989,1957,2229,1717}, {1975,1973,1990,1958,2230,1718}, {1976,1974,1991,1959,2231,1719},
+    {1977,1975,1992,1960,2232,1720}, {1978,1976,1993,1961,2233,1721}, {1979,1977,1994,1962,2234,1722}, {1980,1978,1995,1963,2235,1723},
+    {1981,1979,1996,1964,2236,1724}, {1982,1980,1997,1965,2237,1725}, {1983,1981,1998,1966,2238,1726}, {1968,1982,1999,1967,2239,1727},
+    {1985,1999,2000,1968,2240,1728}, {1986,1984,2001,1969,2241,1729}, {1987,1985,2002,1970,2242,1730}, {1988,1986,2003,1971,2243,1731},
+    {1989,1987,2004,1972,2244,1732}, {1990,1988,2005,1973,2245,1733}, {1991,1989,2006,1974,2246,1734}, {1992,1990,2007,1975,2247,1735},
+    {1993,1991,2008,1976,2248,1736}, {1994,1992,2009,1977,2249,1737}, {1995,1993,2010,1978,2250,1738}, {1996,1994,2011,1979,2251,1739},
+    {1997,1995,2012,1980,2252,1740}, {1998,1996,2013,1981,2253,1741}, {1999,1997,2014,1982,2254,1742}, {1984,1998,2015,1983,2255,1743},
+    {2001,2015,2016,1984,2256,1744}, {2002,2000,2017,1985,2257,1745}, {2003,2001,2018,1986,2258,1746}, {2004,2002,2019,1987,2259,1747},
+    {2005,2003,2020,1988,2260,1748}, {2006,2004,2021,1989,2261,1749}, {2007,2005,2022,1990,2262,1750}, {2008,2006,2023,1991,2263,1751},
+    {2009,2007,2024,1992,2264,1752}, {2010,2008,2025,1993,2265,1753}, {2011,2009,2026,1994,2266,1754}, {2012,2010,2027,1995,2267,1755},
+    {2013,2011,2028,1996,2268,1756}, {2014,2012,2029,1997,2269,1757}, {2015,2013,2030,1998,2270,1758}, {2000,2014,2031,1999,2271,1759},
+    {2017,2031,2032,2000,2272,1760}, {2018,2016,2033,2001,2273,1761}, {2019,2017,2034,2002,2274,1762}, {2020,2018,2035,2003,2275,1763},
+    {2021,2019,2036,2004,2276,1764}, {2022,2020,2037,2005,2277,1765}, {2023,2021,2038,2006,2278,1766}, {2024,2022,2039,2007,2279,1767},
+    {2025,2023,2040,2008,2280,1768}, {2026,2024,2041,2009,2281,1769}, {2027,2025,2042,2010,2282,1770}, {2028,2026,2043,2011,2283,1771},
+    {2029,2027,2044,2012,2284,1772}, {2030,2028,2045,2013,2285,1773}, {2031,2029,2046,2014,2286,1774}, {2016,2030,2047,2015,2287,1775},
+    {2033,2047,1792,2016,2288,1776}, {2034,2032,1793,2017,2289,1777}, {2035,2033,1794,2018,2290,1778}, {2036,2034,1795,2019,2291,1779},
+    {2037,2035,1796,2020,2292,1780}, {2038,2036,1797,2021,2293,1781}, {2039,2037,1798,2022,2294,1782}, {2040,2038,1799,2023,2295,1783},
+    {2041,2039,1800,2024,2296,1784}, {2042,2040,1801,2025,2297,1785}, {2043,2041,1802,2026,2298,1786}, {2044,2042,1803,2027,2299,1787},
+    {2045,2043,1804,2028,2300,1788}, {2046,2044,1805,2029,2301,1789}, {2047,2045,1806,2030,2302,1790}, {2032,2046,1807,2031,2303,1791},
+    {2049,2063,2064,2288,2304,1792}, {2050,2048,2065,2289,2305,1793}, {2051,2049,2066,2290,2306,1794}, {2052,2050,2067,2291,2307,1795},
+    {2053,2051,2068,2292,2308,1796}, {2054,2052,2069,2293,2309,1797}, {2055,2053,2070,2294,2310,1798}, {2056,2054,2071,2295,2311,1799},
+    {2057,2055,2072,2296,2312,1800}, {2058,2056,2073,2297,2313,1801}, {2059,2057,2074,2298,2314,1802}, {2060,2058,2075,2299,2315,1803},
+    {2061,2059,2076,2300,2316,1804}, {2062,2060,2077,2301,2317,1805}, {2063,2061,2078,2302,2318,1806}, {2048,2062,2079,2303,2319,1807},
+    {2065,2079,2080,2048,2320,1808}, {2066,2064,2081,2049,2321,1809}, {2067,2065,2082,2050,2322,1810}, {2068,2066,2083,2051,2323,1811},
+    {2069,2067,2084,2052,2324,1812}, {2070,2068,2085,2053,2325,1813}, {2071,2069,2086,2054,2326,1814}, {2072,2070,2087,2055,2327,1815},
+    {2073,2071,2088,2056,2328,1816}, {2074,2072,2089,2057,2329,1817}, {2075,2073,2090,2058,2330,1818}, {2076,2074,2091,2059,2331,1819},
+    {2077,2075,2092,2060,2332,1820}, {2078,2076,2093,2061,2333,1821}, {2079,2077,2094,2062,2334,1822}, {2064,2078,2095,2063,2335,1823},
+    {2081,2095,2096,2064,2336,1824}, {2082,2080,2097,2065,2337,1825}, {2083,2081,2098,2066,2338,1826}, {2084,2082,2099,2067,2339,1827},
+    {2085,2083,2100,2068,2340,1828}, {2086,2084,2101,2069,2341,1829}, {2087,2085,2102,2070,2342,1830}, {2088,2086,2103,2071,2343,1831},
+    {2089,2087,2104,2072,2344,1832}, {2090,2088,2105,2073,2345,1833}, {2091,2089,2106,2074,2346,1834}, {2092,2090,2107,2075,2347,1835},
+    {2093,2091,2108,2076,2348,1836}, {2094,2092,2109,2077,2349,1837}, {2095,2093,2110,2078,2350,1838}, {2080,2094,2111,2079,2351,1839},
+    {2097,2111,2112,2080,2352,1840}, {2098,2096,2113,2081,2353,1841}, {2099,2097,2114,2082,2354,1842}, {2100,2098,2115,2083,2355,1843},
+    {2101,2099,2116,2084,2356,1844}, {2102,2100,2117,2085,2357,1845}, {2103,2101,2118,2086,2358,1846}, {2104,2102,2119,2087,2359,1847},
+    {2105,2103,2120,2088,2360,1848}, {2106,2104,2121,2089,2361,1849}, {2107,2105,2122,2090,2362,1850}, {2108,2106,2123,2091,2363,1851},
+    {2109,2107,2124,2092,2364,1852}, {2110,2108,2125,2093,2365,1853}, {2111,2109,2126,2094,2366,1854}, {2096,2110,2127,2095,2367,1855},
+    {2113,2127,2128,2096,2368,1856}, {2114,2112,2129,2097,2369,1857}, {2115,2113,2130,2098,2370,1858}, {2116,2114,2131,2099,2371,1859},
+    {2117,2115,2132,2100,2372,1860}, {2118,2116,2133,2101,2373,1861}, {2119,2117,2134,2102,2374,1862}, {2120,2118,2135,2103,2375,1863},
+    {2121,2119,2136,2104,2376,1864}, {2122,2120,2137,2105,2377,1865}, {2123,2121,2138,2106,2378,1866}, {2124,2122,2139,2107,2379,1867},
+    {2125,2123,2140,2108,2380,1868}, {2126,2124,2141,2109,2381,1869}, {2127,2125,2142,2110,2382,1870}, {2112,2126,2143,2111,2383,1871},
+    {2129,2143,2144,2112,2384,1872}, {2130,2128,2145,2113,2385,1873}, {2131,2129,2146,2114,2386,1874}, {2132,2130,2147,2115,2387,1875},
+    {2133,2131,2148,2116,2388,1876}, {2134,2132,2149,2117,2389,1877}, {2135,2133,2150,2118,2390,1878}, {2136,2134,2151,2119,2391,1879},
+    {2137,2135,2152,2120,2392,1880}, {2138,2136,2153,2121,2393,1881}, {2139,2137,2154,2122,2394,1882}, {2140,2138,2155,2123,2395,1883},
+    {2141,2139,2156,2124,2396,1884}, {2142,2140,2157,2125,2397,1885}, {2143,2141,2158,2126,2398,1886}, {2128,2142,2159,2127,2399,1887},
+    {2145,2159,2160,2128,2400,1888}, {2146,2144,2161,2129,2401,1889}, {2147,2145,2162,2130,2402,1890}, {2148,2146,2163,2131,2403,1891},
+    {2149,2147,2164,2132,2404,1892}, {2150,2148,2165,2133,2405,1893}, {2151,2149,2166,2134,2406,1894}, {2152,2150,2167,2135,2407,1895},
+    {2153,2151,2168,2136,2408,1896}, {2154,2152,2169,2137,2409,1897}, {2155,2153,2170,2138,2410,1898}, {2156,2154,2171,2139,2411,1899},
+    {2157,2155,2172,2140,2412,1900}, {2158,2156,2173,2141,2413,1901}, {2159,2157,2174,2142,2414,1902}, {2144,2158,2175,2143,2415,1903},
+    {2161,2175,2176,2144,2416,1904}, {2162,2160,2177,2145,2417,1905}, {2163,2161,2178,2146,2418,1906}, {2164,2162,2179,2147,2419,1907},
+    {2165,2163,2180,2148,2420,1908}, {2166,2164,2181,2149,2421,1909}, {2167,2165,2182,2150,2422,1910}, {2168,2166,2183,2151,2423,1911},
+    {2169,2167,2184,2152,2424,1912}, {2170,2168,2185,2153,2425,1913}, {2171,2169,2186,2154,2426,1914}, {2172,2170,2187,2155,2427,1915},
+    {2173,2171,2188,2156,2428,1916}, {2174,2172,2189,2157,2429,1917}, {2175,2173,2190,2158,2430,1918}, {2160,2174,2191,2159,2431,1919},
+    {2177,2191,2192,2160,2432,1920}, {2178,2176,2193,2161,2433,1921}, {2179,2177,2194,2162,2434,1922}, {2180,2178,2195,2163,2435,1923},
+    {2181,2179,2196,2164,2436,1924}, {2182,2180,2197,2165,2437,1925}, {2183,2181,2198,2166,2438,1926}, {2184,2182,2199,2167,2439,1927},
+    {2185,2183,2200,2168,2440,1928}, {2186,2184,2201,2169,2441,1929}, {2187,2185,2202,2170,2442,1930}, {2188,2186,2203,2171,2443,1931},
+    {2189,2187,2204,2172,2444,1932}, {2190,2188,2205,2173,2445,1933}, {2191,2189,2206,2174,2446,1934}, {2176,2190,2207,2175,2447,1935},
+    {2193,2207,2208,2176,2448,1936}, {2194,2192,2209,2177,2449,1937}, {2195,2193,2210,2178,2450,1938}, {2196,2194,2211,2179,2451,1939},
+    {2197,2195,2212,2180,2452,1940}, {2198,2196,2213,2181,2453,1941}, {2199,2197,2214,2182,2454,1942}, {2200,2198,2215,2183,2455,1943},
+    {2201,2199,2216,2184,2456,1944}, {2202,2200,2217,2185,2457,1945}, {2203,2201,2218,2186,2458,1946}, {2204,2202,2219,2187,2459,1947},
+    {2205,2203,2220,2188,2460,1948}, {2206,2204,2221,2189,2461,1949}, {2207,2205,2222,2190,2462,1950}, {2192,2206,2223,2191,2463,1951},
+    {2209,2223,2224,2192,2464,1952}, {2210,2208,2225,2193,2465,1953}, {2211,2209,2226,2194,2466,1954}, {2212,2210,2227,2195,2467,1955},
+    {2213,2211,2228,2196,2468,1956}, {2214,2212,2229,2197,2469,1957}, {2215,2213,2230,2198,2470,1958}, {2216,2214,2231,2199,2471,1959},
+    {2217,2215,2232,2200,2472,1960}, {2218,2216,2233,2201,2473,1961}, {2219,2217,2234,2202,2474,1962}, {2220,2218,2235,2203,2475,1963},
+    {2221,2219,2236,2204,2476,1964}, {2222,2220,2237,2205,2477,1965}, {2223,2221,2238,2206,2478,1966}, {2208,2222,2239,2207,2479,1967},
+    {2225,2239,2240,2208,2480,1968}, {2226,2224,2241,2209,2481,1969}, {2227,2225,2242,2210,2482,1970}, {2228,2226,2243,2211,2483,1971},
+    {2229,2227,2244,2212,2484,1972}, {2230,2228,2245,2213,2485,1973}, {2231,2229,2246,2214,2486,1974}, {2232,2230,2247,2215,2487,1975},
+    {2233,2231,2248,2216,2488,1976}, {2234,2232,2249,2217,2489,1977}, {2235,2233,2250,2218,2490,1978}, {2236,2234,2251,2219,2491,1979},
+    {2237,2235,2252,2220,2492,1980}, {2238,2236,2253,2221,2493,1981}, {2239,2237,2254,2222,2494,1982}, {2224,2238,2255,2223,2495,1983},
+    {2241,2255,2256,2224,2496,1984}, {2242,2240,2257,2225,2497,1985}, {2243,2241,2258,2226,2498,1986}, {2244,2242,2259,2227,2499,1987},
+    {2245,2243,2260,2228,2500,1988}, {2246,2244,2261,2229,2501,1989}, {2247,2245,2262,2230,2502,1990}, {2248,2246,2263,2231,2503,1991},
+    {2249,2247,2264,2232,2504,1992}, {2250,2248,2265,2233,2505,1993}, {2251,2249,2266,2234,2506,1994}, {2252,2250,2267,2235,2507,1995},
+    {2253,2251,2268,2236,2508,1996}, {2254,2252,2269,2237,2509,1997}, {2255,2253,2270,2238,2510,1998}, {2240,2254,2271,2239,2511,1999},
+    {2257,2271,2272,2240,2512,2000}, {2258,2256,2273,2241,2513,2001}, {2259,2257,2274,2242,2514,2002}, {2260,2258,2275,2243,2515,2003},
+    {2261,2259,2276,2244,2516,2004}, {2262,2260,2277,2245,2517,2005}, {2263,2261,2278,2246,2518,2006}, {2264,2262,2279,2247,2519,2007},
+    {2265,2263,2280,2248,2520,2008}, {2266,2264,2281,2249,2521,2009}, {2267,2265,2282,2250,2522,2010}, {2268,2266,2283,2251,2523,2011},
+    {2269,2267,2284,2252,2524,2012}, {2270,2268,2285,2253,2525,2013}, {2271,2269,2286,2254,2526,2014}, {2256,2270,2287,2255,2527,2015},
+    {2273,2287,2288,2256,2528,2016}, {2274,2272,2289,2257,2529,2017}, {2275,2273,2290,2258,2530,2018}, {2276,2274,2291,2259,2531,2019},
+    {2277,2275,2292,2260,2532,2020}, {2278,2276,2293,2261,2533,2021}, {2279,2277,2294,2262,2534,2022}, {2280,2278,2295,2263,2535,2023},
+    {2281,2279,2296,2264,2536,2024}, {2282,2280,2297,2265,2537,2025}, {2283,2281,2298,2266,2538,2026}, {2284,2282,2299,2267,2539,2027},
+    {2285,2283,2300,2268,2540,2028}, {2286,2284,2301,2269,2541,2029}, {2287,2285,2302,2270,2542,2030}, {2272,2286,2303,2271,2543,2031},
+    {2289,2303,2048,2272,2544,2032}, {2290,2288,2049,2273,2545,2033}, {2291,2289,2050,2274,2546,2034}, {2292,2290,2051,2275,2547,2035},
+    {2293,2291,2052,2276,2548,2036}, {2294,2292,2053,2277,2549,2037}, {2295,2293,2054,2278,2550,2038}, {2296,2294,2055,2279,2551,2039},
+    {2297,2295,2056,2280,2552,2040}, {2298,2296,2057,2281,2553,2041}, {2299,2297,2058,2282,2554,2042}, {2300,2298,2059,2283,2555,2043},
+    {2301,2299,2060,2284,2556,2044}, {2302,2300,2061,2285,2557,2045}, {2303,2301,2062,2286,2558,2046}, {2288,2302,2063,2287,2559,2047},
+    {2305,2319,2320,2544,2560,2048}, {2306,2304,2321,2545,2561,2049}, {2307,2305,2322,2546,2562,2050}, {2308,2306,2323,2547,2563,2051},
+    {2309,2307,2324,2548,2564,2052}, {2310,2308,2325,2549,2565,2053}, {2311,2309,2326,2550,2566,2054}, {2312,2310,2327,2551,2567,2055},
+    {2313,2311,2328,2552,2568,2056}, {2314,2312,2329,2553,2569,2057}, {2315,2313,2330,2554,2570,2058}, {2316,2314,2331,2555,2571,2059},
+    {2317,2315,2332,2556,2572,2060}, {2318,2316,2333,2557,2573,2061}, {2319,2317,2334,2558,2574,2062}, {2304,2318,2335,2559,2575,2063},
+    {2321,2335,2336,2304,2576,2064}, {2322,2320,2337,2305,2577,2065}, {2323,2321,2338,2306,2578,2066}, {2324,2322,2339,2307,2579,2067},
+    {2325,2323,2340,2308,2580,2068}, {2326,2324,2341,2309,2581,2069}, {2327,2325,2342,2310,2582,2070}, {2328,2326,2343,2311,2583,2071},
+    {2329,2327,2344,2312,2584,2072}, {2330,2328,2345,2313,2585,2073}, {2331,2329,2346,2314,2586,2074}, {2332,2330,2347,2315,2587,2075},
+    {2333,2331,2348,2316,2588,2076}, {2334,2332,2349,2317,2589,2077}, {2335,2333,2350,2318,2590,2078}, {2320,2334,2351,2319,2591,2079},
+    {2337,2351,2352,2320,2592,2080}, {2338,2336,2353,2321,2593,2081}, {2339,2337,2354,2322,2594,2082}, {2340,2338,2355,2323,2595,2083},
+    {2341,2339,2356,2324,2596,2084}, {2342,2340,2357,2325,2597,2085}, {2343,2341,2358,2326,2598,2086}, {2344,2342,2359,2327,2599,2087},
+    {2345,2343,2360,2328,2600,2088}, {2346,2344,2361,2329,2601,2089}, {2347,2345,2362,2330,2602,2090}, {2348,2346,2363,2331,2603,2091},
+    {2349,2347,2364,2332,2604,2092}, {2350,2348,2365,2333,2605,2093}, {2351,2349,2366,2334,2606,2094}, {2336,2350,2367,2335,2607,2095},
+    {2353,2367,2368,2336,2608,2096}, {2354,2352,2369,2337,2609,2097}, {2355,2353,2370,2338,2610,2098}, {2356,2354,2371,2339,2611,2099},
+    {2357,2355,2372,2340,2612,2100}, {2358,2356,2373,2341,2613,2101}, {2359,2357,2374,2342,2614,2102}, {2360,2358,2375,2343,2615,2103},
+    {2361,2359,2376,2344,2616,2104}, {2362,2360,2377,2345,2617,2105}, {2363,2361,2378,2346,2618,2106}, {2364,2362,2379,2347,2619,2107},
+    {2365,2363,2380,2348,2620,2108}, {2366,2364,2381,2349,2621,2109}, {2367,2365,2382,2350,2622,2110}, {2352,2366,2383,2351,2623,2111},
+    {2369,2383,2384,2352,2624,2112}, {2370,2368,2385,2353,2625,2113}, {2371,2369,2386,2354,2626,2114}, {2372,2370,2387,2355,2627,2115},
+    {2373,2371,2388,2356,2628,2116}, {2374,2372,2389,2357,2629,2117}, {2375,2373,2390,2358,2630,2118}, {2376,2374,2391,2359,2631,2119},
+    {2377,2375,2392,2360,2632,2120}, {2378,2376,2393,2361,2633,2121}, {2379,2377,2394,2362,2634,2122}, {2380,2378,2395,2363,2635,2123},
+    {2381,2379,2396,2364,2636,2124}, {2382,2380,2397,2365,2637,2125}, {2383,2381,2398,2366,2638,2126}, {2368,2382,2399,2367,2639,2127},
+    {2385,2399,2400,2368,2640,2128}, {2386,2384,2401,2369,2641,2129}, {2387,2385,2402,2370,2642,2130}, {2388,2386,2403,2371,2643,2131},
+    {2389,2387,2404,2372,2644,2132}, {2390,2388,2405,2373,2645,2133}, {2391,2389,2406,2374,2646,2134}, {2392,2390,2407,2375,2647,2135},
+    {2393,2391,2408,2376,2648,2136}, {2394,2392,2409,2377,2649,2137}, {2395,2393,2410,2378,2650,2138}, {2396,2394,2411,2379,2651,2139},
+    {2397,2395,2412,2380,2652,2140}, {2398,2396,2413,2381,2653,2141}, {2399,2397,2414,2382,2654,2142}, {2384,2398,2415,2383,2655,2143},
+    {2401,2415,2416,2384,2656,2144}, {2402,2400,2417,2385,2657,2145}, {2403,2401,2418,2386,2658,2146}, {2404,2402,2419,2387,2659,2147},
+    {2405,2403,2420,2388,2660,2148}, {2406,2404,2421,2389,2661,2149}, {2407,2405,2422,2390,2662,2150}, {2408,2406,2423,2391,2663,2151},
+    {2409,2407,2424,2392,2664,2152}, {2410,2408,2425,2393,2665,2153}, {2411,2409,2426,2394,2666,2154}, {2412,2410,2427,2395,2667,2155},
+    {2413,2411,2428,2396,2668,2156}, {2414,2412,2429,2397,2669,2157}, {2415,2413,2430,2398,2670,2158}, {2400,2414,2431,2399,2671,2159},
+    {2417,2431,2432,2400,2672,2160}, {2418,2416,2433,2401,2673,2161}, {2419,2417,2434,2402,2674,2162}, {2420,2418,2435,2403,2675,2163},
+    {2421,2419,2436,2404,2676,2164}, {2422,2420,2437,2405,2677,2165}, {2423,2421,2438,2406,2678,2166}, {2424,2422,2439,2407,2679,2167},
+    {2425,2423,2440,2408,2680,2168}, {2426,2424,2441,2409,2681,2169}, {2427,2425,2442,2410,2682,2170}, {2428,2426,2443,2411,2683,2171},
+    {2429,2427,2444,2412,2684,2172}, {2430,2428,2445,2413,2685,2173}, {2431,2429,2446,2414,2686,2174}, {2416,2430,2447,2415,2687,2175},
+    {2433,2447,2448,2416,2688,2176}, {2434,2432,2449,2417,2689,2177}, {2435,2433,2450,2418,2690,2178}, {2436,2434,2451,2419,2691,2179},
+    {2437,2435,2452,2420,2692,2180}, {2438,2436,2453,2421,2693,2181}, {2439,2437,2454,2422,2694,2182}, {2440,2438,2455,2423,2695,2183},
+    {2441,2439,2456,2424,2696,2184}, {2442,2440,2457,2425,2697,2185}, {2443,2441,2458,2426,2698,2186}, {2444,2442,2459,2427,2699,2187},
+    {2445,2443,2460,2428,2700,2188}, {2446,2444,2461,2429,2701,2189}, {2447,2445,2462,2430,2702,2190}, {2432,2446,2463,2431,2703,2191},
+    {2449,2463,2464,2432,2704,2192}, {2450,2448,2465,2433,2705,2193}, {2451,2449,2466,2434,2706,2194}, {2452,2450,2467,2435,2707,2195},
+    {2453,2451,2468,2436,2708,2196}, {2454,2452,2469,2437,2709,2197}, {2455,2453,2470,2438,2710,2198}, {2456,2454,2471,2439,2711,2199},
+    {2457,2455,2472,2440,2712,2200}, {2458,2456,2473,2441,2713,2201}, {2459,2457,2474,2442,2714,2202}, {2460,2458,2475,2443,2715,2203},
+    {2461,2459,2476,2444,2716,2204}, {2462,2460,2477,2445,2717,2205}, {2463,2461,2478,2446,2718,2206}, {2448,2462,2479,2447,2719,2207},
+    {2465,2479,2480,2448,2720,2208}, {2466,2464,2481,2449,2721,2209}, {2467,2465,2482,2450,2722,2210}, {2468,2466,2483,2451,2723,2211},
+    {2469,2467,2484,2452,2724,2212}, {2470,2468,2485,2453,2725,2213}, {2471,2469,2486,2454,2726,2214}, {2472,2470,2487,2455,2727,2215},
+    {2473,2471,2488,2456,2728,2216}, {2474,2472,2489,2457,2729,2217}, {2475,2473,2490,2458,2730,2218}, {2476,2474,2491,2459,2731,2219},
+    {2477,2475,2492,2460,2732,2220}, {2478,2476,2493,2461,2733,2221}, {2479,2477,2494,2462,2734,2222}, {2464,2478,2495,2463,2735,2223},
+    {2481,2495,2496,2464,2736,2224}, {2482,2480,2497,2465,2737,2225}, {2483,2481,2498,2466,2738,2226}, {2484,2482,2499,2467,2739,2227},
+    {2485,2483,2500,2468,2740,2228}, {2486,2484,2501,2469,2741,2229}, {2487,2485,2502,2470,2742,2230}, {2488,2486,2503,2471,2743,2231},
+    {2489,2487,2504,2472,2744,2232}, {2490,2488,2505,2473,2745,2233}, {2491,2489,2506,2474,2746,2234}, {2492,2490,2507,2475,2747,2235},
+    {2493,2491,2508,2476,2748,2236}, {2494,2492,2509,2477,2749,2237}, {2495,2493,2510,2478,2750,2238}, {2480,2494,2511,2479,2751,2239},
+    {2497,2511,2512,2480,2752,2240}, {2498,2496,2513,2481,2753,2241}, {2499,2497,2514,2482,2754,2242}, {2500,2498,2515,2483,2755,2243},
+    {2501,2499,2516,2484,2756,2244}, {2502,2500,2517,2485,2757,2245}, {2503,2501,2518,2486,2758,2246}, {2504,2502,2519,2487,2759,2247},
+    {2505,2503,2520,2488,2760,2248}, {2506,2504,2521,2489,2761,2249}, {2507,2505,2522,2490,2762,2250}, {2508,2506,2523,2491,2763,2251},
+    {2509,2507,2524,2492,2764,2252}, {2510,2508,2525,2493,2765,2253}, {2511,2509,2526,2494,2766,2254}, {2496,2510,2527,2495,2767,2255},
+    {2513,2527,2528,2496,2768,2256}, {2514,2512,2529,2497,2769,2257}, {2515,2513,2530,2498,2770,2258}, {2516,2514,2531,2499,2771,2259},
+    {2517,2515,2532,2500,2772,2260}, {2518,2516,2533,2501,2773,2261}, {2519,2517,2534,2502,2774,2262}, {2520,2518,2535,2503,2775,2263},
+    {2521,2519,2536,2504,2776,2264}, {2522,2520,2537,2505,2777,2265}, {2523,2521,2538,2506,2778,2266}, {2524,2522,2539,2507,2779,2267},
+    {2525,2523,2540,2508,2780,2268}, {2526,2524,2541,2509,2781,2269}, {2527,2525,2542,2510,2782,2270}, {2512,2526,2543,2511,2783,2271},
+    {2529,2543,2544,2512,2784,2272}, {2530,2528,2545,2513,2785,2273}, {2531,2529,2546,2514,2786,2274}, {2532,2530,2547,2515,2787,2275},
+    {2533,2531,2548,2516,2788,2276}, {2534,2532,2549,2517,2789,2277}, {2535,2533,2550,2518,2790,2278}, {2536,2534,2551,2519,2791,2279},
+    {2537,2535,2552,2520,2792,2280}, {2538,2536,2553,2521,2793,2281}, {2539,2537,2554,2522,2794,2282}, {2540,2538,2555,2523,2795,2283},
+    {2541,2539,2556,2524,2796,2284}, {2542,2540,2557,2525,2797,2285}, {2543,2541,2558,2526,2798,2286}, {2528,2542,2559,2527,2799,2287},
+    {2545,2559,2304,2528,2800,2288}, {2546,2544,2305,2529,2801,2289}, {2547,2545,2306,2530,2802,2290}, {2548,2546,2307,2531,2803,2291},
+    {2549,2547,2308,2532,2804,2292}, {2550,2548,2309,2533,2805,2293}, {2551,2549,2310,2534,2806,2294}, {2552,2550,2311,2535,2807,2295},
+    {2553,2551,2312,2536,2808,2296}, {2554,2552,2313,2537,2809,2297}, {2555,2553,2314,2538,2810,2298}, {2556,2554,2315,2539,2811,2299},
+    {2557,2555,2316,2540,2812,2300}, {2558,2556,2317,2541,2813,2301}, {2559,2557,2318,2542,2814,2302}, {2544,2558,2319,2543,2815,2303},
+    {2561,2575,2576,2800,2816,2304}, {2562,2560,2577,2801,2817,2305}, {2563,2561,2578,2802,2818,2306}, {2564,2562,2579,2803,2819,2307},
+    {2565,2563,2580,2804,2820,2308}, {2566,2564,2581,2805,2821,2309}, {2567,2565,2582,2806,2822,2310}, {2568,2566,2583,2807,2823,2311},
+    {2569,2567,2584,2808,2824,2312}, {2570,2568,2585,2809,2825,2313}, {2571,2569,2586,2810,2826,2314}, {2572,2570,2587,2811,2827,2315},
+    {2573,2571,2588,2812,2828,2316}, {2574,2572,2589,2813,2829,2317}, {2575,2573,2590,2814,2830,2318}, {2560,2574,2591,2815,2831,2319},
+    {2577,2591,2592,2560,2832,2320}, {2578,2576,2593,2561,2833,2321}, {2579,2577,2594,2562,2834,2322}, {2580,2578,2595,2563,2835,2323},
+    {2581,2579,2596,2564,2836,2324}, {2582,2580,2597,2565,2837,2325}, {2583,2581,2598,2566,2838,2326}, {2584,2582,2599,2567,2839,2327},
+    {2585,2583,2600,2568,2840,2328}, {2586,2584,2601,2569,2841,2329}, {2587,2585,2602,2570,2842,2330}, {2588,2586,2603,2571,2843,2331},
+    {2589,2587,2604,2572,2844,2332}, {2590,2588,2605,2573,2845,2333}, {2591,2589,2606,2574,2846,2334}, {2576,2590,2607,2575,2847,2335},
+    {2593,2607,2608,2576,2848,2336}, {2594,2592,2609,2577,2849,2337}, {2595,2593,2610,2578,2850,2338}, {2596,2594,2611,2579,2851,2339},
+    {2597,2595,2612,2580,2852,2340}, {2598,2596,2613,2581,2853,2341}, {2599,2597,2614,2582,2854,2342}, {2600,2598,2615,2583,2855,2343},
+    {2601,2599,2616,2584,2856,2344}, {2602,2600,2617,2585,2857,2345}, {2603,2601,2618,2586,2858,2346}, {2604,2602,2619,2587,2859,2347},
+    {2605,2603,2620,2588,2860,2348}, {2606,2604,2621,2589,2861,2349}, {2607,2605,2622,2590,2862,2350}, {2592,2606,2623,2591,2863,2351},
+    {2609,2623,2624,2592,2864,2352}, {2610,2608,2625,2593,2865,2353}, {2611,2609,2626,2594,2866,2354}, {2612,2610,2627,2595,2867,2355},
+    {2613,2611,2628,2596,2868,2356}, {2614,2612,2629,2597,2869,2357}, {2615,2613,2630,2598,2870,2358}, {2616,2614,2631,2599,2871,2359},
+    {2617,2615,2632,2600,2872,2360}, {2618,2616,2633,2601,2873,2361}, {2619,2617,2634,2602,2874,2362}, {2620,2618,2635,2603,2875,2363},
+    {2621,2619,2636,2604,2876,2364}, {2622,2620,2637,2605,2877,2365}, {2623,2621,2638,2606,2878,2366}, {2608,2622,2639,2607,2879,2367},
+    {2625,2639,2640,2608,2880,2368}, {2626,2624,2641,2609,2881,2369}, {2627,2625,2642,2610,2882,2370}, {2628,2626,2643,2611,2883,2371},
+    {2629,2627,2644,2612,2884,2372}, {2630,2628,2645,2613,2885,2373}, {2631,2629,2646,2614,2886,2374}, {2632,2630,2647,2615,2887,2375},
+    {2633,2631,2648,2616,2888,2376}, {2634,2632,2649,2617,2889,2377}, {2635,2633,2650,2618,2890,2378}, {2636,2634,2651,2619,2891,2379},
+    {2637,2635,2652,2620,2892,2380}, {2638,2636,2653,2621,2893,2381}, {2639,2637,2654,2622,2894,2382}, {2624,2638,2655,2623,2895,2383},
+    {2641,2655,2656,2624,2896,2384}, {2642,2640,2657,2625,2897,2385}, {2643,2641,2658,2626,2898,2386}, {2644,2642,2659,2627,2899,2387},
+    {2645,2643,2660,2628,2900,2388}, {2646,2644,2661,2629,2901,2389}, {2647,2645,2662,2630,2902,2390}, {2648,2646,2663,2631,2903,2391},
+    {2649,2647,2664,2632,2904,2392}, {2650,2648,2665,2633,2905,2393}, {2651,2649,2666,2634,2906,2394}, {2652,2650,2667,2635,2907,2395},
+    {2653,2651,2668,2636,2908,2396}, {2654,2652,2669,2637,2909,2397}, {2655,2653,2670,2638,2910,2398}, {2640,2654,2671,2639,2911,2399},
+    {2657,2671,2672,2640,2912,2400}, {2658,2656,2673,2641,2913,2401}, {2659,2657,2674,2642,2914,2402}, {2660,2658,2675,2643,2915,2403},
+    {2661,2659,2676,2644,2916,2404}, {2662,2660,2677,2645,2917,2405}, {2663,2661,2678,2646,2918,2406}, {2664,2662,2679,2647,2919,2407},
+    {2665,2663,2680,2648,2920,2408}, {2666,2664,2681,2649,2921,2409}, {2667,2665,2682,2650,2922,2410}, {2668,2666,2683,2651,2923,2411},
+    {2669,2667,2684,2652,2924,2412}, {2670,2668,2685,2653,2925,2413}, {2671,2669,2686,2654,2926,2414}, {2656,2670,2687,2655,2927,2415},
+    {2673,2687,2688,2656,2928,2416}, {2674,2672,2689,2657,2929,2417}, {2675,2673,2690,2658,2930,2418}, {2676,2674,2691,2659,2931,2419},
+    {2677,2675,2692,2660,2932,2420}, {2678,2676,2693,2661,2933,2421}, {2679,2677,2694,2662,2934,2422}, {2680,2678,2695,2663,2935,2423},
+    {2681,2679,2696,2664,2936,2424}, {2682,2680,2697,2665,2937,2425}, {2683,2681,2698,2666,2938,2426}, {2684,2682,2699,2667,2939,2427},
+    {2685,2683,2700,2668,2940,2428}, {2686,2684,2701,2669,2941,2429}, {2687,2685,2702,2670,2942,2430}, {2672,2686,2703,2671,2943,2431},
+    {2689,2703,2704,2672,2944,2432}, {2690,2688,2705,2673,2945,2433}, {2691,2689,2706,2674,2946,2434}, {2692,2690,2707,2675,2947,2435},
+    {2693,2691,2708,2676,2948,2436}, {2694,2692,2709,2677,2949,2437}, {2695,2693,2710,2678,2950,2438}, {2696,2694,2711,2679,2951,2439},
+    {2697,2695,2712,2680,2952,2440}, {2698,2696,2713,2681,2953,2441}, {2699,2697,2714,2682,2954,2442}, {2700,2698,2715,2683,2955,2443},
+    {2701,2699,2716,2684,2956,2444}, {2702,2700,2717,2685,2957,2445}, {2703,2701,2718,2686,2958,2446}, {2688,2702,2719,2687,2959,2447},
+    {2705,2719,2720,2688,2960,2448}, {2706,2704,2721,2689,2961,2449}, {2707,2705,2722,2690,2962,2450}, {2708,2706,2723,2691,2963,2451},
+    {2709,2707,2724,2692,2964,2452}, {2710,2708,2725,2693,2965,2453}, {2711,2709,2726,2694,2966,2454}, {2712,2710,2727,2695,2967,2455},
+    {2713,2711,2728,2696,2968,2456}, {2714,2712,2729,2697,2969,2457}, {2715,2713,2730,2698,2970,2458}, {2716,2714,2731,2699,2971,2459},
+    {2717,2715,2732,2700,2972,2460}, {2718,2716,2733,2701,2973,2461}, {2719,2717,2734,2702,2974,2462}, {2704,2718,2735,2703,2975,2463},
+    {2721,2735,2736,2704,2976,2464}, {2722,2720,2737,2705,2977,2465}, {2723,2721,2738,2706,2978,2466}, {2724,2722,2739,2707,2979,2467},
+    {2725,2723,2740,2708,2980,2468}, {2726,2724,2741,2709,2981,2469}, {2727,2725,2742,2710,2982,2470}, {2728,2726,2743,2711,2983,2471},
+    {2729,2727,2744,2712,2984,2472}, {2730,2728,2745,2713,2985,2473}, {2731,2729,2746,2714,2986,2474}, {2732,2730,2747,2715,2987,2475},
+    {2733,2731,2748,2716,2988,2476}, {2734,2732,2749,2717,2989,2477}, {2735,2733,2750,2718,2990,2478}, {2720,2734,2751,2719,2991,2479},
+    {2737,2751,2752,2720,2992,2480}, {2738,2736,2753,2721,2993,2481}, {2739,2737,2754,2722,2994,2482}, {2740,2738,2755,2723,2995,2483},
+    {2741,2739,2756,2724,2996,2484}, {2742,2740,2757,2725,2997,2485}, {2743,2741,2758,2726,2998,2486}, {2744,2742,2759,2727,2999,2487},
+    {2745,2743,2760,2728,3000,2488}, {2746,2744,2761,2729,3001,2489}, {2747,2745,2762,2730,3002,2490}, {2748,2746,2763,2731,3003,2491},
+    {2749,2747,2764,2732,3004,2492}, {2750,2748,2765,2733,3005,2493}, {2751,2749,2766,2734,3006,2494}, {2736,2750,2767,2735,3007,2495},
+    {2753,2767,2768,2736,3008,2496}, {2754,2752,2769,2737,3009,2497}, {2755,2753,2770,2738,3010,2498}, {2756,2754,2771,2739,3011,2499},
+    {2757,2755,2772,2740,3012,2500}, {2758,2756,2773,2741,3013,2501}, {2759,2757,2774,2742,3014,2502}, {2760,2758,2775,2743,3015,2503},
+    {2761,2759,2776,2744,3016,2504}, {2762,2760,2777,2745,3017,2505}, {2763,2761,2778,2746,3018,2506}, {2764,2762,2779,2747,3019,2507},
+    {2765,2763,2780,2748,3020,2508}, {2766,2764,2781,2749,3021,2509}, {2767,2765,2782,2750,3022,2510}, {2752,2766,2783,2751,3023,2511},
+    {2769,2783,2784,2752,3024,2512}, {2770,2768,2785,2753,3025,2513}, {2771,2769,2786,2754,3026,2514}, {2772,2770,2787,2755,3027,2515},
+    {2773,2771,2788,2756,3028,2516}, {2774,2772,2789,2757,3029,2517}, {2775,2773,2790,2758,3030,2518}, {2776,2774,2791,2759,3031,2519},
+    {2777,2775,2792,2760,3032,2520}, {2778,2776,2793,2761,3033,2521}, {2779,2777,2794,2762,3034,2522}, {2780,2778,2795,2763,3035,2523},
+    {2781,2779,2796,2764,3036,2524}, {2782,2780,2797,2765,3037,2525}, {2783,2781,2798,2766,3038,2526}, {2768,2782,2799,2767,3039,2527},
+    {2785,2799,2800,2768,3040,2528}, {2786,2784,2801,2769,3041,2529}, {2787,2785,2802,2770,3042,2530}, {2788,2786,2803,2771,3043,2531},
+    {2789,2787,2804,2772,3044,2532}, {2790,2788,2805,2773,3045,2533}, {2791,2789,2806,2774,3046,2534}, {2792,2790,2807,2775,3047,2535},
+    {2793,2791,2808,2776,3048,2536}, {2794,2792,2809,2777,3049,2537}, {2795,2793,2810,2778,3050,2538}, {2796,2794,2811,2779,3051,2539},
+    {2797,2795,2812,2780,3052,2540}, {2798,2796,2813,2781,3053,2541}, {2799,2797,2814,2782,3054,2542}, {2784,2798,2815,2783,3055,2543},
+    {2801,2815,2560,2784,3056,2544}, {2802,2800,2561,2785,3057,2545}, {2803,2801,2562,2786,3058,2546}, {2804,2802,2563,2787,3059,2547},
+    {2805,2803,2564,2788,3060,2548}, {2806,2804,2565,2789,3061,2549}, {2807,2805,2566,2790,3062,2550}, {2808,2806,2567,2791,3063,2551},
+    {2809,2807,2568,2792,3064,2552}, {2810,2808,2569,2793,3065,2553}, {2811,2809,2570,2794,3066,2554}, {2812,2810,2571,2795,3067,2555},
+    {2813,2811,2572,2796,3068,2556}, {2814,2812,2573,2797,3069,2557}, {2815,2813,2574,2798,3070,2558}, {2800,2814,2575,2799,3071,2559},
+    {2817,2831,2832,3056,3072,2560}, {2818,2816,2833,3057,3073,2561}, {2819,2817,2834,3058,3074,2562}, {2820,2818,2835,3059,3075,2563},
+    {2821,2819,2836,3060,3076,2564}, {2822,2820,2837,3061,3077,2565}, {2823,2821,2838,3062,3078,2566}, {2824,2822,2839,3063,3079,2567},
+    {2825,2823,2840,3064,3080,2568}, {2826,2824,2841,3065,3081,2569}, {2827,2825,2842,3066,3082,2570}, {2828,2826,2843,3067,3083,2571},
+    {2829,2827,2844,3068,3084,2572}, {2830,2828,2845,3069,3085,2573}, {2831,2829,2846,3070,3086,2574}, {2816,2830,2847,3071,3087,2575},
+    {2833,2847,2848,2816,3088,2576}, {2834,2832,2849,2817,3089,2577}, {2835,2833,2850,2818,3090,2578}, {2836,2834,2851,2819,3091,2579},
+    {2837,2835,2852,2820,3092,2580}, {2838,2836,2853,2821,3093,2581}, {2839,2837,2854,2822,3094,2582}, {2840,2838,2855,2823,3095,2583},
+    {2841,2839,2856,2824,3096,2584}, {2842,2840,2857,2825,3097,2585}, {2843,2841,2858,2826,3098,2586}, {2844,2842,2859,2827,3099,2587},
+    {2845,2843,2860,2828,3100,2588}, {2846,2844,2861,2829,3101,2589}, {2847,2845,2862,2830,3102,2590}, {2832,2846,2863,2831,3103,2591},
+    {2849,2863,2864,2832,3104,2592}, {2850,2848,2865,2833,3105,2593}, {2851,2849,2866,2834,3106,2594}, {2852,2850,2867,2835,3107,2595},
+    {2853,2851,2868,2836,3108,2596}, {2854,2852,2869,2837,3109,2597}, {2855,2853,2870,2838,3110,2598}, {2856,2854,2871,2839,3111,2599},
+    {2857,2855,2872,2840,3112,2600}, {2858,2856,2873,2841,3113,2601}, {2859,2857,2874,2842,3114,2602}, {2860,2858,2875,2843,3115,2603},
+    {2861,2859,2876,2844,3116,2604}, {2862,2860,2877,2845,3117,2605}, {2863,2861,2878,2846,3118,2606}, {2848,2862,2879,2847,3119,2607},
+    {2865,2879,2880,2848,3120,2608}, {2866,2864,2881,2849,3121,2609}, {2867,2865,2882,2850,3122,2610}, {2868,2866,2883,2851,3123,2611},
+    {2869,2867,2884,2852,3124,2612}, {2870,2868,2885,2853,3125,2613}, {2871,2869,2886,2854,3126,2614}, {2872,2870,2887,2855,3127,2615},
+    {2873,2871,2888,2856,3128,2616}, {2874,2872,2889,2857,3129,2617}, {2875,2873,2890,2858,3130,2618}, {2876,2874,2891,2859,3131,2619},
+    {2877,2875,2892,2860,3132,2620}, {2878,2876,2893,2861,3133,2621}, {2879,2877,2894,2862,3134,2622}, {2864,2878,2895,2863,3135,2623},
+    {2881,2895,2896,2864,3136,2624}, {2882,2880,2897,2865,3137,2625}, {2883,2881,2898,2866,3138,2626}, {2884,2882,2899,2867,3139,2627},
+    {2885,2883,2900,2868,3140,2628}, {2886,2884,2901,2869,3141,2629}, {2887,2885,2902,2870,3142,2630}, {2888,2886,2903,2871,3143,2631},
+    {2889,2887,2904,2872,3144,2632}, {2890,2888,2905,2873,3145,2633}, {2891,2889,2906,2874,3146,2634}, {2892,2890,2907,2875,3147,2635},
+    {2893,2891,2908,2876,3148,2636}, {2894,2892,2909,2877,3149,2637}, {2895,2893,2910,2878,3150,2638}, {2880,2894,2911,2879,3151,2639},
+    {2897,2911,2912,2880,3152,2640}, {2898,2896,2913,2881,3153,2641}, {2899,2897,2914,2882,3154,2642}, {2900,2898,2915,2883,3155,2643},
+    {2901,2899,2916,2884,3156,2644}, {2902,2900,2917,2885,3157,2645}, {2903,2901,2918,2886,3158,2646}, {2904,2902,2919,2887,3159,2647},
+    {2905,2903,2920,2888,3160,2648}, {2906,2904,2921,2889,3161,2649}, {2907,2905,2922,2890,3162,2650}, {2908,2906,2923,2891,3163,2651},
+    {2909,2907,2924,2892,3164,2652}, {2910,2908,2925,2893,3165,2653}, {2911,2909,2926,2894,3166,2654}, {2896,2910,2927,2895,3167,2655},
+    {2913,2927,2928,2896,3168,2656}, {2914,2912,2929,2897,3169,2657}, {2915,2913,2930,2898,3170,2658}, {2916,2914,2931,2899,3171,2659},
+    {2917,2915,2932,2900,3172,2660}, {2918,2916,2933,2901,3173,2661}, {2919,2917,2934,2902,3174,2662}, {2920,2918,2935,2903,3175,2663},
+    {2921,2919,2936,2904,3176,2664}, {2922,2920,2937,2905,3177,2665}, {2923,2921,2938,2906,3178,2666}, {2924,2922,2939,2907,3179,2667},
+    {2925,2923,2940,2908,3180,2668}, {2926,2924,2941,2909,3181,2669}, {2927,2925,2942,2910,3182,2670}, {2912,2926,2943,2911,3183,2671},
+    {2929,2943,2944,2912,3184,2672}, {2930,2928,2945,2913,3185,2673}, {2931,2929,2946,2914,3186,2674}, {2932,2930,2947,2915,3187,2675},
+    {2933,2931,2948,2916,3188,2676}, {2934,2932,2949,2917,3189,2677}, {2935,2933,2950,2918,3190,2678}, {2936,2934,2951,2919,3191,2679},
+    {2937,2935,2952,2920,3192,2680}, {2938,2936,2953,2921,3193,2681}, {2939,2937,2954,2922,3194,2682}, {2940,2938,2955,2923,3195,2683},
+    {2941,2939,2956,2924,3196,2684}, {2942,2940,2957,2925,3197,2685}, {2943,2941,2958,2926,3198,2686}, {2928,2942,2959,2927,3199,2687},
+    {2945,2959,2960,2928,3200,2688}, {2946,2944,2961,2929,3201,2689}, {2947,2945,2962,2930,3202,2690}, {2948,2946,2963,2931,3203,2691},
+    {2949,2947,2964,2932,3204,2692}, {2950,2948,2965,2933,3205,2693}, {2951,2949,2966,2934,3206,2694}, {2952,2950,2967,2935,3207,2695},
+    {2953,2951,2968,2936,3208,2696}, {2954,2952,2969,2937,3209,2697}, {2955,2953,2970,2938,3210,2698}, {2956,2954,2971,2939,3211,2699},
+    {2957,2955,2972,2940,3212,2700}, {2958,2956,2973,2941,3213,2701}, {2959,2957,2974,2942,3214,2702}, {2944,2958,2975,2943,3215,2703},
+    {2961,2975,2976,2944,3216,2704}, {2962,2960,2977,2945,3217,2705}, {2963,2961,2978,2946,3218,2706}, {2964,2962,2979,2947,3219,2707},
+    {2965,2963,2980,2948,3220,2708}, {2966,2964,2981,2949,3221,2709}, {2967,2965,2982,2950,3222,2710}, {2968,2966,2983,2951,3223,2711},
+    {2969,2967,2984,2952,3224,2712}, {2970,2968,2985,2953,3225,2713}, {2971,2969,2986,2954,3226,2714}, {2972,2970,2987,2955,3227,2715},
+    {2973,2971,2988,2956,3228,2716}, {2974,2972,2989,2957,3229,2717}, {2975,2973,2990,2958,3230,2718}, {2960,2974,2991,2959,3231,2719},
+    {2977,2991,2992,2960,3232,2720}, {2978,2976,2993,2961,3233,2721}, {2979,2977,2994,2962,3234,2722}, {2980,2978,2995,2963,3235,2723},
+    {2981,2979,2996,2964,3236,2724}, {2982,2980,2997,2965,3237,2725}, {2983,2981,2998,2966,3238,2726}, {2984,2982,2999,2967,3239,2727},
+    {2985,2983,3000,2968,3240,2728}, {2986,2984,3001,2969,3241,2729}, {2987,2985,3002,2970,3242,2730}, {2988,2986,3003,2971,3243,2731},
+    {2989,2987,3004,2972,3244,2732}, {2990,2988,3005,2973,3245,2733}, {2991,2989,3006,2974,3246,2734}, {2976,2990,3007,2975,3247,2735},
+    {2993,3007,3008,2976,3248,2736}, {2994,2992,3009,2977,3249,2737}, {2995,2993,3010,2978,3250,2738}, {2996,2994,3011,2979,3251,2739},
+    {2997,2995,3012,2980,3252,2740}, {2998,2996,3013,2981,3253,2741}, {2999,2997,3014,2982,3254,2742}, {3000,2998,3015,2983,3255,2743},
+    {3001,2999,3016,2984,3256,2744}, {3002,3000,3017,2985,3257,2745}, {3003,3001,3018,2986,3258,2746}, {3004,3002,3019,2987,3259,2747},
+    {3005,3003,3020,2988,3260,2748}, {3006,3004,3021,2989,3261,2749}, {3007,3005,3022,2990,3262,2750}, {2992,3006,3023,2991,3263,2751},
+    {3009,3023,3024,2992,3264,2752}, {3010,3008,3025,2993,3265,2753}, {3011,3009,3026,2994,3266,2754}, {3012,3010,3027,2995,3267,2755},
+    {3013,3011,3028,2996,3268,2756}, {3014,3012,3029,2997,3269,2757}, {3015,3013,3030,2998,3270,2758}, {3016,3014,3031,2999,3271,2759},
+    {3017,3015,3032,3000,3272,2760}, {3018,3016,3033,3001,3273,2761}, {3019,3017,3034,3002,3274,2762}, {3020,3018,3035,3003,3275,2763},
+    {3021,3019,3036,3004,3276,2764}, {3022,3020,3037,3005,3277,2765}, {3023,3021,3038,3006,3278,2766}, {3008,3022,3039,3007,3279,2767},
+    {3025,3039,3040,3008,3280,2768}, {3026,3024,3041,3009,3281,2769}, {3027,3025,3042,3010,3282,2770}, {3028,3026,3043,3011,3283,2771},
+    {3029,3027,3044,3012,3284,2772}, {3030,3028,3045,3013,3285,2773}, {3031,3029,3046,3014,3286,2774}, {3032,3030,3047,3015,3287,2775},
+    {3033,3031,3048,3016,3288,2776}, {3034,3032,3049,3017,3289,2777}, {3035,3033,3050,3018,3290,2778}, {3036,3034,3051,3019,3291,2779},
+    {3037,3035,3052,3020,3292,2780}, {3038,3036,3053,3021,3293,2781}, {3039,3037,3054,3022,3294,2782}, {3024,3038,3055,3023,3295,2783},
+    {3041,3055,3056,3024,3296,2784}, {3042,3040,3057,3025,3297,2785}, {3043,3041,3058,3026,3298,2786}, {3044,3042,3059,3027,3299,2787},
+    {3045,3043,3060,3028,3300,2788}, {3046,3044,3061,3029,3301,2789}, {3047,3045,3062,3030,3302,2790}, {3048,3046,3063,3031,3303,2791},
+    {3049,3047,3064,3032,3304,2792}, {3050,3048,3065,3033,3305,2793}, {3051,3049,3066,3034,3306,2794}, {3052,3050,3067,3035,3307,2795},
+    {3053,3051,3068,3036,3308,2796}, {3054,3052,3069,3037,3309,2797}, {3055,3053,3070,3038,3310,2798}, {3040,3054,3071,3039,3311,2799},
+    {3057,3071,2816,3040,3312,2800}, {3058,3056,2817,3041,3313,2801}, {3059,3057,2818,3042,3314,2802}, {3060,3058,2819,3043,3315,2803},
+    {3061,3059,2820,3044,3316,2804}, {3062,3060,2821,3045,3317,2805}, {3063,3061,2822,3046,3318,2806}, {3064,3062,2823,3047,3319,2807},
+    {3065,3063,2824,3048,3320,2808}, {3066,3064,2825,3049,3321,2809}, {3067,3065,2826,3050,3322,2810}, {3068,3066,2827,3051,3323,2811},
+    {3069,3067,2828,3052,3324,2812}, {3070,3068,2829,3053,3325,2813}, {3071,3069,2830,3054,3326,2814}, {3056,3070,2831,3055,3327,2815},
+    {3073,3087,3088,3312,3328,2816}, {3074,3072,3089,3313,3329,2817}, {3075,3073,3090,3314,3330,2818}, {3076,3074,3091,3315,3331,2819},
+    {3077,3075,3092,3316,3332,2820}, {3078,3076,3093,3317,3333,2821}, {3079,3077,3094,3318,3334,2822}, {3080,3078,3095,3319,3335,2823},
+    {3081,3079,3096,3320,3336,2824}, {3082,3080,3097,3321,3337,2825}, {3083,3081,3098,3322,3338,2826}, {3084,3082,3099,3323,3339,2827},
+    {3085,3083,3100,3324,3340,2828}, {3086,3084,3101,3325,3341,2829}, {3087,3085,3102,3326,3342,2830}, {3072,3086,3103,3327,3343,2831},
+    {3089,3103,3104,3072,3344,2832}, {3090,3088,3105,3073,3345,2833}, {3091,3089,3106,3074,3346,2834}, {3092,3090,3107,3075,3347,2835},
+    {3093,3091,3108,3076,3348,2836}, {3094,3092,3109,3077,3349,2837}, {3095,3093,3110,3078,3350,2838}, {3096,3094,3111,3079,3351,2839},
+    {3097,3095,3112,3080,3352,2840}, {3098,3096,3113,3081,3353,2841}, {3099,3097,3114,3082,3354,2842}, {3100,3098,3115,3083,3355,2843},
+    {3101,3099,3116,3084,3356,2844}, {3102,3100,3117,3085,3357,2845}, {3103,3101,3118,3086,3358,2846}, {3088,3102,3119,3087,3359,2847},
+    {3105,3119,3120,3088,3360,2848}, {3106,3104,3121,3089,3361,2849}, {3107,3105,3122,3090,3362,2850}, {3108,3106,3123,3091,3363,2851},
+    {3109,3107,3124,3092,3364,2852}, {3110,3108,3125,3093,3365,2853}, {3111,3109,3126,3094,3366,2854}, {3112,3110,3127,3095,3367,2855},
+    {3113,3111,3128,3096,3368,2856}, {3114,3112,3129,3097,3369,2857}, {3115,3113,3130,3098,3370,2858}, {3116,3114,3131,3099,3371,2859},
+    {3117,3115,3132,3100,3372,2860}, {3118,3116,3133,3101,3373,2861}, {3119,3117,3134,3102,3374,2862}, {3104,3118,3135,3103,3375,2863},
+    {3121,3135,3136,3104,3376,2864}, {3122,3120,3137,3105,3377,2865}, {3123,3121,3138,3106,3378,2866}, {3124,3122,3139,3107,3379,2867},
+    {3125,3123,3140,3108,3380,2868}, {3126,3124,3141,3109,3381,2869}, {3127,3125,3142,3110,3382,2870}, {3128,3126,3143,3111,3383,2871},
+    {3129,3127,3144,3112,3384,2872}, {3130,3128,3145,3113,3385,2873}, {3131,3129,3146,3114,3386,2874}, {3132,3130,3147,3115,3387,2875},
+    {3133,3131,3148,3116,3388,2876}, {3134,3132,3149,3117,3389,2877}, {3135,3133,3150,3118,3390,2878}, {3120,3134,3151,3119,3391,2879},
+    {3137,3151,3152,3120,3392,2880}, {3138,3136,3153,3121,3393,2881}, {3139,3137,3154,3122,3394,2882}, {3140,3138,3155,3123,3395,2883},
+    {3141,3139,3156,3124,3396,2884}, {3142,3140,3157,3125,3397,2885}, {3143,3141,3158,3126,3398,2886}, {3144,3142,3159,3127,3399,2887},
+    {3145,3143,3160,3128,3400,2888}, {3146,3144,3161,3129,3401,2889}, {3147,3145,3162,3130,3402,2890}, {3148,3146,3163,3131,3403,2891},
+    {3149,3147,3164,3132,3404,2892}, {3150,3148,3165,3133,3405,2893}, {3151,3149,3166,3134,3406,2894}, {3136,3150,3167,3135,3407,2895},
+    {3153,3167,3168,3136,3408,2896}, {3154,3152,3169,3137,3409,2897}, {3155,3153,3170,3138,3410,2898}, {3156,3154,3171,3139,3411,2899},
+    {3157,3155,3172,3140,3412,2900}, {3158,3156,3173,3141,3413,2901}, {3159,3157,3174,3142,3414,2902}, {3160,3158,3175,3143,3415,2903},
+    {3161,3159,3176,3144,3416,2904}, {3162,3160,3177,3145,3417,2905}, {3163,3161,3178,3146,3418,2906}, {3164,3162,3179,3147,3419,2907},
+    {3165,3163,3180,3148,3420,2908}, {3166,3164,3181,3149,3421,2909}, {3167,3165,3182,3150,3422,2910}, {3152,3166,3183,3151,3423,2911},
+    {3169,3183,3184,3152,3424,2912}, {3170,3168,3185,3153,3425,2913}, {3171,3169,3186,3154,3426,2914}, {3172,3170,3187,3155,3427,2915},
+    {3173,3171,3188,3156,3428,2916}, {3174,3172,3189,3157,3429,2917}, {3175,3173,3190,3158,3430,2918}, {3176,3174,3191,3159,3431,2919},
+    {3177,3175,3192,3160,3432,2920}, {3178,3176,3193,3161,3433,2921}, {3179,3177,3194,3162,3434,2922}, {3180,3178,3195,3163,3435,2923},
+    {3181,3179,3196,3164,3436,2924}, {3182,3180,3197,3165,3437,2925}, {3183,3181,3198,3166,3438,2926}, {3168,3182,3199,3167,3439,2927},
+    {3185,3199,3200,3168,3440,2928}, {3186,3184,3201,3169,3441,2929}, {3187,3185,3202,3170,3442,2930}, {3188,3186,3203,3171,3443,2931},
+    {3189,3187,3204,3172,3444,2932}, {3190,3188,3205,3173,3445,2933}, {3191,3189,3206,3174,3446,2934}, {3192,3190,3207,3175,3447,2935},
+    {3193,3191,3208,3176,3448,2936}, {3194,3192,3209,3177,3449,2937}, {3195,3193,3210,3178,3450,2938}, {3196,3194,3211,3179,3451,2939},
+    {3197,3195,3212,3180,3452,2940}, {3198,3196,3213,3181,3453,2941}, {3199,3197,3214,3182,3454,2942}, {3184,3198,3215,3183,3455,2943},
+    {3201,3215,3216,3184,3456,2944}, {3202,3200,3217,3185,3457,2945}, {3203,3201,3218,3186,3458,2946}, {3204,3202,3219,3187,3459,2947},
+    {3205,3203,3220,3188,3460,2948}, {3206,3204,3221,3189,3461,2949}, {3207,3205,3222,3190,3462,2950}, {3208,3206,3223,3191,3463,2951},
+    {3209,3207,3224,3192,3464,2952}, {3210,3208,3225,3193,3465,2953}, {3211,3209,3226,3194,3466,2954}, {3212,3210,3227,3195,3467,2955},
+    {3213,3211,3228,3196,3468,2956}, {3214,3212,3229,3197,3469,2957}, {3215,3213,3230,3198,3470,2958}, {3200,3214,3231,3199,3471,2959},
+    {3217,3231,3232,3200,3472,2960}, {3218,3216,3233,3201,3473,2961}, {3219,3217,3234,3202,3474,2962}, {3220,3218,3235,3203,3475,2963},
+    {3221,3219,3236,3204,3476,2964}, {3222,3220,3237,3205,3477,2965}, {3223,3221,3238,3206,3478,2966}, {3224,3222,3239,3207,3479,2967},
+    {3225,3223,3240,3208,3480,2968}, {3226,3224,3241,3209,3481,2969}, {3227,3225,3242,3210,3482,2970}, {3228,3226,3243,3211,3483,2971},
+    {3229,3227,3244,3212,3484,2972}, {3230,3228,3245,3213,3485,2973}, {3231,3229,3246,3214,3486,2974}, {3216,3230,3247,3215,3487,2975},
+    {3233,3247,3248,3216,3488,2976}, {3234,3232,3249,3217,3489,2977}, {3235,3233,3250,3218,3490,2978}, {3236,3234,3251,3219,3491,2979},
+    {3237,3235,3252,3220,3492,2980}, {3238,3236,3253,3221,3493,2981}, {3239,3237,3254,3222,3494,2982}, {3240,3238,3255,3223,3495,2983},
+    {3241,3239,3256,3224,3496,2984}, {3242,3240,3257,3225,3497,2985}, {3243,3241,3258,3226,3498,2986}, {3244,3242,3259,3227,3499,2987},
+    {3245,3243,3260,3228,3500,2988}, {3246,3244,3261,3229,3501,2989}, {3247,3245,3262,3230,3502,2990}, {3232,3246,3263,3231,3503,2991},
+    {3249,3263,3264,3232,3504,2992}, {3250,3248,3265,3233,3505,2993}, {3251,3249,3266,3234,3506,2994}, {3252,3250,3267,3235,3507,2995},
+    {3253,3251,3268,3236,3508,2996}, {3254,3252,3269,3237,3509,2997}, {3255,3253,3270,3238,3510,2998}, {3256,3254,3271,3239,3511,2999},
+    {3257,3255,3272,3240,3512,3000}, {3258,3256,3273,3241,3513,3001}, {3259,3257,3274,3242,3514,3002}, {3260,3258,3275,3243,3515,3003},
+    {3261,3259,3276,3244,3516,3004}, {3262,3260,3277,3245,3517,3005}, {3263,3261,3278,3246,3518,3006}, {3248,3262,3279,3247,3519,3007},
+    {3265,3279,3280,3248,3520,3008}, {3266,3264,3281,3249,3521,3009}, {3267,3265,3282,3250,3522,3010}, {3268,3266,3283,3251,3523,3011},
+    {3269,3267,3284,3252,3524,3012}, {3270,3268,3285,3253,3525,3013}, {3271,3269,3286,3254,3526,3014}, {3272,3270,3287,3255,3527,3015},
+    {3273,3271,3288,3256,3528,3016}, {3274,3272,3289,3257,3529,3017}, {3275,3273,3290,3258,3530,3018}, {3276,3274,3291,3259,3531,3019},
+    {3277,3275,3292,3260,3532,3020}, {3278,3276,3293,3261,3533,3021}, {3279,3277,3294,3262,3534,3022}, {3264,3278,3295,3263,3535,3023},
+    {3281,3295,3296,3264,3536,3024}, {3282,3280,3297,3265,3537,3025}, {3283,3281,3298,3266,3538,3026}, {3284,3282,3299,3267,3539,3027},
+    {3285,3283,3300,3268,3540,3028}, {3286,3284,3301,3269,3541,3029}, {3287,3285,3302,3270,3542,3030}, {3288,3286,3303,3271,3543,3031},
+    {3289,3287,3304,3272,3544,3032}, {3290,3288,3305,3273,3545,3033}, {3291,3289,3306,3274,3546,3034}, {3292,3290,3307,3275,3547,3035},
+    {3293,3291,3308,3276,3548,3036}, {3294,3292,3309,3277,3549,3037}, {3295,3293,3310,3278,3550,3038}, {3280,3294,3311,3279,3551,3039},
+    {3297,3311,3312,3280,3552,3040}, {3298,3296,3313,3281,3553,3041}, {3299,3297,3314,3282,3554,3042}, {3300,3298,3315,3283,3555,3043},
+    {3301,3299,3316,3284,3556,3044}, {3302,3300,3317,3285,3557,3045}, {3303,3301,3318,3286,3558,3046}, {3304,3302,3319,3287,3559,3047},
+    {3305,3303,3320,3288,3560,3048}, {3306,3304,3321,3289,3561,3049}, {3307,3305,3322,3290,3562,3050}, {3308,3306,3323,3291,3563,3051},
+    {3309,3307,3324,3292,3564,3052}, {3310,3308,3325,3293,3565,3053}, {3311,3309,3326,3294,3566,3054}, {3296,3310,3327,3295,3567,3055},
+    {3313,3327,3072,3296,3568,3056}, {3314,3312,3073,3297,3569,3057}, {3315,3313,3074,3298,3570,3058}, {3316,3314,3075,3299,3571,3059},
+    {3317,3315,3076,3300,3572,3060}, {3318,3316,3077,3301,3573,3061}, {3319,3317,3078,3302,3574,3062}, {3320,3318,3079,3303,3575,3063},
+    {3321,3319,3080,3304,3576,3064}, {3322,3320,3081,3305,3577,3065}, {3323,3321,3082,3306,3578,3066}, {3324,3322,3083,3307,3579,3067},
+    {3325,3323,3084,3308,3580,3068}, {3326,3324,3085,3309,3581,3069}, {3327,3325,3086,3310,3582,3070}, {3312,3326,3087,3311,3583,3071},
+    {3329,3343,3344,3568,3584,3072}, {3330,3328,3345,3569,3585,3073}, {3331,3329,3346,3570,3586,3074}, {3332,3330,3347,3571,3587,3075},
+    {3333,3331,3348,3572,3588,3076}, {3334,3332,3349,3573,3589,3077}, {3335,3333,3350,3574,3590,3078}, {3336,3334,3351,3575,3591,3079},
+    {3337,3335,3352,3576,3592,3080}, {3338,3336,3353,3577,3593,3081}, {3339,3337,3354,3578,3594,3082}, {3340,3338,3355,3579,3595,3083},
+    {3341,3339,3356,3580,3596,3084}, {3342,3340,3357,3581,3597,3085}, {3343,3341,3358,3582,3598,3086}, {3328,3342,3359,3583,3599,3087},
+    {3345,3359,3360,3328,3600,3088}, {3346,3344,3361,3329,3601,3089}, {3347,3345,3362,3330,3602,3090}, {3348,3346,3363,3331,3603,3091},
+    {3349,3347,3364,3332,3604,3092}, {3350,3348,3365,3333,3605,3093}, {3351,3349,3366,3334,3606,3094}, {3352,3350,3367,3335,3607,3095},
+    {3353,3351,3368,3336,3608,3096}, {3354,3352,3369,3337,3609,3097}, {3355,3353,3370,3338,3610,3098}, {3356,3354,3371,3339,3611,3099},
+    {3357,3355,3372,3340,3612,3100}, {3358,3356,3373,3341,3613,3101}, {3359,3357,3374,3342,3614,3102}, {3344,3358,3375,3343,3615,3103},
+    {3361,3375,3376,3344,3616,3104}, {3362,3360,3377,3345,3617,3105}, {3363,3361,3378,3346,3618,3106}, {3364,3362,3379,3347,3619,3107},
+    {3365,3363,3380,3348,3620,3108}, {3366,3364,3381,3349,3621,3109}, {3367,3365,3382,3350,3622,3110}, {3368,3366,3383,3351,3623,3111},
+    {3369,3367,3384,3352,3624,3112}, {3370,3368,3385,3353,3625,3113}, {3371,3369,3386,3354,3626,3114}, {3372,3370,3387,3355,3627,3115},
+    {3373,3371,3388,3356,3628,3116}, {3374,3372,3389,3357,3629,3117}, {3375,3373,3390,3358,3630,3118}, {3360,3374,3391,3359,3631,3119},
+    {3377,3391,3392,3360,3632,3120}, {3378,3376,3393,3361,3633,3121}, {3379,3377,3394,3362,3634,3122}, {3380,3378,3395,3363,3635,3123},
+    {3381,3379,3396,3364,3636,3124}, {3382,3380,3397,3365,3637,3125}, {3383,3381,3398,3366,3638,3126}, {3384,3382,3399,3367,3639,3127},
+    {3385,3383,3400,3368,3640,3128}, {3386,3384,3401,3369,3641,3129}, {3387,3385,3402,3370,3642,3130}, {3388,3386,3403,3371,3643,3131},
+    {3389,3387,3404,3372,3644,3132}, {3390,3388,3405,3373,3645,3133}, {3391,3389,3406,3374,3646,3134}, {3376,3390,3407,3375,3647,3135},
+    {3393,3407,3408,3376,3648,3136}, {3394,3392,3409,3377,3649,3137}, {3395,3393,3410,3378,3650,3138}, {3396,3394,3411,3379,3651,3139},
+    {3397,3395,3412,3380,3652,3140}, {3398,3396,3413,3381,3653,3141}, {3399,3397,3414,3382,3654,3142}, {3400,3398,3415,3383,3655,3143},
+    {3401,3399,3416,3384,3656,3144}, {3402,3400,3417,3385,3657,3145}, {3403,3401,3418,3386,3658,3146}, {3404,3402,3419,3387,3659,3147},
+    {3405,3403,3420,3388,3660,3148}, {3406,3404,3421,3389,3661,3149}, {3407,3405,3422,3390,3662,3150}, {3392,3406,3423,3391,3663,3151},
+    {3409,3423,3424,3392,3664,3152}, {3410,3408,3425,3393,3665,3153}, {3411,3409,3426,3394,3666,3154}, {3412,3410,3427,3395,3667,3155},
+    {3413,3411,3428,3396,3668,3156}, {3414,3412,3429,3397,3669,3157}, {3415,3413,3430,3398,3670,3158}, {3416,3414,3431,3399,3671,3159},
+    {3417,3415,3432,3400,3672,3160}, {3418,3416,3433,3401,3673,3161}, {3419,3417,3434,3402,3674,3162}, {3420,3418,3435,3403,3675,3163},
+    {3421,3419,3436,3404,3676,3164}, {3422,3420,3437,3405,3677,3165}, {3423,3421,3438,3406,3678,3166}, {3408,3422,3439,3407,3679,3167},
+    {3425,3439,3440,3408,3680,3168}, {3426,3424,3441,3409,3681,3169}, {3427,3425,3442,3410,3682,3170}, {3428,3426,3443,3411,3683,3171},
+    {3429,3427,3444,3412,3684,3172}, {3430,3428,3445,3413,3685,3173}, {3431,3429,3446,3414,3686,3174}, {3432,3430,3447,3415,3687,3175},
+    {3433,3431,3448,3416,3688,3176}, {3434,3432,3449,3417,3689,3177}, {3435,3433,3450,3418,3690,3178}, {3436,3434,3451,3419,3691,3179},
+    {3437,3435,3452,3420,3692,3180}, {3438,3436,3453,3421,3693,3181}, {3439,3437,3454,3422,3694,3182}, {3424,3438,3455,3423,3695,3183},
+    {3441,3455,3456,3424,3696,3184}, {3442,3440,3457,3425,3697,3185}, {3443,3441,3458,3426,3698,3186}, {3444,3442,3459,3427,3699,3187},
+    {3445,3443,3460,3428,3700,3188}, {3446,3444,3461,3429,3701,3189}, {3447,3445,3462,3430,3702,3190}, {3448,3446,3463,3431,3703,3191},
+    {3449,3447,3464,3432,3704,3192}, {3450,3448,3465,3433,3705,3193}, {3451,3449,3466,3434,3706,3194}, {3452,3450,3467,3435,3707,3195},
+    {3453,3451,3468,3436,3708,3196}, {3454,3452,3469,3437,3709,3197}, {3455,3453,3470,3438,3710,3198}, {3440,3454,3471,3439,3711,3199},
+    {3457,3471,3472,3440,3712,3200}, {3458,3456,3473,3441,3713,3201}, {3459,3457,3474,3442,3714,3202}, {3460,3458,3475,3443,3715,3203},
+    {3461,3459,3476,3444,3716,3204}, {3462,3460,3477,3445,3717,3205}, {3463,3461,3478,3446,3718,3206}, {3464,3462,3479,3447,3719,3207},
+    {3465,3463,3480,3448,3720,3208}, {3466,3464,3481,3449,3721,3209}, {3467,3465,3482,3450,3722,3210}, {3468,3466,3483,3451,3723,3211},
+    {3469,3467,3484,3452,3724,3212}, {3470,3468,3485,3453,3725,3213}, {3471,3469,3486,3454,3726,3214}, {3456,3470,3487,3455,3727,3215},
+    {3473,3487,3488,3456,3728,3216}, {3474,3472,3489,3457,3729,3217}, {3475,3473,3490,3458,3730,3218}, {3476,3474,3491,3459,3731,3219},
+    {3477,3475,3492,3460,3732,3220}, {3478,3476,3493,3461,3733,3221}, {3479,3477,3494,3462,3734,3222}, {3480,3478,3495,3463,3735,3223},
+    {3481,3479,3496,3464,3736,3224}, {3482,3480,3497,3465,3737,3225}, {3483,3481,3498,3466,3738,3226}, {3484,3482,3499,3467,3739,3227},
+    {3485,3483,3500,3468,3740,3228}, {3486,3484,3501,3469,3741,3229}, {3487,3485,3502,3470,3742,3230}, {3472,3486,3503,3471,3743,3231},
+    {3489,3503,3504,3472,3744,3232}, {3490,3488,3505,3473,3745,3233}, {3491,3489,3506,3474,3746,3234}, {3492,3490,3507,3475,3747,3235},
+    {3493,3491,3508,3476,3748,3236}, {3494,3492,3509,3477,3749,3237}, {3495,3493,3510,3478,3750,3238}, {3496,3494,3511,3479,3751,3239},
+    {3497,3495,3512,3480,3752,3240}, {3498,3496,3513,3481,3753,3241}, {3499,3497,3514,3482,3754,3242}, {3500,3498,3515,3483,3755,3243},
+    {3501,3499,3516,3484,3756,3244}, {3502,3500,3517,3485,3757,3245}, {3503,3501,3518,3486,3758,3246}, {3488,3502,3519,3487,3759,3247},
+    {3505,3519,3520,3488,3760,3248}, {3506,3504,3521,3489,3761,3249}, {3507,3505,3522,3490,3762,3250}, {3508,3506,3523,3491,3763,3251},
+    {3509,3507,3524,3492,3764,3252}, {3510,3508,3525,3493,3765,3253}, {3511,3509,3526,3494,3766,3254}, {3512,3510,3527,3495,3767,3255},
+    {3513,3511,3528,3496,3768,3256}, {3514,3512,3529,3497,3769,3257}, {3515,3513,3530,3498,3770,3258}, {3516,3514,3531,3499,3771,3259},
+    {3517,3515,3532,3500,3772,3260}, {3518,3516,3533,3501,3773,3261}, {3519,3517,3534,3502,3774,3262}, {3504,3518,3535,3503,3775,3263},
+    {3521,3535,3536,3504,3776,3264}, {3522,3520,3537,3505,3777,3265}, {3523,3521,3538,3506,3778,3266}, {3524,3522,3539,3507,3779,3267},
+    {3525,3523,3540,3508,3780,3268}, {3526,3524,3541,3509,3781,3269}, {3527,3525,3542,3510,3782,3270}, {3528,3526,3543,3511,3783,3271},
+    {3529,3527,3544,3512,3784,3272}, {3530,3528,3545,3513,3785,3273}, {3531,3529,3546,3514,3786,3274}, {3532,3530,3547,3515,3787,3275},
+    {3533,3531,3548,3516,3788,3276}, {3534,3532,3549,3517,3789,3277}, {3535,3533,3550,3518,3790,3278}, {3520,3534,3551,3519,3791,3279},
+    {3537,3551,3552,3520,3792,3280}, {3538,3536,3553,3521,3793,3281}, {3539,3537,3554,3522,3794,3282}, {3540,3538,3555,3523,3795,3283},
+    {3541,3539,3556,3524,3796,3284}, {3542,3540,3557,3525,3797,3285}, {3543,3541,3558,3526,3798,3286}, {3544,3542,3559,3527,3799,3287},
+    {3545,3543,3560,3528,3800,3288}, {3546,3544,3561,3529,3801,3289}, {3547,3545,3562,3530,3802,3290}, {3548,3546,3563,3531,3803,3291},
+    {3549,3547,3564,3532,3804,3292}, {3550,3548,3565,3533,3805,3293}, {3551,3549,3566,3534,3806,3294}, {3536,3550,3567,3535,3807,3295},
+    {3553,3567,3568,3536,3808,3296}, {3554,3552,3569,3537,3809,3297}, {3555,3553,3570,3538,3810,3298}, {3556,3554,3571,3539,3811,3299},
+    {3557,3555,3572,3540,3812,3300}, {3558,3556,3573,3541,3813,3301}, {3559,3557,3574,3542,3814,3302}, {3560,3558,3575,3543,3815,3303},
+    {3561,3559,3576,3544,3816,3304}, {3562,3560,3577,3545,3817,3305}, {3563,3561,3578,3546,3818,3306}, {3564,3562,3579,3547,3819,3307},
+    {3565,3563,3580,3548,3820,3308}, {3566,3564,3581,3549,3821,3309}, {3567,3565,3582,3550,3822,3310}, {3552,3566,3583,3551,3823,3311},
+    {3569,3583,3328,3552,3824,3312}, {3570,3568,3329,3553,3825,3313}, {3571,3569,3330,3554,3826,3314}, {3572,3570,3331,3555,3827,3315},
+    {3573,3571,3332,3556,3828,3316}, {3574,3572,3333,3557,3829,3317}, {3575,3573,3334,3558,3830,3318}, {3576,3574,3335,3559,3831,3319},
+    {3577,3575,3336,3560,3832,3320}, {3578,3576,3337,3561,3833,3321}, {3579,3577,3338,3562,3834,3322}, {3580,3578,3339,3563,3835,3323},
+    {3581,3579,3340,3564,3836,3324}, {3582,3580,3341,3565,3837,3325}, {3583,3581,3342,3566,3838,3326}, {3568,3582,3343,3567,3839,3327},
+    {3585,3599,3600,3824,3840,3328}, {3586,3584,3601,3825,3841,3329}, {3587,3585,3602,3826,3842,3330}, {3588,3586,3603,3827,3843,3331},
+    {3589,3587,3604,3828,3844,3332}, {3590,3588,3605,3829,3845,3333}, {3591,3589,3606,3830,3846,3334}, {3592,3590,3607,3831,3847,3335},
+    {3593,3591,3608,3832,3848,3336}, {3594,3592,3609,3833,3849,3337}, {3595,3593,3610,3834,3850,3338}, {3596,3594,3611,3835,3851,3339},
+    {3597,3595,3612,3836,3852,3340}, {3598,3596,3613,3837,3853,3341}, {3599,3597,3614,3838,3854,3342}, {3584,3598,3615,3839,3855,3343},
+    {3601,3615,3616,3584,3856,3344}, {3602,3600,3617,3585,3857,3345}, {3603,3601,3618,3586,3858,3346}, {3604,3602,3619,3587,3859,3347},
+    {3605,3603,3620,3588,3860,3348}, {3606,3604,3621,3589,3861,3349}, {3607,3605,3622,3590,3862,3350}, {3608,3606,3623,3591,3863,3351},
+    {3609,3607,3624,3592,3864,3352}, {3610,3608,3625,3593,3865,3353}, {3611,3609,3626,3594,3866,3354}, {3612,3610,3627,3595,3867,3355},
+    {3613,3611,3628,3596,3868,3356}, {3614,3612,3629,3597,3869,3357}, {3615,3613,3630,3598,3870,3358}, {3600,3614,3631,3599,3871,3359},
+    {3617,3631,3632,3600,3872,3360}, {3618,3616,3633,3601,3873,3361}, {3619,3617,3634,3602,3874,3362}, {3620,3618,3635,3603,3875,3363},
+    {3621,3619,3636,3604,3876,3364}, {3622,3620,3637,3605,3877,3365}, {3623,3621,3638,3606,3878,3366}, {3624,3622,3639,3607,3879,3367},
+    {3625,3623,3640,3608,3880,3368}, {3626,3624,3641,3609,3881,3369}, {3627,3625,3642,3610,3882,3370}, {3628,3626,3643,3611,3883,3371},
+    {3629,3627,3644,3612,3884,3372}, {3630,3628,3645,3613,3885,3373}, {3631,3629,3646,3614,3886,3374}, {3616,3630,3647,3615,3887,3375},
+    {3633,3647,3648,3616,3888,3376}, {3634,3632,3649,3617,3889,3377}, {3635,3633,3650,3618,3890,3378}, {3636,3634,3651,3619,3891,3379},
+    {3637,3635,3652,3620,3892,3380}, {3638,3636,3653,3621,3893,3381}, {3639,3637,3654,3622,3894,3382}, {3640,3638,3655,3623,3895,3383},
+    {3641,3639,3656,3624,3896,3384}, {3642,3640,3657,3625,3897,3385}, {3643,3641,3658,3626,3898,3386}, {3644,3642,3659,3627,3899,3387},
+    {3645,3643,3660,3628,3900,3388}, {3646,3644,3661,3629,3901,3389}, {3647,3645,3662,3630,3902,3390}, {3632,3646,3663,3631,3903,3391},
+    {3649,3663,3664,3632,3904,3392}, {3650,3648,3665,3633,3905,3393}, {3651,3649,3666,3634,3906,3394}, {3652,3650,3667,3635,3907,3395},
+    {3653,3651,3668,3636,3908,3396}, {3654,3652,3669,3637,3909,3397}, {3655,3653,3670,3638,3910,3398}, {3656,3654,3671,3639,3911,3399},
+    {3657,3655,3672,3640,3912,3400}, {3658,3656,3673,3641,3913,3401}, {3659,3657,3674,3642,3914,3402}, {3660,3658,3675,3643,3915,3403},
+    {3661,3659,3676,3644,3916,3404}, {3662,3660,3677,3645,3917,3405}, {3663,3661,3678,3646,3918,3406}, {3648,3662,3679,3647,3919,3407},
+    {3665,3679,3680,3648,3920,3408}, {3666,3664,3681,3649,3921,3409}, {3667,3665,3682,3650,3922,3410}, {3668,3666,3683,3651,3923,3411},
+    {3669,3667,3684,3652,3924,3412}, {3670,3668,3685,3653,3925,3413}, {3671,3669,3686,3654,3926,3414}, {3672,3670,3687,3655,3927,3415},
+    {3673,3671,3688,3656,3928,3416}, {3674,3672,3689,3657,3929,3417}, {3675,3673,3690,3658,3930,3418}, {3676,3674,3691,3659,3931,3419},
+    {3677,3675,3692,3660,3932,3420}, {3678,3676,3693,3661,3933,3421}, {3679,3677,3694,3662,3934,3422}, {3664,3678,3695,3663,3935,3423},
+    {3681,3695,3696,3664,3936,3424}, {3682,3680,3697,3665,3937,3425}, {3683,3681,3698,3666,3938,3426}, {3684,3682,3699,3667,3939,3427},
+    {3685,3683,3700,3668,3940,3428}, {3686,3684,3701,3669,3941,3429}, {3687,3685,3702,3670,3942,3430}, {3688,3686,3703,3671,3943,3431},
+    {3689,3687,3704,3672,3944,3432}, {3690,3688,3705,3673,3945,3433}, {3691,3689,3706,3674,3946,3434}, {3692,3690,3707,3675,3947,3435},
+    {3693,3691,3708,3676,3948,3436}, {3694,3692,3709,3677,3949,3437}, {3695,3693,3710,3678,3950,3438}, {3680,3694,3711,3679,3951,3439},
+    {3697,3711,3712,3680,3952,3440}, {3698,3696,3713,3681,3953,3441}, {3699,3697,3714,3682,3954,3442}, {3700,3698,3715,3683,3955,3443},
+    {3701,3699,3716,3684,3956,3444}, {3702,3700,3717,3685,3957,3445}, {3703,3701,3718,3686,3958,3446}, {3704,3702,3719,3687,3959,3447},
+    {3705,3703,3720,3688,3960,3448}, {3706,3704,3721,3689,3961,3449}, {3707,3705,3722,3690,3962,3450}, {3708,3706,3723,3691,3963,3451},
+    {3709,3707,3724,3692,3964,3452}, {3710,3708,3725,3693,3965,3453}, {3711,3709,3726,3694,3966,3454}, {3696,3710,3727,3695,3967,3455},
+    {3713,3727,3728,3696,3968,3456}, {3714,3712,3729,3697,3969,3457}, {3715,3713,3730,3698,3970,3458}, {3716,3714,3731,3699,3971,3459},
+    {3717,3715,3732,3700,3972,3460}, {3718,3716,3733,3701,3973,3461}, {3719,3717,3734,3702,3974,3462}, {3720,3718,3735,3703,3975,3463},
+    {3721,3719,3736,3704,3976,3464}, {3722,3720,3737,3705,3977,3465}, {3723,3721,3738,3706,3978,3466}, {3724,3722,3739,3707,3979,3467},
+    {3725,3723,3740,3708,3980,3468}, {3726,3724,3741,3709,3981,3469}, {3727,3725,3742,3710,3982,3470}, {3712,3726,3743,3711,3983,3471},
+    {3729,3743,3744,3712,3984,3472}, {3730,3728,3745,3713,3985,3473}, {3731,3729,3746,3714,3986,3474}, {3732,3730,3747,3715,3987,3475},
+    {3733,3731,3748,3716,3988,3476}, {3734,3732,3749,3717,3989,3477}, {3735,3733,3750,3718,3990,3478}, {3736,3734,3751,3719,3991,3479},
+    {3737,3735,3752,3720,3992,3480}, {3738,3736,3753,3721,3993,3481}, {3739,3737,3754,3722,3994,3482}, {3740,3738,3755,3723,3995,3483},
+    {3741,3739,3756,3724,3996,3484}, {3742,3740,3757,3725,3997,3485}, {3743,3741,3758,3726,3998,3486}, {3728,3742,3759,3727,3999,3487},
+    {3745,3759,3760,3728,4000,3488}, {3746,3744,3761,3729,4001,3489}, {3747,3745,3762,3730,4002,3490}, {3748,3746,3763,3731,4003,3491},
+    {3749,3747,3764,3732,4004,3492}, {3750,3748,3765,3733,4005,3493}, {3751,3749,3766,3734,4006,3494}, {3752,3750,3767,3735,4007,3495},
+    {3753,3751,3768,3736,4008,3496}, {3754,3752,3769,3737,4009,3497}, {3755,3753,3770,3738,4010,3498}, {3756,3754,3771,3739,4011,3499},
+    {3757,3755,3772,3740,4012,3500}, {3758,3756,3773,3741,4013,3501}, {3759,3757,3774,3742,4014,3502}, {3744,3758,3775,3743,4015,3503},
+    {3761,3775,3776,3744,4016,3504}, {3762,3760,3777,3745,4017,3505}, {3763,3761,3778,3746,4018,3506}, {3764,3762,3779,3747,4019,3507},
+    {3765,3763,3780,3748,4020,3508}, {3766,3764,3781,3749,4021,3509}, {3767,3765,3782,3750,4022,3510}, {3768,3766,3783,3751,4023,3511},
+    {3769,3767,3784,3752,4024,3512}, {3770,3768,3785,3753,4025,3513}, {3771,3769,3786,3754,4026,3514}, {3772,3770,3787,3755,4027,3515},
+    {3773,3771,3788,3756,4028,3516}, {3774,3772,3789,3757,4029,3517}, {3775,3773,3790,3758,4030,3518}, {3760,3774,3791,3759,4031,3519},
+    {3777,3791,3792,3760,4032,3520}, {3778,3776,3793,3761,4033,3521}, {3779,3777,3794,3762,4034,3522}, {3780,3778,3795,3763,4035,3523},
+    {3781,3779,3796,3764,4036,3524}, {3782,3780,3797,3765,4037,3525}, {3783,3781,3798,3766,4038,3526}, {3784,3782,3799,3767,4039,3527},
+    {3785,3783,3800,3768,4040,3528}, {3786,3784,3801,3769,4041,3529}, {3787,3785,3802,3770,4042,3530}, {3788,3786,3803,3771,4043,3531},
+    {3789,3787,3804,3772,4044,3532}, {3790,3788,3805,3773,4045,3533}, {3791,3789,3806,3774,4046,3534}, {3776,3790,3807,3775,4047,3535},
+    {3793,3807,3808,3776,4048,3536}, {3794,3792,3809,3777,4049,3537}, {3795,3793,3810,3778,4050,3538}, {3796,3794,3811,3779,4051,3539},
+    {3797,3795,3812,3780,4052,3540}, {3798,3796,3813,3781,4053,3541}, {3799,3797,3814,3782,4054,3542}, {3800,3798,3815,3783,4055,3543},
+    {3801,3799,3816,3784,4056,3544}, {3802,3800,3817,3785,4057,3545}, {3803,3801,3818,3786,4058,3546}, {3804,3802,3819,3787,4059,3547},
+    {3805,3803,3820,3788,4060,3548}, {3806,3804,3821,3789,4061,3549}, {3807,3805,3822,3790,4062,3550}, {3792,3806,3823,3791,4063,3551},
+    {3809,3823,3824,3792,4064,3552}, {3810,3808,3825,3793,4065,3553}, {3811,3809,3826,3794,4066,3554}, {3812,3810,3827,3795,4067,3555},
+    {3813,3811,3828,3796,4068,3556}, {3814,3812,3829,3797,4069,3557}, {3815,3813,3830,3798,4070,3558}, {3816,3814,3831,3799,4071,3559},
+    {3817,3815,3832,3800,4072,3560}, {3818,3816,3833,3801,4073,3561}, {3819,3817,3834,3802,4074,3562}, {3820,3818,3835,3803,4075,3563},
+    {3821,3819,3836,3804,4076,3564}, {3822,3820,3837,3805,4077,3565}, {3823,3821,3838,3806,4078,3566}, {3808,3822,3839,3807,4079,3567},
+    {3825,3839,3584,3808,4080,3568}, {3826,3824,3585,3809,4081,3569}, {3827,3825,3586,3810,4082,3570}, {3828,3826,3587,3811,4083,3571},
+    {3829,3827,3588,3812,4084,3572}, {3830,3828,3589,3813,4085,3573}, {3831,3829,3590,3814,4086,3574}, {3832,3830,3591,3815,4087,3575},
+    {3833,3831,3592,3816,4088,3576}, {3834,3832,3593,3817,4089,3577}, {3835,3833,3594,3818,4090,3578}, {3836,3834,3595,3819,4091,3579},
+    {3837,3835,3596,3820,4092,3580}, {3838,3836,3597,3821,4093,3581}, {3839,3837,3598,3822,4094,3582}, {3824,3838,3599,3823,4095,3583},
+    {3841,3855,3856,4080,0,3584}, {3842,3840,3857,4081,1,3585}, {3843,3841,3858,4082,2,3586}, {3844,3842,3859,4083,3,3587},
+    {3845,3843,3860,4084,4,3588}, {3846,3844,3861,4085,5,3589}, {3847,3845,3862,4086,6,3590}, {3848,3846,3863,4087,7,3591},
+    {3849,3847,3864,4088,8,3592}, {3850,3848,3865,4089,9,3593}, {3851,3849,3866,4090,10,3594}, {3852,3850,3867,4091,11,3595},
+    {3853,3851,3868,4092,12,3596}, {3854,3852,3869,4093,13,3597}, {3855,3853,3870,4094,14,3598}, {3840,3854,3871,4095,15,3599},
+    {3857,3871,3872,3840,16,3600}, {3858,3856,3873,3841,17,3601}, {3859,3857,3874,3842,18,3602}, {3860,3858,3875,3843,19,3603},
+    {3861,3859,3876,3844,20,3604}, {3862,3860,3877,3845,21,3605}, {3863,3861,3878,3846,22,3606}, {3864,3862,3879,3847,23,3607},
+    {3865,3863,3880,3848,24,3608}, {3866,3864,3881,3849,25,3609}, {3867,3865,3882,3850,26,3610}, {3868,3866,3883,3851,27,3611},
+    {3869,3867,3884,3852,28,3612}, {3870,3868,3885,3853,29,3613}, {3871,3869,3886,3854,30,3614}, {3856,3870,3887,3855,31,3615},
+    {3873,3887,3888,3856,32,3616}, {3874,3872,3889,3857,33,3617}, {3875,3873,3890,3858,34,3618}, {3876,3874,3891,3859,35,3619},
+    {3877,3875,3892,3860,36,3620}, {3878,3876,3893,3861,37,3621}, {3879,3877,3894,3862,38,3622}, {3880,3878,3895,3863,39,3623},
+    {3881,3879,3896,3864,40,3624}, {3882,3880,3897,3865,41,3625}, {3883,3881,3898,3866,42,3626}, {3884,3882,3899,3867,43,3627},
+    {3885,3883,3900,3868,44,3628}, {3886,3884,3901,3869,45,3629}, {3887,3885,3902,3870,46,3630}, {3872,3886,3903,3871,47,3631},
+    {3889,3903,3904,3872,48,3632}, {3890,3888,3905,3873,49,3633}, {3891,3889,3906,3874,50,3634}, {3892,3890,3907,3875,51,3635},
+    {3893,3891,3908,3876,52,3636}, {3894,3892,3909,3877,53,3637}, {3895,3893,3910,3878,54,3638}, {3896,3894,3911,3879,55,3639},
+    {3897,3895,3912,3880,56,3640}, {3898,3896,3913,3881,57,3641}, {3899,3897,3914,3882,58,3642}, {3900,3898,3915,3883,59,3643},
+    {3901,3899,3916,3884,60,3644}, {3902,3900,3917,3885,61,3645}, {3903,3901,3918,3886,62,3646}, {3888,3902,3919,3887,63,3647},
+    {3905,3919,3920,3888,64,3648}, {3906,3904,3921,3889,65,3649}, {3907,3905,3922,3890,66,3650}, {3908,3906,3923,3891,67,3651},
+    {3909,3907,3924,3892,68,3652}, {3910,3908,3925,3893,69,3653}, {3911,3909,3926,3894,70,3654}, {3912,3910,3927,3895,71,3655},
+    {3913,3911,3928,3896,72,3656}, {3914,3912,3929,3897,73,3657}, {3915,3913,3930,3898,74,3658}, {3916,3914,3931,3899,75,3659},
+    {3917,3915,3932,3900,76,3660}, {3918,3916,3933,3901,77,3661}, {3919,3917,3934,3902,78,3662}, {3904,3918,3935,3903,79,3663},
+    {3921,3935,3936,3904,80,3664}, {3922,3920,3937,3905,81,3665}, {3923,3921,3938,3906,82,3666}, {3924,3922,3939,3907,83,3667},
+    {3925,3923,3940,3908,84,3668}, {3926,3924,3941,3909,85,3669}, {3927,3925,3942,3910,86,3670}, {3928,3926,3943,3911,87,3671},
+    {3929,3927,3944,3912,88,3672}, {3930,3928,3945,3913,89,3673}, {3931,3929,3946,3914,90,3674}, {3932,3930,3947,3915,91,3675},
+    {3933,3931,3948,3916,92,3676}, {3934,3932,3949,3917,93,3677}, {3935,3933,3950,3918,94,3678}, {3920,3934,3951,3919,95,3679},
+    {3937,3951,3952,3920,96,3680}, {3938,3936,3953,3921,97,3681}, {3939,3937,3954,3922,98,3682}, {3940,3938,3955,3923,99,3683},
+    {3941,3939,3956,3924,100,3684}, {3942,3940,3957,3925,101,3685}, {3943,3941,3958,3926,102,3686}, {3944,3942,3959,3927,103,3687},
+    {3945,3943,3960,3928,104,3688}, {3946,3944,3961,3929,105,3689}, {3947,3945,3962,3930,106,3690}, {3948,3946,3963,3931,107,3691},
+    {3949,3947,3964,3932,108,3692}, {3950,3948,3965,3933,109,3693}, {3951,3949,3966,3934,110,3694}, {3936,3950,3967,3935,111,3695},
+    {3953,3967,3968,3936,112,3696}, {3954,3952,3969,3937,113,3697}, {3955,3953,3970,3938,114,3698}, {3956,3954,3971,3939,115,3699},
+    {3957,3955,3972,3940,116,3700}, {3958,3956,3973,3941,117,3701}, {3959,3957,3974,3942,118,3702}, {3960,3958,3975,3943,119,3703},
+    {3961,3959,3976,3944,120,3704}, {3962,3960,3977,3945,121,3705}, {3963,3961,3978,3946,122,3706}, {3964,3962,3979,3947,123,3707},
+    {3965,3963,3980,3948,124,3708}, {3966,3964,3981,3949,125,3709}, {3967,3965,3982,3950,126,3710}, {3952,3966,3983,3951,127,3711},
+    {3969,3983,3984,3952,128,3712}, {3970,3968,3985,3953,129,3713}, {3971,3969,3986,3954,130,3714}, {3972,3970,3987,3955,131,3715},
+    {3973,3971,3988,3956,132,3716}, {3974,3972,3989,3957,133,3717}, {3975,3973,3990,3958,134,3718}, {3976,3974,3991,3959,135,3719},
+    {3977,3975,3992,3960,136,3720}, {3978,3976,3993,3961,137,3721}, {3979,3977,3994,3962,138,3722}, {3980,3978,3995,3963,139,3723},
+    {3981,3979,3996,3964,140,3724}, {3982,3980,3997,3965,141,3725}, {3983,3981,3998,3966,142,3726}, {3968,3982,3999,3967,143,3727},
+    {3985,3999,4000,3968,144,3728}, {3986,3984,4001,3969,145,3729}, {3987,3985,4002,3970,146,3730}, {3988,3986,4003,3971,147,3731},
+    {3989,3987,4004,3972,148,3732}, {3990,3988,4005,3973,149,3733}, {3991,3989,4006,3974,150,3734}, {3992,3990,4007,3975,151,3735},
+    {3993,3991,4008,3976,152,3736}, {3994,3992,4009,3977,153,3737}, {3995,3993,4010,3978,154,3738}, {3996,3994,4011,3979,155,3739},
+    {3997,3995,4012,3980,156,3740}, {3998,3996,4013,3981,157,3741}, {3999,3997,4014,3982,158,3742}, {3984,3998,4015,3983,159,3743},
+    {4001,4015,4016,3984,160,3744}, {4002,4000,4017,3985,161,3745}, {4003,4001,4018,3986,162,3746}, {4004,4002,4019,3987,163,3747},
+    {4005,4003,4020,3988,164,3748}, {4006,4004,4021,3989,165,3749}, {4007,4005,4022,3990,166,3750}, {4008,4006,4023,3991,167,3751},
+    {4009,4007,4024,3992,168,3752}, {4010,4008,4025,3993,169,3753}, {4011,4009,4026,3994,170,3754}, {4012,4010,4027,3995,171,3755},
+    {4013,4011,4028,3996,172,3756}, {4014,4012,4029,3997,173,3757}, {4015,4013,4030,3998,174,3758}, {4000,4014,4031,3999,175,3759},
+    {4017,4031,4032,4000,176,3760}, {4018,4016,4033,4001,177,3761}, {4019,4017,4034,4002,178,3762}, {4020,4018,4035,4003,179,3763},
+    {4021,4019,4036,4004,180,3764}, {4022,4020,4037,4005,181,3765}, {4023,4021,4038,4006,182,3766}, {4024,4022,4039,4007,183,3767},
+    {4025,4023,4040,4008,184,3768}, {4026,4024,4041,4009,185,3769}, {4027,4025,4042,4010,186,3770}, {4028,4026,4043,4011,187,3771},
+    {4029,4027,4044,4012,188,3772}, {4030,4028,4045,4013,189,3773}, {4031,4029,4046,4014,190,3774}, {4016,4030,4047,4015,191,3775},
+    {4033,4047,4048,4016,192,3776}, {4034,4032,4049,4017,193,3777}, {4035,4033,4050,4018,194,3778}, {4036,4034,4051,4019,195,3779},
+    {4037,4035,4052,4020,196,3780}, {4038,4036,4053,4021,197,3781}, {4039,4037,4054,4022,198,3782}, {4040,4038,4055,4023,199,3783},
+    {4041,4039,4056,4024,200,3784}, {4042,4040,4057,4025,201,3785}, {4043,4041,4058,4026,202,3786}, {4044,4042,4059,4027,203,3787},
+    {4045,4043,4060,4028,204,3788}, {4046,4044,4061,4029,205,3789}, {4047,4045,4062,4030,206,3790}, {4032,4046,4063,4031,207,3791},
+    {4049,4063,4064,4032,208,3792}, {4050,4048,4065,4033,209,3793}, {4051,4049,4066,4034,210,3794}, {4052,4050,4067,4035,211,3795},
+    {4053,4051,4068,4036,212,3796}, {4054,4052,4069,4037,213,3797}, {4055,4053,4070,4038,214,3798}, {4056,4054,4071,4039,215,3799},
+    {4057,4055,4072,4040,216,3800}, {4058,4056,4073,4041,217,3801}, {4059,4057,4074,4042,218,3802}, {4060,4058,4075,4043,219,3803},
+    {4061,4059,4076,4044,220,3804}, {4062,4060,4077,4045,221,3805}, {4063,4061,4078,4046,222,3806}, {4048,4062,4079,4047,223,3807},
+    {4065,4079,4080,4048,224,3808}, {4066,4064,4081,4049,225,3809}, {4067,4065,4082,4050,226,3810}, {4068,4066,4083,4051,227,3811},
+    {4069,4067,4084,4052,228,3812}, {4070,4068,4085,4053,229,3813}, {4071,4069,4086,4054,230,3814}, {4072,4070,4087,4055,231,3815},
+    {4073,4071,4088,4056,232,3816}, {4074,4072,4089,4057,233,3817}, {4075,4073,4090,4058,234,3818}, {4076,4074,4091,4059,235,3819},
+    {4077,4075,4092,4060,236,3820}, {4078,4076,4093,4061,237,3821}, {4079,4077,4094,4062,238,3822}, {4064,4078,4095,4063,239,3823},
+    {4081,4095,3840,4064,240,3824}, {4082,4080,3841,4065,241,3825}, {4083,4081,3842,4066,242,3826}, {4084,4082,3843,4067,243,3827},
+    {4085,4083,3844,4068,244,3828}, {4086,4084,3845,4069,245,3829}, {4087,4085,3846,4070,246,3830}, {4088,4086,3847,4071,247,3831},
+    {4089,4087,3848,4072,248,3832}, {4090,4088,3849,4073,249,3833}, {4091,4089,3850,4074,250,3834}, {4092,4090,3851,4075,251,3835},
+    {4093,4091,3852,4076,252,3836}, {4094,4092,3853,4077,253,3837}, {4095,4093,3854,4078,254,3838}, {4080,4094,3855,4079,255,3839},
+};
+
+// Direction out of every cell along a Hamiltonian cycle, an index into grid_dirs
+static const unsigned char grid_cycle_dir[GRID_CELLS] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
@@ -2,23 +2,44 @@
 #define NOB_STRIP_PREFIX
 #include "nob.h"
 
+#include <math.h>
+
 typedef enum {
     TARGET_LINUX,
     TARGET_WEB,
     TARGET_WINDOWS,
+    TARGET_SERVER,
     COUNT_TARGETS,
 } Target;
 
 const char *target_as_cstr(Target target) {
-    static_assert(COUNT_TARGETS == 3, "Please update after adding a new target");
+    static_assert(COUNT_TARGETS == 4, "Please update after adding a new target");
     switch (target) {
         case TARGET_LINUX: return "linux";
         case TARGET_WINDOWS: return "windows";
         case TARGET_WEB: return "web";
+        case TARGET_SERVER: return "server";
         default: UNREACHABLE("invalid target");
     }
 }
 
+typedef enum {
+    BUILD_DEBUG,
+    BUILD_RELEASE,
+    BUILD_RELWITHDEBINFO,
+    COUNT_BUILD_PROFILES,
+} Build_Profile;
+
+const char *build_profile_as_cstr(Build_Profile profile) {
+    static_assert(COUNT_BUILD_PROFILES == 3, "Please update after adding a new build profile");
+    switch (profile) {
+        case BUILD_DEBUG: return "debug";
+        case BUILD_RELEASE: return "release";
+        case BUILD_RELWITHDEBINFO: return "relwithdebinfo";
+        default: UNREACHABLE("invalid build profile");
+    }
+}
+
 #ifdef _WIN32
 Target default_target = TARGET_WINDOWS;
 #else
@@ -27,19 +48,927 @@ Target default_target = TARGET_LINUX;
 
 void usage(FILE *stream, const char *program_name) {
     fprintf(stream, "Usage: %s [OPTIONS]\n", program_name);
+    fprintf(stream, "       %s bench [BENCH_OPTIONS]\n", program_name);
+    fprintf(stream, "       %s pgo\n", program_name);
+    fprintf(stream, "    COMMANDS:\n");
+    fprintf(stream, "      bench - Build and run the microbenchmarks of the simulation core for every grid size in grid_sizes\n");
+    fprintf(stream, "      pgo - Build the game with profile-guided optimization of the simulation core, trained on the benchmarks, and report the speedup\n");
+    fprintf(stream, "    BENCH_OPTIONS:\n");
+    fprintf(stream, "      --save-baseline - Keep the results as the baseline for later comparisons\n");
+    fprintf(stream, "      --compare - Compare the results against the baseline and fail on significant regressions\n");
     fprintf(stream, "    OPTIONS:\n");
     fprintf(stream, "      -h, --help - Print this help message\n");
-    fprintf(stream, "      -r - Run game after building\n");
-    static_assert(COUNT_TARGETS == 3, "Please update usage after adding a new target");
-    fprintf(stream, "      -t <target> - Build for a specific target. Possible targets include:\n");
+    fprintf(stream, "      -r - Run game after building. Needs a single target and profile\n");
+    fprintf(stream, "      --zones - Record profiling zones and print a summary on exit\n");
+    fprintf(stream, "      --perf - Read hardware performance counters per tick and per frame and print them on exit. Linux only\n");
+    fprintf(stream, "      --allocs - Count heap allocations per tick and per frame and print them on exit. Not available on web\n");
+    fprintf(stream, "      --hotreload - Put the simulation core into libsnake.so, which the running game reloads whenever it is rebuilt. Linux only\n");
+    static_assert(COUNT_TARGETS == 4, "Please update usage after adding a new target");
+    fprintf(stream, "      -t <targets> - Build for specific targets, a comma separated list or `all`. Possible targets include:\n");
     fprintf(stream, "        linux\n");
     fprintf(stream, "        windows\n");
     fprintf(stream, "        web\n");
+    fprintf(stream, "        server - headless simulation for linux, without raylib\n");
     fprintf(stream, "      If this option is not provided, the default target is `%s`\n", target_as_cstr(default_target));
+    static_assert(COUNT_BUILD_PROFILES == 3, "Please update usage after adding a new build profile");
+    fprintf(stream, "      -p <profiles> - Build with specific profiles, into ./build/<profile>/, a comma separated list or `all`. Possible profiles include:\n");
+    fprintf(stream, "        debug - no optimizations (default)\n");
+    fprintf(stream, "        release - -O3 with link-time optimization and without asserts, what gets shipped\n");
+    fprintf(stream, "        relwithdebinfo - -O2 with debug info and asserts, for profiling\n");
+    fprintf(stream, "      Several targets or profiles are built concurrently, as many at a time as there are cores, with the\n");
+    fprintf(stream, "      output of each in ./build/<profile>/<target>.log. The first failure stops any further builds\n");
+    fprintf(stream, "      --native - Optimize for the CPU of this machine (-march=native). The binary may not run anywhere else\n");
+}
+
+bool zones = false;
+bool allocs = false;
+bool perf = false;
+bool native = false;
+bool hotreload = false;
+
+void common_cflags(Cmd *cmd, Build_Profile profile) {
+    cmd_append(cmd, "-Wall", "-Wextra");
+    static_assert(COUNT_BUILD_PROFILES == 3, "Please update this `switch` statement when adding a new build profile");
+    switch (profile) {
+        case BUILD_DEBUG:
+            cmd_append(cmd, "-g");
+            break;
+        case BUILD_RELEASE:
+            cmd_append(cmd, "-O3", "-flto", "-DNDEBUG");
+            break;
+        case BUILD_RELWITHDEBINFO:
+            cmd_append(cmd, "-O2", "-g");
+            break;
+        default:
+            UNREACHABLE("invalid build profile");
+    }
+    if (native) cmd_append(cmd, "-march=native");
+    if (zones) cmd_append(cmd, "-DPROFILE_ZONES");
+    if (allocs) cmd_append(cmd, "-DALLOC_STATS");
+    if (perf) cmd_append(cmd, "-DPERF_COUNTERS");
+}
+
+// Translation units in ./src/, each compiled into an object of its own
+const char *game_sources[] = {"main", "snake", "bot", "profile", "alloc", "perf", "nob_impl", "hotreload"};
+// The server has no window, so it links neither raylib nor the renderer
+const char *server_sources[] = {"server", "snake", "bot", "profile", "alloc", "perf", "nob_impl"};
+// The source that goes into libsnake.so in a hot reload build, instead of the executable
+#define LIBSNAKE_SOURCE "snake"
+
+// Routes the allocator through src/alloc.c, see alloc.h
+void alloc_ldflags(Cmd *cmd) {
+    cmd_append(cmd, "-Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc");
+}
+
+// Every GRID_SIZE the code gets built with. The game uses the first one, the default of
+// src/common.h, the benchmarks all of them.
+int grid_sizes[] = {10, 16, 32, 64};
+
+#define GEN_DIR "./build/gen/"
+
+void include_flags(Cmd *cmd) {
+    cmd_append(cmd, "-I.", "-I./raylib/", "-I"GEN_DIR);
+}
+
+// Directions the neighbors of a cell are listed in, the same order as grid_dirs in src/grid.h
+int grid_dir_deltas[6][3] = {
+    { 1, 0, 0 }, { -1, 0, 0 },
+    { 0, 1, 0 }, { 0, -1, 0 },
+    { 0, 0, 1 }, { 0, 0, -1 },
+};
+
+void gen_table_begin(String_Builder *sb, const char *type, const char *name, const char *dims) {
+    sb_appendf(sb, "static const %s %s%s = {", type, name, dims);
+}
+
+void gen_table_end(String_Builder *sb) {
+    sb_appendf(sb, "\n};\n\n");
+}
+
+// Leaves the file alone when it already says the same, so its mtime, and with it every object
+// built from it, stays as it is however often nob.c changes
+bool gen_write_if_changed(const char *path, String_Builder sb) {
+    int exists = file_exists(path);
+    if (exists < 0) return false;
+    if (exists) {
+        String_Builder old = {0};
+        if (!read_entire_file(path, &old)) return false;
+        bool same = old.count == sb.count && memcmp(old.items, sb.items, sb.count) == 0;
+        sb_free(old);
+        if (same) return true;
+    }
+    nob_log(INFO, "generating %s", path);
+    return write_entire_file(path, sb.items, sb.count);
+}
+
+// A line break every few elements keeps the header readable without making it much larger
+void gen_table_separator(String_Builder *sb, size_t i, size_t per_line) {
+    sb_appendf(sb, i % per_line == 0 ? "\n    " : " ");
+}
+
+bool gen_grid_tables_for(int grid_size, const char *path) {
+    size_t cells = (size_t)grid_size*grid_size*grid_size;
+    const char *cell_type = cells <= 65536 ? "uint16_t" : "uint32_t";
+
+    String_Builder sb = {0};
+    sb_appendf(&sb, "// Generated by nob.c, do not edit. Lookup tables for GRID_SIZE %d, see src/grid.h.\n", grid_size);
+    sb_appendf(&sb, "#define GRID_CELLS %zu\n\n", cells);
+    sb_appendf(&sb, "// Index of a cell, (z*GRID_SIZE + y)*GRID_SIZE + x\n");
+    sb_appendf(&sb, "typedef %s Grid_Cell;\n\n", cell_type);
+
+    gen_table_begin(&sb, "unsigned char", "grid_coords", "[GRID_CELLS][3]");
+    for (size_t i = 0; i < cells; i++) {
+        gen_table_separator(&sb, i, 8);
+        sb_appendf(&sb, "{%zu,%zu,%zu},", i % grid_size, i / grid_size % grid_size, i / grid_size / grid_size);
+    }
+    gen_table_end(&sb);
+
+    // The grid wraps around on every axis
+    gen_table_begin(&sb, "Grid_Cell", "grid_neighbors", "[GRID_CELLS][6]");
+    for (size_t i = 0; i < cells; i++) {
+        gen_table_separator(&sb, i, 4);
+        int cell[3] = { i % grid_size, i / grid_size % grid_size, i / grid_size / grid_size };
+        sb_appendf(&sb, "{");
+        for (size_t d = 0; d < ARRAY_LEN(grid_dir_deltas); d++) {
+            int n[3];
+            for (int axis = 0; axis < 3; axis++) n[axis] = (cell[axis] + grid_dir_deltas[d][axis] + grid_size) % grid_size;
+            sb_appendf(&sb, "%d%s", (n[2]*grid_size + n[1])*grid_size + n[0], d + 1 < ARRAY_LEN(grid_dir_deltas) ? "," : "");
+        }
+        sb_appendf(&sb, "},");
+    }
+    gen_table_end(&sb);
+
+    // The cycle src/bench.c follows: along x, one row up every GRID_SIZE steps, one layer forward every
+    // GRID_SIZE^2 steps, starting from cell 0. Keyed by cell, which is how it is looked up.
+    unsigned char *cycle = calloc(cells, 1);
+    bool *visited = calloc(cells, sizeof(bool));
+    int cell[3] = {0};
+    for (size_t k = 0; k < cells; k++) {
+        int dir = (k + 1) % (grid_size*grid_size) == 0 ? 4 : (k + 1) % grid_size == 0 ? 2 : 0;
+        size_t i = ((size_t)cell[2]*grid_size + cell[1])*grid_size + cell[0];
+        if (visited[i]) {
+            nob_log(ERROR, "the cycle of grid size %d visits cell %zu twice", grid_size, i);
+            return false;
+        }
+        visited[i] = true;
+        cycle[i] = dir;
+        for (int axis = 0; axis < 3; axis++) cell[axis] = (cell[axis] + grid_dir_deltas[dir][axis] + grid_size) % grid_size;
+    }
+    if (cell[0] != 0 || cell[1] != 0 || cell[2] != 0) {
+        nob_log(ERROR, "the cycle of grid size %d does not come back to where it started", grid_size);
+        return false;
+    }
+    sb_appendf(&sb, "// Direction out of every cell along a Hamiltonian cycle, an index into grid_dirs\n");
+    gen_table_begin(&sb, "unsigned char", "grid_cycle_dir", "[GRID_CELLS]");
+    for (size_t i = 0; i < cells; i++) {
+        gen_table_separator(&sb, i, 32);
+        sb_appendf(&sb, "%d,", cycle[i]);
+    }
+    gen_table_end(&sb);
+    free(cycle);
+    free(visited);
+
+    bool ok = gen_write_if_changed(path, sb);
+    sb_free(sb);
+    return ok;
+}
+
+// Writes the lookup tables of one size in grid_sizes, plus build/gen/grid_tables.h picking the
+// ones of the GRID_SIZE being compiled. Sizes nobody built yet are simply missing, the branches
+// of grid_tables.h that include them are never taken.
+bool gen_grid_tables(int grid_size) {
+    if (!mkdir_if_not_exists(GEN_DIR)) return false;
+    if (!gen_grid_tables_for(grid_size, temp_sprintf(GEN_DIR"grid_tables_%d.h", grid_size))) return false;
+
+    String_Builder sb = {0};
+    sb_appendf(&sb, "// Generated by nob.c, do not edit\n");
+    for (size_t i = 0; i < ARRAY_LEN(grid_sizes); i++) {
+        sb_appendf(&sb, "#%s GRID_SIZE == %d\n", i == 0 ? "if" : "elif", grid_sizes[i]);
+        sb_appendf(&sb, "    #include \"grid_tables_%d.h\"\n", grid_sizes[i]);
+    }
+    sb_appendf(&sb, "#else\n");
+    sb_appendf(&sb, "    #error \"No lookup tables for this GRID_SIZE, add it to grid_sizes in nob.c\"\n");
+    sb_appendf(&sb, "#endif\n");
+
+    bool ok = gen_write_if_changed(GEN_DIR"grid_tables.h", sb);
+    sb_free(sb);
+    return ok;
+}
+
+// Every profile builds into a directory of its own so they never overwrite each other
+const char *out_dir(Build_Profile profile) {
+    return temp_sprintf("./build/%s/", build_profile_as_cstr(profile));
+}
+
+File_Paths target_sources(Target target) {
+    if (target == TARGET_SERVER) return (File_Paths) { .items = server_sources, .count = ARRAY_LEN(server_sources) };
+    return (File_Paths) { .items = game_sources, .count = ARRAY_LEN(game_sources) };
+}
+
+typedef struct {
+    Target target;
+    Build_Profile profile;
+    Fd log;
+    size_t log_shown; // Bytes of the log already printed
+    size_t running;   // Processes of this job still going
+} Build_Job;
+
+typedef struct {
+    Build_Job *items;
+    size_t count, capacity;
+} Build_Jobs;
+
+const char *binary_path(Build_Job job) {
+    static_assert(COUNT_TARGETS == 4, "Please update this `switch` statement when adding a new target");
+    switch (job.target) {
+        case TARGET_LINUX: return temp_sprintf("%smain", out_dir(job.profile));
+        case TARGET_WINDOWS: return temp_sprintf("%smain.exe", out_dir(job.profile));
+        case TARGET_WEB: return temp_sprintf("%sindex.html", out_dir(job.profile));
+        case TARGET_SERVER: return temp_sprintf("%sserver", out_dir(job.profile));
+        default: UNREACHABLE("invalid target");
+    }
+}
+
+// Objects depend on the flags as well as on the sources, so every combination gets a directory
+const char *obj_dir(Build_Job job) {
+    return temp_sprintf("./build/obj/%s-%s%s%s%s%s%s/",
+                        target_as_cstr(job.target), build_profile_as_cstr(job.profile),
+                        zones ? "-zones" : "", allocs ? "-allocs" : "",
+                        perf ? "-perf" : "", native ? "-native" : "",
+                        hotreload ? "-hotreload" : "");
+}
+
+// The compiler output of a job that runs alongside others goes here instead of the terminal
+const char *build_log_path(Build_Job job) {
+    return temp_sprintf("%s%s.log", out_dir(job.profile), target_as_cstr(job.target));
+}
+
+void compiler(Cmd *cmd, Target target) {
+    static_assert(COUNT_TARGETS == 4, "Please update this `switch` statement when adding a new target");
+    switch (target) {
+        case TARGET_LINUX:
+        case TARGET_SERVER:
+#ifdef _WIN32
+            cmd_append(cmd, "wsl", "gcc");
+#else
+            cmd_append(cmd, "cc");
+#endif
+            break;
+        case TARGET_WINDOWS:
+            cmd_append(cmd, "x86_64-w64-mingw32-gcc");
+            break;
+        case TARGET_WEB:
+            cmd_append(cmd, "emcc");
+            break;
+        default:
+            UNREACHABLE("invalid target");
+    }
+}
+
+const char *libsnake_path(Build_Job job) {
+    return temp_sprintf("%slibsnake.so", out_dir(job.profile));
+}
+
+// Linked under another name and renamed into place once done, so the running game never loads
+// a half written library
+const char *libsnake_temp_path(Build_Job job) {
+    return temp_sprintf("%slibsnake.tmp.so", out_dir(job.profile));
+}
+
+// -MMD has the compiler list the headers it read in a .d file next to the object
+void compile_cmd(Cmd *cmd, Build_Job job, const char *name) {
+    compiler(cmd, job.target);
+    common_cflags(cmd, job.profile);
+    include_flags(cmd);
+    if (job.target == TARGET_WEB) cmd_append(cmd, "-DPLATFORM_WEB");
+    // raymath.h then defines everything the simulation uses right there, instead of in raylib
+    if (job.target == TARGET_SERVER) cmd_append(cmd, "-DRAYMATH_STATIC_INLINE");
+    if (hotreload) {
+        cmd_append(cmd, "-fPIC");
+        if (strcmp(name, LIBSNAKE_SOURCE) != 0) cmd_append(cmd, "-DHOTRELOAD");
+    }
+    cmd_append(cmd, "-MMD", "-c", temp_sprintf("./src/%s.c", name), "-o", temp_sprintf("%s%s.o", obj_dir(job), name));
+}
+
+void link_cmd(Cmd *cmd, Build_Job job) {
+    compiler(cmd, job.target);
+    common_cflags(cmd, job.profile);
+    cmd_append(cmd, "-o", binary_path(job));
+    File_Paths sources = target_sources(job.target);
+    for (size_t i = 0; i < sources.count; i++) {
+        if (hotreload && strcmp(sources.items[i], LIBSNAKE_SOURCE) == 0) continue;
+        cmd_append(cmd, temp_sprintf("%s%s.o", obj_dir(job), sources.items[i]));
+    }
+    static_assert(COUNT_TARGETS == 4, "Please update this `switch` statement when adding a new target");
+    switch (job.target) {
+        case TARGET_LINUX:
+            if (hotreload) {
+                // libsnake.so gets raylib and the rest from the executable, so all of it has to be
+                // there and exported, not only what the executable itself happens to use
+                cmd_append(cmd, "-rdynamic", "-L./raylib/", "-Wl,--whole-archive", "-lraylib", "-Wl,--no-whole-archive");
+                cmd_append(cmd, "-lm", "-lpthread", "-ldl");
+            } else {
+                cmd_append(cmd, "-L./raylib/", "-lraylib", "-lm", "-lpthread");
+            }
+            if (allocs) alloc_ldflags(cmd);
+            break;
+        case TARGET_WINDOWS:
+            cmd_append(cmd, "-L./raylib/", "-lraylib.win", "-lm", "-lpthread");
+            cmd_append(cmd, "-lwinmm", "-lgdi32");
+            if (allocs) alloc_ldflags(cmd);
+            break;
+        case TARGET_WEB:
+            cmd_append(cmd, "./raylib/libraylib.web.a");
+            cmd_append(cmd, "-s", "USE_GLFW=3", "--shell-file", "raylib/minshell.html");
+            break;
+        case TARGET_SERVER:
+            cmd_append(cmd, "-lm", "-lpthread");
+            if (allocs) alloc_ldflags(cmd);
+            break;
+        default:
+            UNREACHABLE("invalid target");
+    }
+}
+
+void libsnake_link_cmd(Cmd *cmd, Build_Job job) {
+    compiler(cmd, job.target);
+    common_cflags(cmd, job.profile);
+    // The executable exports pointers under the same names as the functions of the library, which
+    // would take over the calls the library makes to its own functions without -Bsymbolic
+    cmd_append(cmd, "-shared", "-Wl,-Bsymbolic", "-o", libsnake_temp_path(job));
+    cmd_append(cmd, temp_sprintf("%s%s.o", obj_dir(job), LIBSNAKE_SOURCE), "-lm");
+}
+
+const char *raylib_library(Target target) {
+    static_assert(COUNT_TARGETS == 4, "Please update this `switch` statement when adding a new target");
+    switch (target) {
+        case TARGET_LINUX: return "./raylib/libraylib.a";
+        case TARGET_WINDOWS: return "./raylib/libraylib.win.a";
+        case TARGET_WEB: return "./raylib/libraylib.web.a";
+        case TARGET_SERVER: return NULL;
+        default: UNREACHABLE("invalid target");
+    }
 }
 
-void common_cflags(Cmd *cmd) {
-    cmd_append(cmd, "-Wall", "-Wextra", "-g");
+// An object is stale when its .d file is missing or one of the inputs listed there is
+// missing or newer than the object. Returns -1 on error like nob_needs_rebuild().
+int object_needs_rebuild(const char *object, const char *deps_path) {
+    if (file_exists(deps_path) != 1) return 1;
+
+    String_Builder sb = {0};
+    if (!read_entire_file(deps_path, &sb)) return -1;
+    // A Makefile rule, `object: source header... \` with the inputs split over several lines
+    String_View deps = sb_to_sv(sb);
+    sv_chop_by_delim(&deps, ':');
+    File_Paths inputs = {0};
+    int result = 0;
+    while (deps.count > 0) {
+        deps = sv_trim_left(deps);
+        size_t n = 0;
+        while (n < deps.count && !isspace(deps.data[n])) n++;
+        String_View input = sv_from_parts(deps.data, n);
+        deps.data += n;
+        deps.count -= n;
+        if (input.count == 0 || sv_eq(input, sv_from_cstr("\\"))) continue;
+
+        const char *input_path = temp_sv_to_cstr(input);
+        if (file_exists(input_path) != 1) {
+            // A header was removed or renamed, the compiler will tell if it is still needed
+            result = 1;
+            break;
+        }
+        da_append(&inputs, input_path);
+    }
+    if (result == 0) result = needs_rebuild(object, inputs.items, inputs.count);
+
+    da_free(inputs);
+    sb_free(sb);
+    return result;
+}
+
+// The binary of a profile is shared by every combination of flags, so it also has to be relinked
+// when it was last linked from the objects of another combination
+const char *link_stamp_path(Build_Job job) {
+    return temp_sprintf("%s%s.objs", out_dir(job.profile), target_as_cstr(job.target));
+}
+
+bool linked_from_same_objects(Build_Job job) {
+    String_Builder stamp = {0};
+    bool same_objects = file_exists(link_stamp_path(job)) == 1 &&
+                        read_entire_file(link_stamp_path(job), &stamp) &&
+                        sv_eq(sb_to_sv(stamp), sv_from_cstr(obj_dir(job)));
+    sb_free(stamp);
+    return same_objects;
+}
+
+int binary_needs_relink(Build_Job job) {
+    if (!linked_from_same_objects(job)) return 1;
+
+    File_Paths inputs = {0};
+    File_Paths sources = target_sources(job.target);
+    for (size_t i = 0; i < sources.count; i++) {
+        if (hotreload && strcmp(sources.items[i], LIBSNAKE_SOURCE) == 0) continue;
+        da_append(&inputs, temp_sprintf("%s%s.o", obj_dir(job), sources.items[i]));
+    }
+    if (raylib_library(job.target) != NULL) da_append(&inputs, raylib_library(job.target));
+    int result = needs_rebuild(binary_path(job), inputs.items, inputs.count);
+    da_free(inputs);
+    return result;
+}
+
+int libsnake_needs_relink(Build_Job job) {
+    if (!linked_from_same_objects(job)) return 1;
+    return needs_rebuild1(libsnake_path(job), temp_sprintf("%s%s.o", obj_dir(job), LIBSNAKE_SOURCE));
+}
+
+// Online cores, the most compiler processes worth running at once
+size_t nprocs(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? info.dwNumberOfProcessors : 1;
+#else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (size_t)n : 1;
+#endif
+}
+
+// Prints whatever the job wrote to its log since the last time
+void build_job_show_log(Build_Job *job) {
+    if (job->log == INVALID_FD) return;
+    const char *log_path = build_log_path(*job);
+    String_Builder sb = {0};
+    if (read_entire_file(log_path, &sb) && sb.count > job->log_shown) {
+        fprintf(stderr, "---- %s/%s (%s) ----\n", target_as_cstr(job->target), build_profile_as_cstr(job->profile), log_path);
+        fwrite(sb.items + job->log_shown, 1, sb.count - job->log_shown, stderr);
+        job->log_shown = sb.count;
+    }
+    sb_free(sb);
+}
+
+typedef struct {
+    Proc proc;
+    size_t job;
+} Build_Proc;
+
+typedef struct {
+    Build_Proc *items;
+    size_t count, capacity;
+} Build_Procs;
+
+// Waits for the oldest process. Its job's log is printed right away if it failed, otherwise once
+// nothing of that job is running anymore, so the output of a job comes as soon as it is done.
+bool build_procs_wait_oldest(Build_Procs *procs, Build_Jobs jobs) {
+    Build_Proc oldest = procs->items[0];
+    memmove(procs->items, procs->items + 1, (procs->count - 1)*sizeof(*procs->items));
+    procs->count--;
+
+    Build_Job *job = &jobs.items[oldest.job];
+    bool ok = proc_wait(oldest.proc);
+    job->running--;
+    if (!ok || job->running == 0) build_job_show_log(job);
+    return ok;
+}
+
+bool build_procs_wait_all(Build_Procs *procs, Build_Jobs jobs) {
+    bool ok = true;
+    while (procs->count > 0) ok = build_procs_wait_oldest(procs, jobs) && ok;
+    return ok;
+}
+
+// Starts `cmd` for the job, after waiting for a slot when max_procs are already running
+bool build_procs_start(Build_Procs *procs, Build_Jobs jobs, size_t job_index, Cmd *cmd, size_t max_procs) {
+    bool ok = true;
+    while (procs->count >= max_procs) ok = build_procs_wait_oldest(procs, jobs) && ok;
+    if (!ok) {
+        cmd->count = 0;
+        return false;
+    }
+
+    Build_Job *job = &jobs.items[job_index];
+    Proc proc = cmd_run_async_redirect(*cmd, (Cmd_Redirect) {.fderr = job->log != INVALID_FD ? &job->log : NULL});
+    cmd->count = 0;
+    if (proc == INVALID_PROC) return false;
+    da_append(procs, ((Build_Proc) { .proc = proc, .job = job_index }));
+    job->running++;
+    return true;
+}
+
+// Compiles the stale objects of every job, then relinks the binaries that are out of date, at
+// most nprocs() processes at a time. A failed batch stops any new process from being started.
+// When there are several jobs the output of each goes to its log, printed once they are done.
+bool build_jobs(Build_Jobs jobs) {
+    size_t max_procs = nprocs();
+    bool logs = jobs.count > 1;
+    if (!mkdir_if_not_exists("./build/obj/")) return false;
+    da_foreach(Build_Job, job, &jobs) {
+        if (!mkdir_if_not_exists(out_dir(job->profile))) return false;
+        if (!mkdir_if_not_exists(obj_dir(*job))) return false;
+        job->log = INVALID_FD;
+        job->log_shown = 0;
+        job->running = 0;
+        if (logs) {
+            job->log = fd_open_for_write(build_log_path(*job));
+            if (job->log == INVALID_FD) return false;
+        }
+    }
+
+    Cmd cmd = {0};
+    Build_Procs procs = {0};
+    bool ok = true;
+    size_t compiled = 0;
+    size_t objects = 0;
+    for (size_t i = 0; ok && i < jobs.count; i++) {
+        Build_Job *job = &jobs.items[i];
+        File_Paths sources = target_sources(job->target);
+        for (size_t j = 0; ok && j < sources.count; j++) {
+            objects += 1;
+            const char *object = temp_sprintf("%s%s.o", obj_dir(*job), sources.items[j]);
+            int rebuild = object_needs_rebuild(object, temp_sprintf("%s%s.d", obj_dir(*job), sources.items[j]));
+            if (rebuild < 0) ok = false;
+            if (rebuild <= 0) continue;
+
+            compile_cmd(&cmd, *job, sources.items[j]);
+            ok = build_procs_start(&procs, jobs, i, &cmd, max_procs);
+            compiled += 1;
+        }
+    }
+    ok = build_procs_wait_all(&procs, jobs) && ok;
+
+    size_t linked = 0;
+    for (size_t i = 0; ok && i < jobs.count; i++) {
+        Build_Job *job = &jobs.items[i];
+        int relink = binary_needs_relink(*job);
+        if (relink < 0) ok = false;
+        if (relink <= 0) continue;
+
+        link_cmd(&cmd, *job);
+        ok = build_procs_start(&procs, jobs, i, &cmd, max_procs);
+        linked += 1;
+    }
+    for (size_t i = 0; hotreload && ok && i < jobs.count; i++) {
+        Build_Job *job = &jobs.items[i];
+        int relink = libsnake_needs_relink(*job);
+        if (relink < 0) ok = false;
+        if (relink <= 0) continue;
+
+        libsnake_link_cmd(&cmd, *job);
+        ok = build_procs_start(&procs, jobs, i, &cmd, max_procs);
+        linked += 1;
+    }
+    ok = build_procs_wait_all(&procs, jobs) && ok;
+    if (ok) {
+        da_foreach(Build_Job, job, &jobs) {
+            if (hotreload && file_exists(libsnake_temp_path(*job)) == 1) {
+                if (!rename(libsnake_temp_path(*job), libsnake_path(*job))) return false;
+            }
+            const char *stamp = obj_dir(*job);
+            if (!write_entire_file(link_stamp_path(*job), stamp, strlen(stamp))) return false;
+        }
+    }
+    cmd_free(cmd);
+    da_free(procs);
+
+    if (logs) {
+        da_foreach(Build_Job, job, &jobs) fd_close(job->log);
+    }
+    if (!ok) {
+        nob_log(ERROR, "Build failed, not starting anything else");
+        return false;
+    }
+    nob_log(INFO, "Compiled %zu of %zu objects and linked %zu of %zu binaries, the rest was up to date",
+            compiled, objects, linked, hotreload ? 2*jobs.count : jobs.count);
+    return true;
+}
+
+#define BENCH_DIR "./build/bench/"
+#define BENCH_RESULTS BENCH_DIR"results.jsonl"
+#define BENCH_BASELINE "./build/bench-baseline.jsonl"
+// Every benchmark program is run this many times. Code layout and memory placement change from
+// one process to the next, which moves the timings far more than the spread inside a single run.
+#define BENCH_RUNS 5
+// A benchmark regressed when it got slower by more than this many MADs of both runs combined
+// and by more than BENCH_MIN_REGRESSION of its baseline. The first rules out noise, the second
+// differences too small to matter.
+#define BENCH_NOISE_MADS 3.0
+#define BENCH_MIN_REGRESSION 0.10
+// Benchmarks of the bot planners, one call is one plan. Their throughput is listed too.
+#define BENCH_PLAN_PREFIX "bot_plan_"
+
+typedef struct {
+    const char *name;
+    int grid;
+    size_t n;
+    double median_ns;
+    double mad_ns;
+} Bench_Entry;
+
+typedef struct {
+    Bench_Entry *items;
+    size_t count, capacity;
+} Bench_Entries;
+
+bool bench_load(const char *path, Bench_Entries *entries) {
+    String_Builder sb = {0};
+    if (!read_entire_file(path, &sb)) return false;
+
+    String_View content = sb_to_sv(sb);
+    for (size_t row = 1; content.count > 0; row++) {
+        String_View line = sv_trim(sv_chop_by_delim(&content, '\n'));
+        if (line.count == 0) continue;
+
+        char name[64];
+        Bench_Entry entry = {0};
+        if (sscanf(temp_sv_to_cstr(line), "{\"name\":\"%63[^\"]\",\"grid\":%d,\"n\":%zu,\"median_ns\":%lf,\"mad_ns\":%lf",
+                   name, &entry.grid, &entry.n, &entry.median_ns, &entry.mad_ns) != 5) {
+            nob_log(ERROR, "%s:%zu: invalid benchmark result", path, row);
+            return false;
+        }
+        entry.name = temp_strdup(name);
+        da_append(entries, entry);
+    }
+    free(sb.items);
+    return true;
+}
+
+int compare_doubles(const void *a, const void *b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+double median(double *xs, size_t count) {
+    qsort(xs, count, sizeof(*xs), compare_doubles);
+    return count % 2 == 1 ? xs[count/2] : (xs[count/2 - 1] + xs[count/2])/2;
+}
+
+bool bench_is_plan(const char *name) {
+    return strncmp(name, BENCH_PLAN_PREFIX, strlen(BENCH_PLAN_PREFIX)) == 0;
+}
+
+// Benchmarks always run on the host, hence no -t here
+bool bench(void) {
+    if (!mkdir_if_not_exists(BENCH_DIR)) return false;
+
+    Cmd cmd = {0};
+    String_Builder results = {0};
+    Bench_Entries plans = {0};
+    for (size_t i = 0; i < ARRAY_LEN(grid_sizes); i++) {
+        int grid_size = grid_sizes[i];
+        const char *exe = temp_sprintf(BENCH_DIR"bench_%d", grid_size);
+        if (!gen_grid_tables(grid_size)) return false;
+
+        // Allocations are always counted here, the bench program checks the tick path makes none.
+        // Like the server it does not need raylib, raymath.h is all of it the simulation uses.
+        cmd_append(&cmd, "cc", "-Wall", "-Wextra", "-g", "-O2", "-DALLOC_STATS", "-DRAYMATH_STATIC_INLINE");
+        cmd_append(&cmd, temp_sprintf("-DGRID_SIZE=%d", grid_size));
+        cmd_append(&cmd, "-o", exe);
+        cmd_append(&cmd, "./src/bench.c", "./src/snake.c", "./src/bot.c", "./src/alloc.c");
+        include_flags(&cmd);
+        cmd_append(&cmd, "-lm", "-lpthread");
+        alloc_ldflags(&cmd);
+        if (!cmd_run_sync_and_reset(&cmd)) return false;
+
+        Bench_Entries runs[BENCH_RUNS] = {0};
+        for (size_t run = 0; run < BENCH_RUNS; run++) {
+            const char *json = temp_sprintf(BENCH_DIR"bench_%d_%zu.jsonl", grid_size, run);
+            cmd_append(&cmd, exe, "--json", json);
+            if (!cmd_run_sync_and_reset(&cmd)) return false;
+            if (!bench_load(json, &runs[run])) return false;
+            if (runs[run].count != runs[0].count) {
+                nob_log(ERROR, "%s did not run the same benchmarks every time", exe);
+                return false;
+            }
+        }
+
+        // Median over the runs. The noise is whichever is larger: the spread inside a typical
+        // run or the spread between the runs.
+        for (size_t j = 0; j < runs[0].count; j++) {
+            double medians[BENCH_RUNS], mads[BENCH_RUNS];
+            for (size_t run = 0; run < BENCH_RUNS; run++) {
+                medians[run] = runs[run].items[j].median_ns;
+                mads[run] = runs[run].items[j].mad_ns;
+            }
+            double med = median(medians, BENCH_RUNS);
+            double mad = median(mads, BENCH_RUNS);
+            for (size_t run = 0; run < BENCH_RUNS; run++) {
+                medians[run] = fabs(medians[run] - med);
+            }
+            double spread = median(medians, BENCH_RUNS);
+
+            Bench_Entry *e = &runs[0].items[j];
+            sb_appendf(&results, "{\"name\":\"%s\",\"grid\":%d,\"n\":%zu,\"median_ns\":%.3f,\"mad_ns\":%.3f,\"runs\":%d",
+                       e->name, e->grid, e->n, med, spread > mad ? spread : mad, BENCH_RUNS);
+            if (bench_is_plan(e->name)) {
+                sb_appendf(&results, ",\"plans_per_s\":%.1f", 1e9/med);
+                da_append(&plans, ((Bench_Entry) { .name = e->name, .grid = e->grid, .n = e->n, .median_ns = med }));
+            }
+            sb_appendf(&results, "}\n");
+        }
+        for (size_t run = 0; run < BENCH_RUNS; run++) free(runs[run].items);
+    }
+
+    if (plans.count > 0) {
+        printf("%-16s %6s %8s %12s\n", "planner", "grid", "n", "plans/s");
+        da_foreach(Bench_Entry, e, &plans) {
+            printf("%-16s %6d %8zu %12.0f\n", e->name + strlen(BENCH_PLAN_PREFIX), e->grid, e->n, 1e9/e->median_ns);
+        }
+    }
+    da_free(plans);
+
+    if (!write_entire_file(BENCH_RESULTS, results.items, results.count)) return false;
+    nob_log(INFO, "Benchmark results saved to %s", BENCH_RESULTS);
+    return true;
+}
+
+// Profile-guided optimization of the simulation core. The bench program doubles as the training
+// workload: it plays seeded games on autopilot besides calling every hot function on its own.
+// Rendering needs a window and a GPU, so only src/snake.c and src/bot.c are trained.
+#define PGO_DIR "./build/pgo/"
+#define PGO_PROFILE_DIR PGO_DIR"profile"
+#define PGO_CORE_OBJ PGO_DIR"snake.o"
+#define PGO_BOT_OBJ PGO_DIR"bot.o"
+#define PGO_RUNS 3
+
+typedef enum {
+    PGO_NONE,
+    PGO_GENERATE,
+    PGO_USE,
+} Pgo_Mode;
+
+// Same flags as the release profile, the profile only applies to the code it was recorded from
+void pgo_cflags(Cmd *cmd, Pgo_Mode mode) {
+    // The bench program is linked without raylib, so raymath.h has to define what it uses
+    cmd_append(cmd, "cc", "-Wall", "-Wextra", "-O3", "-flto", "-DNDEBUG", "-DRAYMATH_STATIC_INLINE");
+    switch (mode) {
+        case PGO_NONE: break;
+        case PGO_GENERATE:
+            cmd_append(cmd, "-fprofile-generate="PGO_PROFILE_DIR);
+            break;
+        case PGO_USE:
+            // Everything but the core and the bot is built without a profile, which is expected
+            cmd_append(cmd, "-fprofile-use="PGO_PROFILE_DIR, "-fprofile-correction", "-Wno-missing-profile");
+            break;
+        default: UNREACHABLE("invalid PGO mode");
+    }
+}
+
+// The core and the bot go through object files at fixed paths, because that is what GCC names their
+// profiles after. Anything compiled in the same command as the link gets a profile named after the
+// executable instead, which differs between the training and the optimized build.
+bool pgo_build_bench(Cmd *cmd, Pgo_Mode mode, const char *exe) {
+    pgo_cflags(cmd, mode);
+    cmd_append(cmd, "-c", "./src/snake.c", "-o", PGO_CORE_OBJ);
+    include_flags(cmd);
+    if (!cmd_run_sync_and_reset(cmd)) return false;
+
+    pgo_cflags(cmd, mode);
+    cmd_append(cmd, "-c", "./src/bot.c", "-o", PGO_BOT_OBJ);
+    include_flags(cmd);
+    if (!cmd_run_sync_and_reset(cmd)) return false;
+
+    pgo_cflags(cmd, mode);
+    cmd_append(cmd, "-DALLOC_STATS");
+    cmd_append(cmd, "-o", exe);
+    cmd_append(cmd, "./src/bench.c", PGO_CORE_OBJ, PGO_BOT_OBJ, "./src/alloc.c");
+    include_flags(cmd);
+    cmd_append(cmd, "-lm", "-lpthread");
+    alloc_ldflags(cmd);
+    return cmd_run_sync_and_reset(cmd);
+}
+
+// Medians of every benchmark over PGO_RUNS runs of `exe`
+bool pgo_measure(Cmd *cmd, const char *exe, Bench_Entries *entries) {
+    Bench_Entries runs[PGO_RUNS] = {0};
+    for (size_t run = 0; run < PGO_RUNS; run++) {
+        const char *json = temp_sprintf("%s_%zu.jsonl", exe, run);
+        cmd_append(cmd, exe, "--json", json);
+        if (!cmd_run_sync_and_reset(cmd)) return false;
+        if (!bench_load(json, &runs[run])) return false;
+        if (runs[run].count != runs[0].count) {
+            nob_log(ERROR, "%s did not run the same benchmarks every time", exe);
+            return false;
+        }
+    }
+    for (size_t j = 0; j < runs[0].count; j++) {
+        double medians[PGO_RUNS];
+        for (size_t run = 0; run < PGO_RUNS; run++) medians[run] = runs[run].items[j].median_ns;
+        Bench_Entry entry = runs[0].items[j];
+        entry.median_ns = median(medians, PGO_RUNS);
+        da_append(entries, entry);
+    }
+    return true;
+}
+
+bool pgo(void) {
+    if (!mkdir_if_not_exists(PGO_DIR)) return false;
+    if (!mkdir_if_not_exists(PGO_PROFILE_DIR)) return false;
+
+    // GCC adds up new counts to whatever profile is already there, which may come from older code
+    File_Paths profiles = {0};
+    if (!read_entire_dir(PGO_PROFILE_DIR, &profiles)) return false;
+    da_foreach(const char *, name, &profiles) {
+        if (sv_end_with(sv_from_cstr(*name), ".gcda")) {
+            if (!delete_file(temp_sprintf(PGO_PROFILE_DIR"/%s", *name))) return false;
+        }
+    }
+
+    // Everything here is built with the default GRID_SIZE
+    if (!gen_grid_tables(grid_sizes[0])) return false;
+
+    Cmd cmd = {0};
+    if (!pgo_build_bench(&cmd, PGO_NONE, PGO_DIR"bench_base")) return false;
+    Bench_Entries base = {0};
+    if (!pgo_measure(&cmd, PGO_DIR"bench_base", &base)) return false;
+
+    nob_log(INFO, "Training");
+    if (!pgo_build_bench(&cmd, PGO_GENERATE, PGO_DIR"bench_train")) return false;
+    cmd_append(&cmd, PGO_DIR"bench_train");
+    if (!cmd_run_sync_and_reset(&cmd)) return false;
+
+    if (!pgo_build_bench(&cmd, PGO_USE, PGO_DIR"bench_pgo")) return false;
+    Bench_Entries optimized = {0};
+    if (!pgo_measure(&cmd, PGO_DIR"bench_pgo", &optimized)) return false;
+
+    // The game itself, with the trained core and bot from the last step
+    pgo_cflags(&cmd, PGO_USE);
+    cmd_append(&cmd, "-o", PGO_DIR"main");
+    cmd_append(&cmd, "./src/main.c", PGO_CORE_OBJ, PGO_BOT_OBJ, "./src/profile.c", "./src/alloc.c", "./src/perf.c", "./src/nob_impl.c");
+    include_flags(&cmd);
+    cmd_append(&cmd, "-L./raylib/", "-lraylib", "-lm", "-lpthread");
+    if (!cmd_run_sync_and_reset(&cmd)) return false;
+
+    if (base.count != optimized.count) {
+        nob_log(ERROR, "the benchmarks changed between the builds");
+        return false;
+    }
+    printf("%-16s %8s %12s %12s %9s\n", "name", "n", "base(ns)", "pgo(ns)", "speedup");
+    double *speedups = temp_alloc(base.count*sizeof(*speedups));
+    for (size_t i = 0; i < base.count; i++) {
+        Bench_Entry *b = &base.items[i];
+        Bench_Entry *o = &optimized.items[i];
+        speedups[i] = b->median_ns/o->median_ns;
+        printf("%-16s %8zu %12.2f %12.2f %8.2fx\n", b->name, b->n, b->median_ns, o->median_ns, speedups[i]);
+    }
+    printf("Median speedup: %.2fx\n", median(speedups, base.count));
+    nob_log(INFO, "Game built with the trained simulation core and bot in "PGO_DIR"main");
+    return true;
+}
+
+// The entry of the same benchmark on the same grid and n, if there is one
+Bench_Entry *bench_find(Bench_Entries *entries, const Bench_Entry *entry) {
+    da_foreach(Bench_Entry, it, entries) {
+        if (strcmp(it->name, entry->name) == 0 && it->grid == entry->grid && it->n == entry->n) return it;
+    }
+    return NULL;
+}
+
+// Returns the amount of significant regressions, or -1 on error
+int bench_compare(const char *baseline_path, const char *results_path) {
+    Bench_Entries baseline = {0};
+    Bench_Entries results = {0};
+    if (!bench_load(baseline_path, &baseline)) return -1;
+    if (!bench_load(results_path, &results)) return -1;
+
+    int regressions = 0;
+    printf("%-16s %6s %8s %12s %12s %9s\n", "name", "grid", "n", "base(ns)", "new(ns)", "delta");
+    da_foreach(Bench_Entry, r, &results) {
+        Bench_Entry *b = bench_find(&baseline, r);
+        if (b == NULL) {
+            printf("%-16s %6d %8zu %12s %12.2f %9s\n", r->name, r->grid, r->n, "-", r->median_ns, "new");
+            continue;
+        }
+        double base = b->median_ns;
+        double noise = b->mad_ns + r->mad_ns;
+        double delta = r->median_ns - base;
+        const char *verdict = "";
+        if (delta > BENCH_NOISE_MADS*noise && delta > BENCH_MIN_REGRESSION*base) {
+            verdict = "  REGRESSION";
+            regressions++;
+        } else if (-delta > BENCH_NOISE_MADS*noise && -delta > BENCH_MIN_REGRESSION*base) {
+            verdict = "  improvement";
+        }
+        printf("%-16s %6d %8zu %12.2f %12.2f %+8.1f%%%s\n", r->name, r->grid, r->n, base, r->median_ns,
+               100.0*delta/base, verdict);
+    }
+
+    // The same planner results as above, the other way up
+    bool any_plan = false;
+    da_foreach(Bench_Entry, r, &results) {
+        if (!bench_is_plan(r->name)) continue;
+        if (!any_plan) printf("\n%-16s %6s %8s %14s %14s %9s\n", "planner", "grid", "n", "base(plans/s)", "new(plans/s)", "delta");
+        any_plan = true;
+        Bench_Entry *b = bench_find(&baseline, r);
+        const char *name = r->name + strlen(BENCH_PLAN_PREFIX);
+        double rate = 1e9/r->median_ns;
+        if (b == NULL) {
+            printf("%-16s %6d %8zu %14s %14.0f %9s\n", name, r->grid, r->n, "-", rate, "new");
+            continue;
+        }
+        double base = 1e9/b->median_ns;
+        printf("%-16s %6d %8zu %14.0f %14.0f %+8.1f%%\n", name, r->grid, r->n, base, rate, 100.0*(rate - base)/base);
+    }
+    return regressions;
 }
 
 int main(int argc, char **argv) {
@@ -49,8 +978,50 @@ int main(int argc, char **argv) {
 
     const char *program_name = nob_shift(argv, argc);
 
+    if (argc > 0 && strcmp(argv[0], "pgo") == 0) {
+        return pgo() ? 0 : 1;
+    }
+
+    if (argc > 0 && strcmp(argv[0], "bench") == 0) {
+        shift(argv, argc);
+        bool save_baseline = false;
+        bool compare = false;
+        while (argc > 0) {
+            const char *arg = shift(argv, argc);
+            if (strcmp(arg, "--save-baseline") == 0) {
+                save_baseline = true;
+            } else if (strcmp(arg, "--compare") == 0) {
+                compare = true;
+            } else {
+                usage(stderr, program_name);
+                nob_log(ERROR, "unknown bench flag %s", arg);
+                return 1;
+            }
+        }
+        if (compare && file_exists(BENCH_BASELINE) != 1) {
+            nob_log(ERROR, "no baseline to compare against, run `%s bench --save-baseline` first", program_name);
+            return 1;
+        }
+
+        if (!bench()) return 1;
+        if (compare) {
+            int regressions = bench_compare(BENCH_BASELINE, BENCH_RESULTS);
+            if (regressions < 0) return 1;
+            if (regressions > 0) {
+                nob_log(ERROR, "%d benchmark(s) regressed against %s", regressions, BENCH_BASELINE);
+                return 1;
+            }
+            nob_log(INFO, "No significant regressions against %s", BENCH_BASELINE);
+        }
+        if (save_baseline) {
+            if (!copy_file(BENCH_RESULTS, BENCH_BASELINE)) return 1;
+        }
+        return 0;
+    }
+
     bool run = false;
-    Target target = default_target;
+    bool targets[COUNT_TARGETS] = {0};
+    bool profiles[COUNT_BUILD_PROFILES] = {0};
     while (argc > 0) {
         const char *arg = shift(argv, argc);
         if (strcmp(arg, "-h") == 0 || strcmp(arg, "--help") == 0) {
@@ -60,22 +1031,64 @@ int main(int argc, char **argv) {
             if (argc == 0) {
                 usage(stderr, program_name);
                 nob_log(ERROR, "-t flag requires an argument");
+                return 1;
             }
-            const char *target_name = shift(argv, argc);
-            static_assert(COUNT_TARGETS == 3, "Please update the -t flag when adding a new target");
-            if (strcmp(target_name, "linux") == 0) {
-                target = TARGET_LINUX;
-            } else if (strcmp(target_name, "windows") == 0) {
-                target = TARGET_WINDOWS;
-            } else if (strcmp(target_name, "web") == 0) {
-                target = TARGET_WEB;
-            } else {
+            String_View names = sv_from_cstr(shift(argv, argc));
+            while (names.count > 0) {
+                const char *target_name = temp_sv_to_cstr(sv_chop_by_delim(&names, ','));
+                static_assert(COUNT_TARGETS == 4, "Please update the -t flag when adding a new target");
+                if (strcmp(target_name, "all") == 0) {
+                    for (size_t i = 0; i < COUNT_TARGETS; i++) targets[i] = true;
+                } else if (strcmp(target_name, "linux") == 0) {
+                    targets[TARGET_LINUX] = true;
+                } else if (strcmp(target_name, "windows") == 0) {
+                    targets[TARGET_WINDOWS] = true;
+                } else if (strcmp(target_name, "web") == 0) {
+                    targets[TARGET_WEB] = true;
+                } else if (strcmp(target_name, "server") == 0) {
+                    targets[TARGET_SERVER] = true;
+                } else {
+                    usage(stderr, program_name);
+                    nob_log(ERROR, "unknown target %s", target_name);
+                    return 1;
+                }
+            }
+        } else if (strcmp(arg, "-p") == 0) {
+            if (argc == 0) {
                 usage(stderr, program_name);
-                nob_log(ERROR, "unknown target %s", target_name);
+                nob_log(ERROR, "-p flag requires an argument");
                 return 1;
             }
+            String_View names = sv_from_cstr(shift(argv, argc));
+            while (names.count > 0) {
+                const char *profile_name = temp_sv_to_cstr(sv_chop_by_delim(&names, ','));
+                static_assert(COUNT_BUILD_PROFILES == 3, "Please update the -p flag when adding a new build profile");
+                if (strcmp(profile_name, "all") == 0) {
+                    for (size_t i = 0; i < COUNT_BUILD_PROFILES; i++) profiles[i] = true;
+                } else if (strcmp(profile_name, "debug") == 0) {
+                    profiles[BUILD_DEBUG] = true;
+                } else if (strcmp(profile_name, "release") == 0) {
+                    profiles[BUILD_RELEASE] = true;
+                } else if (strcmp(profile_name, "relwithdebinfo") == 0) {
+                    profiles[BUILD_RELWITHDEBINFO] = true;
+                } else {
+                    usage(stderr, program_name);
+                    nob_log(ERROR, "unknown build profile %s", profile_name);
+                    return 1;
+                }
+            }
+        } else if (strcmp(arg, "--native") == 0) {
+            native = true;
         } else if (strcmp(arg, "-r") == 0) {
             run = true;
+        } else if (strcmp(arg, "--zones") == 0) {
+            zones = true;
+        } else if (strcmp(arg, "--allocs") == 0) {
+            allocs = true;
+        } else if (strcmp(arg, "--perf") == 0) {
+            perf = true;
+        } else if (strcmp(arg, "--hotreload") == 0) {
+            hotreload = true;
         } else {
             usage(stderr, program_name);
             nob_log(ERROR, "unknown flag %s", arg);
@@ -83,60 +1096,72 @@ int main(int argc, char **argv) {
         }
     }
 
-    Cmd cmd = {0};
-    static_assert(COUNT_TARGETS == 3, "Please update this `switch` statement when adding a new target");
-    switch (target) {
-        case TARGET_LINUX:
-#ifdef _WIN32
-            cmd_append(&cmd, "wsl", "gcc");
-#else
-            cmd_append(&cmd, "cc");
-#endif
-            common_cflags(&cmd);
-            cmd_append(&cmd, "-o", "./build/main");
-            cmd_append(&cmd, "./src/main.c");
-            cmd_append(&cmd, "-I.", "-I./raylib/");
-            cmd_append(&cmd, "-L./raylib/", "-lraylib", "-lm");
-            break;
-        case TARGET_WINDOWS:
-            cmd_append(&cmd, "x86_64-w64-mingw32-gcc");
-            common_cflags(&cmd);
-            cmd_append(&cmd, "-o", "./build/main.exe");
-            cmd_append(&cmd, "./src/main.c");
-            cmd_append(&cmd, "-I.", "-I./raylib/");
-            cmd_append(&cmd, "-L./raylib/", "-lraylib.win", "-lm");
-            cmd_append(&cmd, "-lwinmm", "-lgdi32");
-            break;
-        case TARGET_WEB:
-            cmd_append(&cmd, "emcc");
-            common_cflags(&cmd);
-            cmd_append(&cmd, "-o", "./build/index.html");
-            cmd_append(&cmd, "./src/main.c");
-            cmd_append(&cmd, "-I.", "-I./raylib/");
-            cmd_append(&cmd, "./raylib/libraylib.web.a");
-            cmd_append(&cmd, "-s", "USE_GLFW=3", "-DPLATFORM_WEB", "--shell-file", "raylib/minshell.html");
-            break;
-        default:
-            UNREACHABLE("invalid target");
+    bool any_target = false;
+    for (size_t t = 0; t < COUNT_TARGETS; t++) any_target = any_target || targets[t];
+    if (!any_target) targets[default_target] = true;
+    bool any_profile = false;
+    for (size_t p = 0; p < COUNT_BUILD_PROFILES; p++) any_profile = any_profile || profiles[p];
+    if (!any_profile) profiles[BUILD_DEBUG] = true;
+
+    Build_Jobs jobs = {0};
+    for (size_t t = 0; t < COUNT_TARGETS; t++) {
+        if (!targets[t]) continue;
+        for (size_t p = 0; p < COUNT_BUILD_PROFILES; p++) {
+            if (!profiles[p]) continue;
+            da_append(&jobs, ((Build_Job) {.target = t, .profile = p}));
+        }
     }
-    if (!cmd_run_sync_and_reset(&cmd)) return 1;
 
-    static_assert(COUNT_TARGETS == 3, "Please update this `switch` statement when adding a new target");
+    if (allocs && targets[TARGET_WEB]) {
+        nob_log(ERROR, "--allocs is not supported on web, its linker cannot wrap the allocator");
+        return 1;
+    }
+    if (perf && (targets[TARGET_WINDOWS] || targets[TARGET_WEB])) {
+        nob_log(ERROR, "--perf is only supported on linux, it needs perf_event_open");
+        return 1;
+    }
+    if (native && targets[TARGET_WEB]) {
+        nob_log(ERROR, "--native makes no sense on web, WebAssembly has no CPU to tune for");
+        return 1;
+    }
+    if (hotreload && (targets[TARGET_WINDOWS] || targets[TARGET_WEB] || targets[TARGET_SERVER])) {
+        nob_log(ERROR, "--hotreload is only supported for the linux target, it needs dlopen and a window to play in");
+        return 1;
+    }
+    if (hotreload && allocs) {
+        nob_log(ERROR, "--hotreload does not go with --allocs, the allocations made by libsnake.so would not be counted");
+        return 1;
+    }
+    if (run && jobs.count > 1) {
+        nob_log(ERROR, "-r needs a single target and profile, not %zu of them", jobs.count);
+        return 1;
+    }
+
+    // Every target builds with the default GRID_SIZE
+    if (!gen_grid_tables(grid_sizes[0])) return 1;
+    if (!build_jobs(jobs)) return 1;
+
     if (run) {
-        switch (target) {
+        Cmd cmd = {0};
+        const char *binary = binary_path(jobs.items[0]);
+        static_assert(COUNT_TARGETS == 4, "Please update this `switch` statement when adding a new target");
+        switch (jobs.items[0].target) {
             case TARGET_LINUX:
-                cmd_append(&cmd, "./build/main");
+                cmd_append(&cmd, binary);
                 break;
             case TARGET_WINDOWS:
-                cmd_append(&cmd, "wine", "./build/main.exe");
+                cmd_append(&cmd, "wine", binary);
                 break;
             case TARGET_WEB:
-                cmd_append(&cmd, "emrun", "./build/index.html");
+                cmd_append(&cmd, "emrun", binary);
+                break;
+            case TARGET_SERVER:
+                cmd_append(&cmd, binary);
                 break;
             default:
                 UNREACHABLE("invalid target");
         }
         if (!cmd_run_sync_and_reset(&cmd)) return 1;
-        return 0;
     }
+    return 0;
 }
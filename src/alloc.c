@@ -0,0 +1,47 @@
+#include <stdlib.h>
+
+#include "alloc.h"
+
+#ifdef ALLOC_STATS
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+_Thread_local size_t alloc_counter;
+
+void *__wrap_malloc(size_t size) {
+    alloc_counter++;
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size) {
+    alloc_counter++;
+    return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+    alloc_counter++;
+    return __real_realloc(ptr, size);
+}
+
+size_t alloc_count(void) {
+    return alloc_counter;
+}
+
+void alloc_track_begin(Alloc_Track *track) {
+    track->mark = alloc_counter;
+}
+
+void alloc_track_end(Alloc_Track *track) {
+    track->last = alloc_counter - track->mark;
+    track->samples++;
+    track->total += track->last;
+    if (track->last > track->max) track->max = track->last;
+}
+
+void alloc_report(FILE *stream, const Alloc_Track *track) {
+    fprintf(stream, "Allocations per %s: %.2f on average, %zu at most (%zu in %zu %ss)\n",
+            track->name, track->samples > 0 ? (double)track->total/track->samples : 0.0, track->max,
+            track->total, track->samples, track->name);
+}
+#endif // ALLOC_STATS
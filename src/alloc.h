@@ -0,0 +1,31 @@
+#ifndef ALLOC_H_
+#define ALLOC_H_
+
+#include <stddef.h>
+#include <stdio.h>
+
+// Heap allocation counters. Built with -DALLOC_STATS only, which `./nob --allocs` passes along with
+// -Wl,--wrap for malloc, calloc and realloc. Wrapping at link time also catches the calls made
+// from inside raylib and nob.h's NOB_REALLOC. Everything is counted per thread.
+typedef struct {
+    const char *name;
+    size_t mark; // alloc_count() when the current sample began
+    size_t samples;
+    size_t total;
+    size_t max;
+    size_t last; // Allocations in the last finished sample
+} Alloc_Track;
+
+#ifdef ALLOC_STATS
+// Allocations made by the calling thread so far
+size_t alloc_count(void);
+void alloc_track_begin(Alloc_Track *track);
+void alloc_track_end(Alloc_Track *track);
+void alloc_report(FILE *stream, const Alloc_Track *track);
+#else
+#define alloc_track_begin(track)
+#define alloc_track_end(track)
+#define alloc_report(stream, track)
+#endif // ALLOC_STATS
+
+#endif // ALLOC_H_
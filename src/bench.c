@@ -0,0 +1,336 @@
+// Microbenchmarks for the simulation core. Built once per grid size by `./nob bench`.
+#define NOB_IMPLEMENTATION
+#define NOB_STRIP_PREFIX
+#include "nob.h"
+
+#include "raylib.h"
+#include "raymath.h"
+
+#include "alloc.h"
+#include "bot.h"
+#include "common.h"
+#include "grid.h"
+#include "snake.h"
+
+#define BENCH_MIN_BATCH_NS 200000 // Batches shorter than this are dominated by the clock itself
+#define BENCH_WARMUP_NS 50000000
+#define BENCH_REPS 31
+#define BENCH_MAX_ITERS (1 << 26)
+#define CHECK_WARMUP_TICKS 64
+#define CHECK_TICKS 4096
+
+typedef void (*Bench_Func)(size_t iters);
+
+typedef struct {
+    const char *name;
+    size_t n;
+    double median_ns; // Per iteration
+    double mad_ns;    // Median absolute deviation of the per iteration times
+    size_t reps;
+    size_t iters;     // Per repetition
+} Bench_Result;
+
+typedef struct {
+    Bench_Result *items;
+    size_t count, capacity;
+} Bench_Results;
+
+// Keeps the compiler from throwing away the results of the benchmarked calls
+volatile size_t bench_sink;
+
+Snake bench_snake;
+Dir_Queue bench_dir_queue;
+Vector3 bench_missing;
+uint64_t bench_rng = 69;
+
+// Direction out of the cell along the Hamiltonian cycle of src/grid.h. The cycle visits every cell
+// once before coming back to where it started, so a snake following it never bites itself.
+Vector3 bench_cycle_dir(Vector3 point) {
+    return grid_dirs[grid_cycle_dir[grid_cell(point)]];
+}
+
+// Direction into the cell the cycle comes from, for following it backwards
+Vector3 bench_cycle_back_dir(Vector3 point) {
+    Grid_Cell cell = grid_cell(point);
+    for (int d = 0; d < 6; d++) {
+        Grid_Cell prev = grid_neighbors[cell][d];
+        if (grid_neighbors[prev][grid_cycle_dir[prev]] == cell) return grid_dirs[d];
+    }
+    UNREACHABLE("the cycle never comes into the cell");
+}
+
+Vector3 bench_wrap(Vector3 point) {
+    point.x = ((int)point.x + GRID_SIZE) % GRID_SIZE;
+    point.y = ((int)point.y + GRID_SIZE) % GRID_SIZE;
+    point.z = ((int)point.z + GRID_SIZE) % GRID_SIZE;
+    return point;
+}
+
+// Lays a snake of length n along the cycle. bench_missing is the next cell of the cycle,
+// which is the worst case for snake_contains() since the whole snake has to be scanned.
+void bench_snake_reset(size_t n) {
+    bench_snake = (Snake) {0};
+    Vector3 point = {0};
+    for (size_t k = 0; k < n; k++) {
+        snake_push_head(&bench_snake, point);
+        bench_snake.dir = bench_cycle_dir(point);
+        point = bench_wrap(Vector3Add(point, bench_snake.dir));
+    }
+    bench_missing = point;
+}
+
+void bench_snake_update(size_t iters) {
+    for (size_t i = 0; i < iters; i++) {
+        bench_snake.dir = bench_cycle_dir(snake_head(&bench_snake));
+        if (!snake_update(&bench_snake)) UNREACHABLE("the snake bit itself");
+    }
+}
+
+void bench_snake_contains(size_t iters) {
+    for (size_t i = 0; i < iters; i++) {
+        bench_sink += snake_contains(&bench_snake, bench_missing);
+    }
+}
+
+void bench_gen_fruit(size_t iters) {
+    for (size_t i = 0; i < iters; i++) {
+        bench_sink += (size_t)gen_fruit(&bench_rng).x;
+    }
+}
+
+// The snake is put back to its original length after every call so it never overflows.
+// Restoring is two stores, which is noise next to snake_grow() itself.
+void bench_snake_grow(size_t iters) {
+    size_t begin = bench_snake.begin;
+    size_t size = bench_snake.size;
+    for (size_t i = 0; i < iters; i++) {
+        snake_grow(&bench_snake);
+        bench_snake.begin = begin;
+        bench_snake.size = size;
+    }
+}
+
+// Pops and appends the direction back, so the queue stays at the same depth
+void bench_dir_queue_pop(size_t iters) {
+    for (size_t i = 0; i < iters; i++) {
+        Vector3 dir = dir_queue_pop(&bench_dir_queue);
+        da_append(&bench_dir_queue, dir);
+    }
+}
+
+void bench_dir_queue_reset(size_t depth) {
+    bench_dir_queue.count = 0;
+    for (size_t i = 0; i < depth; i++) {
+        da_append(&bench_dir_queue, grid_dirs[grid_cycle_dir[i]]);
+    }
+}
+
+int compare_doubles(const void *a, const void *b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+double median(double *xs, size_t count) {
+    qsort(xs, count, sizeof(*xs), compare_doubles);
+    return count % 2 == 1 ? xs[count/2] : (xs[count/2 - 1] + xs[count/2])/2;
+}
+
+uint64_t bench_time_batch(Bench_Func func, size_t iters) {
+    uint64_t begin = clock_now_ns();
+    func(iters);
+    return clock_now_ns() - begin;
+}
+
+Bench_Result bench_run(const char *name, size_t n, Bench_Func func) {
+    // Double the batch until it is long enough to time reliably
+    size_t iters = 1;
+    while (iters < BENCH_MAX_ITERS && bench_time_batch(func, iters) < BENCH_MIN_BATCH_NS) {
+        iters *= 2;
+    }
+
+    uint64_t warmup_begin = clock_now_ns();
+    while (clock_now_ns() - warmup_begin < BENCH_WARMUP_NS) {
+        func(iters);
+    }
+
+    double samples[BENCH_REPS];
+    for (size_t i = 0; i < BENCH_REPS; i++) {
+        samples[i] = (double)bench_time_batch(func, iters)/iters;
+    }
+    double med = median(samples, BENCH_REPS);
+    for (size_t i = 0; i < BENCH_REPS; i++) {
+        samples[i] = fabs(samples[i] - med);
+    }
+    double mad = median(samples, BENCH_REPS);
+
+    return (Bench_Result) {
+        .name = name,
+        .n = n,
+        .median_ns = med,
+        .mad_ns = mad,
+        .reps = BENCH_REPS,
+        .iters = iters,
+    };
+}
+
+// Plays a game by following the cycle backwards, the way a new game starts out heading (-x).
+// It never bites itself and keeps eating fruit along the way.
+Game autopilot_game;
+
+void autopilot_start(void) {
+    da_free(autopilot_game.dir_queue);
+    game_init(&autopilot_game, rng_next(&bench_rng));
+}
+
+void autopilot_tick(void) {
+    game_steer(&autopilot_game, bench_cycle_back_dir(snake_head(&autopilot_game.snake)));
+    game_tick(&autopilot_game);
+}
+
+// Whole ticks of a seeded game, fruit and shadow included. A new game starts once the snake
+// fills half of the grid, before spawning fruit gets slow.
+void bench_game_tick(size_t iters) {
+    for (size_t i = 0; i < iters; i++) {
+        autopilot_tick();
+        if (autopilot_game.game_over) UNREACHABLE("the autopilot crashed");
+        if (autopilot_game.snake.size >= GRID_SIZE*GRID_SIZE*GRID_SIZE/2) autopilot_start();
+    }
+}
+
+// The bot plans on a snake laid along the cycle with the fruit across the grid from the head, so
+// breadth first has to cover most of the cells the body leaves free before it gets there
+Game bench_bot_game;
+Bot bench_bot;
+
+void bench_bot_reset(Bot_Planner planner, size_t n) {
+    bench_bot.planner = planner;
+    bench_snake_reset(n);
+    bench_bot_game.snake = bench_snake;
+    bench_bot_game.fruit = bench_wrap(Vector3AddValue(snake_head(&bench_snake), GRID_SIZE/2));
+}
+
+void bench_bot_plan(size_t iters) {
+    for (size_t i = 0; i < iters; i++) {
+        bench_sink += bot_plan(&bench_bot, &bench_bot_game);
+    }
+}
+
+// Once the game is running, steering and ticking must never touch the heap
+bool check_tick_allocations(void) {
+    autopilot_start();
+    size_t allocations = 0;
+    for (size_t tick = 0; tick < CHECK_WARMUP_TICKS + CHECK_TICKS; tick++) {
+        if (tick == CHECK_WARMUP_TICKS) allocations = alloc_count();
+        autopilot_tick();
+        if (autopilot_game.game_over) {
+            nob_log(ERROR, "the autopilot of the allocation check crashed on tick %zu", tick);
+            return false;
+        }
+    }
+    allocations = alloc_count() - allocations;
+    if (allocations > 0) {
+        nob_log(ERROR, "%zu heap allocations in %d ticks of steady state, expected none", allocations, CHECK_TICKS);
+        return false;
+    }
+
+    // Neither must the bot. It can lose, so this only counts for as long as it lasts.
+    for (Bot_Planner planner = 0; planner < COUNT_BOT_PLANNERS; planner++) {
+        bench_bot.planner = planner;
+        da_free(bench_bot_game.dir_queue);
+        game_init(&bench_bot_game, rng_next(&bench_rng));
+        size_t tick = 0;
+        for (; tick < CHECK_WARMUP_TICKS + CHECK_TICKS && !bench_bot_game.game_over; tick++) {
+            if (tick == CHECK_WARMUP_TICKS) allocations = alloc_count();
+            bot_steer(&bench_bot, &bench_bot_game);
+            game_tick(&bench_bot_game);
+        }
+        if (tick <= CHECK_WARMUP_TICKS) continue;
+        allocations = alloc_count() - allocations;
+        if (allocations > 0) {
+            nob_log(ERROR, "%zu heap allocations in %zu ticks of the %s bot, expected none",
+                    allocations, tick - CHECK_WARMUP_TICKS, bot_planner_as_cstr(planner));
+            return false;
+        }
+    }
+    return true;
+}
+
+// Snake lengths to benchmark, as far as they fit in the grid
+size_t bench_lengths[] = {4, 32, 256, 2048, 16384};
+size_t bench_queue_depths[] = {1, 4, 16};
+
+void usage(FILE *stream, const char *program_name) {
+    fprintf(stream, "Usage: %s [OPTIONS]\n", program_name);
+    fprintf(stream, "    OPTIONS:\n");
+    fprintf(stream, "      -h, --help - Print this help message\n");
+    fprintf(stream, "      --json <path> - Also write the results to <path>, one JSON object per line\n");
+}
+
+int main(int argc, char **argv) {
+    const char *program_name = shift(argv, argc);
+
+    const char *json_path = NULL;
+    while (argc > 0) {
+        const char *arg = shift(argv, argc);
+        if (strcmp(arg, "-h") == 0 || strcmp(arg, "--help") == 0) {
+            usage(stdout, program_name);
+            return 0;
+        } else if (strcmp(arg, "--json") == 0) {
+            if (argc == 0) {
+                usage(stderr, program_name);
+                nob_log(ERROR, "--json flag requires an argument");
+                return 1;
+            }
+            json_path = shift(argv, argc);
+        } else {
+            usage(stderr, program_name);
+            nob_log(ERROR, "unknown flag %s", arg);
+            return 1;
+        }
+    }
+
+    if (!check_tick_allocations()) return 1;
+
+    Bench_Results results = {0};
+    for (size_t i = 0; i < ARRAY_LEN(bench_lengths); i++) {
+        size_t n = bench_lengths[i];
+        if (n > GRID_SIZE*GRID_SIZE*GRID_SIZE/2) break;
+
+        bench_snake_reset(n);
+        da_append(&results, bench_run("snake_update", n, bench_snake_update));
+        bench_snake_reset(n);
+        da_append(&results, bench_run("snake_contains", n, bench_snake_contains));
+        bench_snake_reset(n);
+        da_append(&results, bench_run("snake_grow", n, bench_snake_grow));
+        bench_bot_reset(BOT_BFS, n);
+        da_append(&results, bench_run("bot_plan_bfs", n, bench_bot_plan));
+        bench_bot_reset(BOT_ASTAR, n);
+        da_append(&results, bench_run("bot_plan_astar", n, bench_bot_plan));
+    }
+    autopilot_start();
+    da_append(&results, bench_run("game_tick", 0, bench_game_tick));
+    // gen_fruit() does not depend on the snake at all
+    da_append(&results, bench_run("gen_fruit", 0, bench_gen_fruit));
+    // Here n is the depth of the queue
+    for (size_t i = 0; i < ARRAY_LEN(bench_queue_depths); i++) {
+        bench_dir_queue_reset(bench_queue_depths[i]);
+        da_append(&results, bench_run("dir_queue_pop", bench_queue_depths[i], bench_dir_queue_pop));
+    }
+
+    printf("%-16s %6s %8s %12s %10s %10s\n", "name", "grid", "n", "median(ns)", "mad(ns)", "iters");
+    da_foreach(Bench_Result, r, &results) {
+        printf("%-16s %6d %8zu %12.2f %10.2f %10zu\n", r->name, GRID_SIZE, r->n, r->median_ns, r->mad_ns, r->iters);
+    }
+
+    if (json_path != NULL) {
+        String_Builder sb = {0};
+        da_foreach(Bench_Result, r, &results) {
+            sb_appendf(&sb, "{\"name\":\"%s\",\"grid\":%d,\"n\":%zu,\"median_ns\":%.3f,\"mad_ns\":%.3f,\"reps\":%zu,\"iters\":%zu}\n",
+                       r->name, GRID_SIZE, r->n, r->median_ns, r->mad_ns, r->reps, r->iters);
+        }
+        if (!write_entire_file(json_path, sb.items, sb.count)) return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,235 @@
+#define NOB_STRIP_PREFIX
+#include "nob.h"
+
+#include "raylib.h"
+
+#include "bot.h"
+
+// Only goes through the macros and the SNAKE_FUNC API of snake.h, so the bot stays in the host of
+// the hot reload build and keeps working across reloads.
+
+const char *bot_planner_as_cstr(Bot_Planner planner) {
+    static_assert(COUNT_BOT_PLANNERS == 2, "Please update after adding a new planner");
+    switch (planner) {
+        case BOT_BFS: return "bfs";
+        case BOT_ASTAR: return "astar";
+        default: UNREACHABLE("invalid planner");
+    }
+}
+
+bool bot_planner_by_name(const char *name, Bot_Planner *planner) {
+    for (Bot_Planner p = 0; p < COUNT_BOT_PLANNERS; p++) {
+        if (strcmp(name, bot_planner_as_cstr(p)) == 0) {
+            *planner = p;
+            return true;
+        }
+    }
+    return false;
+}
+
+int bot_dir_index(Vector3 dir) {
+    for (int d = 0; d < 6; d++) {
+        if (vector3_near_eq(dir, grid_dirs[d])) return d;
+    }
+    return 0;
+}
+
+void bot_begin_search(Bot *bot) {
+    if (++bot->search == 0) {
+        // The stamps wrapped around, anything left over could look current again
+        memset(bot->seen, 0, sizeof(bot->seen));
+        memset(bot->body, 0, sizeof(bot->body));
+        memset(bot->opened, 0, sizeof(bot->opened));
+        memset(bot->closed, 0, sizeof(bot->closed));
+        bot->search = 1;
+    }
+    memset(bot->reach, 0, sizeof(bot->reach));
+    bot->visits = 0;
+}
+
+// Boxed in away from the fruit, so stay alive as long as possible
+int bot_most_reach(const Bot *bot, int straight) {
+    int best = -1;
+    for (int i = 0; i < 6; i++) {
+        int d = (straight + i) % 6;
+        if (bot->reach[d] > 0 && (best < 0 || bot->reach[d] > bot->reach[best])) best = d;
+    }
+    return best;
+}
+
+// Marks the cells the head cannot move into on the next tick as seen, so the search goes around them
+void bot_block_body(Bot *bot, const Snake *snake) {
+    // The tail moves out of the way before the head moves in, so it never blocks
+    for (size_t i = 1; i < snake->size; i++) {
+        Vector3 point = SNAKE_AT(snake, i);
+        // A segment that just grew can be outside of the grid until the tail catches up with it
+        if (!cell_in_grid(point)) continue;
+        bot->seen[grid_cell(point)] = bot->search;
+    }
+}
+
+bool bot_visit(Bot *bot, Grid_Cell cell, unsigned char first) {
+    if (bot->seen[cell] == bot->search) return false;
+    bot->seen[cell] = bot->search;
+    bot->first[cell] = first;
+    return true;
+}
+
+// First step towards the queued cell that is the closest to the fruit
+int bot_closest_first(const Bot *bot, Grid_Cell fruit, size_t queued) {
+    size_t closest = 0;
+    int closest_distance = grid_distance(bot->queue[0], fruit);
+    for (size_t i = 1; i < queued; i++) {
+        int distance = grid_distance(bot->queue[i], fruit);
+        if (distance < closest_distance) {
+            closest = i;
+            closest_distance = distance;
+        }
+    }
+    return bot->first[bot->queue[closest]];
+}
+
+int bot_plan_bfs(Bot *bot, const Game *game) {
+    const Snake *snake = &game->snake;
+    bot_block_body(bot, snake);
+
+    Grid_Cell head = grid_cell(SNAKE_AT(snake, snake->size - 1));
+    Grid_Cell fruit = grid_cell(game->fruit);
+    bot->seen[head] = bot->search;
+
+    // Going straight comes first, so of the shortest paths the one that turns later wins
+    int straight = bot_dir_index(snake->dir);
+    size_t begin = 0, end = 0;
+    for (int i = 0; i < 6; i++) {
+        int d = (straight + i) % 6;
+        Grid_Cell next = grid_neighbors[head][d];
+        if (bot_visit(bot, next, d)) bot->queue[end++] = next;
+    }
+
+    while (begin < end) {
+        if (bot->visits == BOT_MAX_VISITS) return bot_closest_first(bot, fruit, end);
+        Grid_Cell cell = bot->queue[begin++];
+        bot->visits++;
+        if (cell == fruit) return bot->first[cell];
+        bot->reach[bot->first[cell]]++;
+        for (int d = 0; d < 6; d++) {
+            Grid_Cell next = grid_neighbors[cell][d];
+            if (bot_visit(bot, next, bot->first[cell])) bot->queue[end++] = next;
+        }
+    }
+    return bot_most_reach(bot, straight);
+}
+
+// Segment i, counting from the tail, is gone after i + 1 more ticks, since the tail leaves before
+// the head moves in. The snake only grows once the head reaches the fruit, which is where the path
+// ends, so the times hold all along it. A grown tail shares its cell with the segment behind the
+// head, which leaves later, so every cell keeps the time of the last segment on it.
+void bot_mark_free_at(Bot *bot, const Snake *snake) {
+    for (size_t i = 0; i < snake->size; i++) {
+        Vector3 point = SNAKE_AT(snake, i);
+        if (!cell_in_grid(point)) continue;
+        Grid_Cell cell = grid_cell(point);
+        bot->body[cell] = bot->search;
+        bot->free_at[cell] = i + 1;
+    }
+}
+
+// Of equal f the deeper node goes first, it is the one closer to the fruit
+bool bot_node_before(Bot_Node a, Bot_Node b) {
+    return a.f < b.f || (a.f == b.f && a.g > b.g);
+}
+
+void bot_open_push(Bot *bot, Bot_Node node) {
+    size_t i = bot->open_count++;
+    while (i > 0) {
+        size_t parent = (i - 1)/2;
+        if (!bot_node_before(node, bot->open[parent])) break;
+        bot->open[i] = bot->open[parent];
+        i = parent;
+    }
+    bot->open[i] = node;
+}
+
+Bot_Node bot_open_pop(Bot *bot) {
+    Bot_Node top = bot->open[0];
+    Bot_Node last = bot->open[--bot->open_count];
+    size_t i = 0;
+    for (;;) {
+        size_t child = 2*i + 1;
+        if (child >= bot->open_count) break;
+        if (child + 1 < bot->open_count && bot_node_before(bot->open[child + 1], bot->open[child])) child++;
+        if (!bot_node_before(bot->open[child], last)) break;
+        bot->open[i] = bot->open[child];
+        i = child;
+    }
+    bot->open[i] = last;
+    return top;
+}
+
+// Offers the cell to the open set as reached in g steps
+void bot_open(Bot *bot, Grid_Cell cell, uint32_t g, unsigned char first, Grid_Cell fruit) {
+    if (bot->closed[cell] == bot->search) return;
+    // A segment is still there when the head would get in. A longer way may still get in later.
+    if (bot->body[cell] == bot->search && g < bot->free_at[cell]) return;
+    if (bot->opened[cell] == bot->search && bot->g[cell] <= g) return;
+    bot->opened[cell] = bot->search;
+    bot->g[cell] = g;
+    bot->first[cell] = first;
+    bot_open_push(bot, (Bot_Node) { .f = g + grid_distance(cell, fruit), .g = g, .cell = cell });
+}
+
+int bot_plan_astar(Bot *bot, const Game *game) {
+    const Snake *snake = &game->snake;
+    bot_mark_free_at(bot, snake);
+    bot->open_count = 0;
+
+    Grid_Cell head = grid_cell(SNAKE_AT(snake, snake->size - 1));
+    Grid_Cell fruit = grid_cell(game->fruit);
+    bot->closed[head] = bot->search;
+
+    int straight = bot_dir_index(snake->dir);
+    for (int i = 0; i < 6; i++) {
+        int d = (straight + i) % 6;
+        bot_open(bot, grid_neighbors[head][d], 1, d, fruit);
+    }
+
+    int closest = -1;
+    uint32_t closest_distance = UINT32_MAX;
+    while (bot->open_count > 0) {
+        Bot_Node node = bot_open_pop(bot);
+        // Pushed again with a smaller g since, and that one came out first
+        if (bot->closed[node.cell] == bot->search) continue;
+        if (bot->visits == BOT_MAX_VISITS) return closest;
+        bot->closed[node.cell] = bot->search;
+        bot->visits++;
+        if (node.cell == fruit) return bot->first[node.cell];
+
+        unsigned char first = bot->first[node.cell];
+        bot->reach[first]++;
+        if (node.f - node.g < closest_distance) {
+            closest = first;
+            closest_distance = node.f - node.g;
+        }
+        for (int d = 0; d < 6; d++) {
+            bot_open(bot, grid_neighbors[node.cell][d], node.g + 1, first, fruit);
+        }
+    }
+    return bot_most_reach(bot, straight);
+}
+
+int bot_plan(Bot *bot, const Game *game) {
+    bot_begin_search(bot);
+    static_assert(COUNT_BOT_PLANNERS == 2, "Please update this `switch` statement when adding a new planner");
+    switch (bot->planner) {
+        case BOT_BFS: return bot_plan_bfs(bot, game);
+        case BOT_ASTAR: return bot_plan_astar(bot, game);
+        default: UNREACHABLE("invalid planner");
+    }
+}
+
+bool bot_steer(Bot *bot, Game *game) {
+    if (game->game_over || game->dir_queue.count > 0) return false;
+    int d = bot_plan(bot, game);
+    // game_steer() turns down the direction the snake is already heading
+    return d >= 0 && game_steer(game, grid_dirs[d]);
+}
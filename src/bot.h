@@ -0,0 +1,67 @@
+#ifndef BOT_H_
+#define BOT_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "grid.h"
+#include "snake.h"
+
+// Cells a single plan may take off the queue. A whole 32^3 grid, or about a millisecond at 64^3.
+#define BOT_MAX_VISITS 32768
+// Every cell A* takes off the open set pushes at most 6 more onto it, the start pushes its own 6.
+// No cell is taken off twice, so small grids run out of cells before they run out of visits.
+#define BOT_OPEN_CAPACITY (6*(BOT_MAX_VISITS < GRID_CELLS ? BOT_MAX_VISITS : GRID_CELLS) + 6)
+
+typedef enum {
+    // Shortest path that goes around every segment but the tail
+    BOT_BFS,
+    // Shortest path by A*, through the cells of segments that are gone by the time the head gets there
+    BOT_ASTAR,
+    COUNT_BOT_PLANNERS,
+} Bot_Planner;
+
+const char *bot_planner_as_cstr(Bot_Planner planner);
+bool bot_planner_by_name(const char *name, Bot_Planner *planner);
+
+typedef struct {
+    uint32_t f;    // Steps so far plus the distance left to the fruit
+    uint32_t g;    // Steps so far
+    Grid_Cell cell;
+} Bot_Node;
+
+// Plays the game by itself: before every tick it searches the wrapped grid for a shortest path
+// from the head to the fruit and turns the way that path starts. All of its buffers live in here,
+// so planning never touches the heap.
+typedef struct {
+    Bot_Planner planner;
+
+    uint32_t search;                   // Stamp of the current search, so the arrays never need clearing
+    unsigned char first[GRID_CELLS];   // Index into grid_dirs of the first step of the path to the cell
+    size_t reach[6];                   // Cells reachable through each first step, when there is no way to the fruit
+    size_t visits;                     // Cells the last plan took off the queue or the open set
+
+    // BOT_BFS
+    uint32_t seen[GRID_CELLS];         // == search once the cell was queued, or from the start where a segment is in the way
+    Grid_Cell queue[GRID_CELLS];
+
+    // BOT_ASTAR
+    uint32_t body[GRID_CELLS];         // == search where a segment is
+    uint32_t free_at[GRID_CELLS];      // Step from which the head can move into the cell, where body == search
+    uint32_t opened[GRID_CELLS];       // == search once the cell has a g
+    uint32_t g[GRID_CELLS];            // Fewest steps to the cell found so far
+    uint32_t closed[GRID_CELLS];       // == search once the cell was taken off the open set
+    Bot_Node open[BOT_OPEN_CAPACITY];  // Binary heap ordered by f. Improved cells are pushed again, stale entries skipped
+    size_t open_count;
+} Bot;
+
+// Index into grid_dirs of the step to take from the head, or -1 when every neighbor is taken.
+// Without a way to the fruit it heads wherever the most cells are still reachable. When the fruit
+// is further than BOT_MAX_VISITS allows, it heads for the searched cell closest to the fruit.
+int bot_plan(Bot *bot, const Game *game);
+// Queues the planned turn through game_steer(), the same way a key press does. Does nothing while
+// a turn is still queued, so the bot never gets ahead of the ticks. Returns whether it turned.
+bool bot_steer(Bot *bot, Game *game);
+
+#endif // BOT_H_
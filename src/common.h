@@ -0,0 +1,35 @@
+#ifndef COMMON_H_
+#define COMMON_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+
+#define MACRO_VAR(name) _##name##__LINE__
+#define BEGIN_END_NAMED(begin, end, i) for (int i = (begin, 0); i < 1; i++, end)
+#define BEGIN_END(begin, end) BEGIN_END_NAMED(begin, end, MACRO_VAR(i))
+
+#ifndef GRID_SIZE
+#define GRID_SIZE 10
+#endif // GRID_SIZE
+#define TICK_INTERVAL 0.5
+
+static inline double clock_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec*1e-9;
+}
+
+static inline uint64_t clock_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec*1000000000 + ts.tv_nsec;
+}
+
+static inline void sleep_seconds(double seconds) {
+    if (seconds <= 0) return;
+    struct timespec ts = { .tv_sec = (time_t)seconds, .tv_nsec = (seconds - (time_t)seconds)*1e9 };
+    nanosleep(&ts, NULL);
+}
+
+#endif // COMMON_H_
@@ -0,0 +1,42 @@
+#ifndef GRID_H_
+#define GRID_H_
+
+#include <stdint.h>
+
+#include "raylib.h"
+
+#include "common.h"
+
+// Lookup tables generated by nob.c for every GRID_SIZE in its grid_sizes: the coordinates of every
+// cell (grid_coords), the neighbors of every cell with the grid wrapping around (grid_neighbors)
+// and a Hamiltonian cycle through all of them (grid_cycle_dir). The tables are static const, so
+// only the ones a translation unit uses end up in an optimized build.
+#include "grid_tables.h"
+
+// Neighbors are listed in this order in grid_neighbors
+static const Vector3 grid_dirs[6] = {
+    { 1, 0, 0 }, { -1, 0, 0 },
+    { 0, 1, 0 }, { 0, -1, 0 },
+    { 0, 0, 1 }, { 0, 0, -1 },
+};
+
+static inline Grid_Cell grid_cell(Vector3 point) {
+    return ((int)point.z*GRID_SIZE + (int)point.y)*GRID_SIZE + (int)point.x;
+}
+
+static inline Vector3 grid_point(Grid_Cell cell) {
+    return (Vector3) { grid_coords[cell][0], grid_coords[cell][1], grid_coords[cell][2] };
+}
+
+// Fewest steps from one cell to the other, with the grid wrapping around
+static inline int grid_distance(Grid_Cell a, Grid_Cell b) {
+    int distance = 0;
+    for (int axis = 0; axis < 3; axis++) {
+        int d = grid_coords[a][axis] - grid_coords[b][axis];
+        if (d < 0) d = -d;
+        distance += d < GRID_SIZE - d ? d : GRID_SIZE - d;
+    }
+    return distance;
+}
+
+#endif // GRID_H_
@@ -0,0 +1,68 @@
+#define NOB_STRIP_PREFIX
+#include "nob.h"
+
+#include "raylib.h"
+
+#include "hotreload.h"
+#include "snake.h"
+
+#ifdef HOTRELOAD
+#include <dlfcn.h>
+#include <sys/stat.h>
+
+#define LIBSNAKE_NAME "libsnake.so"
+
+#define LIST_OF_LIBSNAKE_FUNCS \
+    LIBSNAKE_FUNC(vector3_near_eq) \
+    LIBSNAKE_FUNC(cell_in_grid) \
+    LIBSNAKE_FUNC(game_init) \
+    LIBSNAKE_FUNC(game_steer) \
+    LIBSNAKE_FUNC(game_tick)
+
+#define LIBSNAKE_FUNC(name) __typeof__(name) name = NULL;
+LIST_OF_LIBSNAKE_FUNCS
+#undef LIBSNAKE_FUNC
+
+void *libsnake = NULL;
+char libsnake_path[4096];
+// The build replaces the library with a rename, so a new library is a new inode
+struct stat libsnake_stat;
+
+bool libsnake_reload(void) {
+    if (libsnake_path[0] == '\0') {
+        snprintf(libsnake_path, sizeof(libsnake_path), "%s%s", GetApplicationDirectory(), LIBSNAKE_NAME);
+    }
+    // dlopen() hands back the library that is already loaded under the same path, so it has to go first
+    if (libsnake != NULL) dlclose(libsnake);
+
+    if (stat(libsnake_path, &libsnake_stat) < 0) {
+        nob_log(ERROR, "could not stat %s: %s", libsnake_path, strerror(errno));
+        return false;
+    }
+    libsnake = dlopen(libsnake_path, RTLD_NOW);
+    if (libsnake == NULL) {
+        nob_log(ERROR, "could not load %s: %s", libsnake_path, dlerror());
+        return false;
+    }
+
+#define LIBSNAKE_FUNC(name) \
+    name = dlsym(libsnake, #name); \
+    if (name == NULL) { \
+        nob_log(ERROR, "could not find %s in %s: %s", #name, libsnake_path, dlerror()); \
+        return false; \
+    }
+    LIST_OF_LIBSNAKE_FUNCS
+#undef LIBSNAKE_FUNC
+
+    nob_log(INFO, "loaded %s", libsnake_path);
+    return true;
+}
+
+bool libsnake_update(void) {
+    struct stat st;
+    // Missing while the build is replacing it, try again on the next frame
+    if (stat(libsnake_path, &st) < 0) return true;
+    if (st.st_ino == libsnake_stat.st_ino && st.st_mtime == libsnake_stat.st_mtime) return true;
+    return libsnake_reload();
+}
+#endif // HOTRELOAD
@@ -0,0 +1,20 @@
+#ifndef HOTRELOAD_H_
+#define HOTRELOAD_H_
+
+#include <stdbool.h>
+
+// Hot reload dev build, `./nob --hotreload`. The simulation core (src/snake.c) is linked into
+// libsnake.so next to the executable, and the host calls into it through the pointers declared by
+// SNAKE_FUNC in snake.h. The Game and everything else stays in the host, so reloading the library
+// keeps the game going. Changing the layout of any of the structures still needs a restart.
+#ifdef HOTRELOAD
+// Loads the library again, dropping the previous one
+bool libsnake_reload(void);
+// Reloads the library if it changed on disk since it was loaded. False when reloading failed.
+bool libsnake_update(void);
+#else
+#define libsnake_reload() true
+#define libsnake_update() true
+#endif // HOTRELOAD
+
+#endif // HOTRELOAD_H_
@@ -1,90 +1,252 @@
-#define NOB_IMPLEMENTATION
 #define NOB_STRIP_PREFIX
 #include "nob.h"
 
 #include "raylib.h"
 #include "raymath.h"
 #include "rcamera.h"
+#include "rlgl.h"
 
 #ifdef PLATFORM_WEB
     #include <emscripten/emscripten.h>
 #endif // PLATFORM_WEB
 
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <time.h>
 
-#define MACRO_VAR(name) _##name##__LINE__
-#define BEGIN_END_NAMED(begin, end, i) for (int i = (begin, 0); i < 1; i++, end)
-#define BEGIN_END(begin, end) BEGIN_END_NAMED(begin, end, MACRO_VAR(i))
-#define Drawing BEGIN_END(BeginDrawing(), EndDrawing())
-#define Mode3D(camera) BEGIN_END(BeginMode3D(camera), EndMode3D())
+#include "alloc.h"
+#include "bot.h"
+#include "common.h"
+#include "hotreload.h"
+#include "perf.h"
+#include "profile.h"
+#include "snake.h"
 
-#define GRID_SIZE 10
+// The browser build has no threads, so there the simulation runs on the render loop instead.
+// So does the hot reload build, so the library is never swapped out in the middle of a tick.
+#if !defined(PLATFORM_WEB) && !defined(HOTRELOAD)
+    #define SIM_THREADED
+    #include <pthread.h>
+#endif // !PLATFORM_WEB && !HOTRELOAD
 
-bool vector3_near_eq(Vector3 a, Vector3 b) {
-    return Vector3LengthSqr(Vector3Subtract(a, b)) < 0.01;
-}
+#define Drawing BEGIN_END(BeginDrawing(), present())
+#define Mode3D(camera) BEGIN_END(begin_mode_3d(camera), end_mode_3d())
 
+// Render statistics. rlgl does not count anything by itself, so the renderer draws through a batch
+// of its own and watches it. Flushes we trigger on purpose go through render_stats_flush(). Implicit
+// ones (the batch running out of vertices or draw calls) show up as the batch having been reset
+// between two samples, so anything submitted between the last sample and such a flush is missed.
 typedef struct {
-    Vector3 points[GRID_SIZE*GRID_SIZE*GRID_SIZE];
-    size_t begin;
-    size_t size;
+    size_t flushes;
+    size_t draw_calls;
+    size_t vertices;
+    size_t state_changes; // Texture and mode switches inside the batch plus shader and VAO binds of our own
+} Render_Counters;
 
-    Vector3 dir;
-} Snake;
-#define SNAKE_AT_NO_PARENS(snake, i) snake->points[((snake->begin + i) + ARRAY_LEN(snake->points)) % ARRAY_LEN(snake->points)]
-#define SNAKE_AT(snake, i) SNAKE_AT_NO_PARENS((snake), (i))
+typedef struct {
+    rlRenderBatch batch;
+
+    // What was pending in the batch at the last sample
+    int pending_vertices;
+    int pending_draws;
+    int draw_counter;
+    float depth;
+
+    Render_Counters frame; // Frame being drawn
+    Render_Counters last;  // Last presented frame
+} Render_Stats;
 
-void snake_push_head(Snake *snake, Vector3 point) {
-    assert(snake->size < ARRAY_LEN(snake->points) && "Snake Overflow");
-    SNAKE_AT(snake, snake->size) = point;
-    snake->size++;
+Render_Stats render_stats;
+
+void render_stats_reset_pending(void) {
+    render_stats.pending_vertices = 0;
+    render_stats.pending_draws = 0;
+    render_stats.draw_counter = 1;
+    render_stats.depth = -1.0f;
 }
 
-void snake_push_tail(Snake *snake, Vector3 point) {
-    assert(snake->size < ARRAY_LEN(snake->points) && "Snake Overflow");
-    SNAKE_AT(snake, -1) = point;
-    snake->size++;
-    snake->begin--;
+void render_stats_init(void) {
+    render_stats.batch = rlLoadRenderBatch(RL_DEFAULT_BATCH_BUFFERS, RL_DEFAULT_BATCH_BUFFER_ELEMENTS);
+    rlSetRenderBatchActive(&render_stats.batch);
+    render_stats_reset_pending();
 }
 
-Vector3 snake_pop(Snake *snake) {
-    assert(snake->size > 0 && "Snake Underflow");
-    Vector3 point = SNAKE_AT(snake, 0);
-    snake->size--;
-    snake->begin++;
-    if (snake->begin == ARRAY_LEN(snake->points)) snake->begin = 0;
-    return point;
+void render_stats_deinit(void) {
+    rlSetRenderBatchActive(NULL);
+    rlUnloadRenderBatch(render_stats.batch);
 }
 
-Vector3 snake_head(const Snake *snake) {
-    return SNAKE_AT(snake, snake->size - 1);
+void render_stats_sample(void) {
+    Render_Stats *rs = &render_stats;
+    const rlRenderBatch *batch = &rs->batch;
+    int vertices = 0;
+    int draws = 0;
+    for (int i = 0; i < batch->drawCounter; i++) {
+        vertices += batch->draws[i].vertexCount;
+        if (batch->draws[i].vertexCount > 0) draws++;
+    }
+
+    if (batch->currentDepth < rs->depth || vertices < rs->pending_vertices || batch->drawCounter < rs->draw_counter) {
+        rs->frame.flushes++;
+        rs->frame.draw_calls += rs->pending_draws;
+        render_stats_reset_pending();
+    }
+    rs->frame.vertices += vertices - rs->pending_vertices;
+    rs->frame.state_changes += batch->drawCounter - rs->draw_counter;
+
+    rs->pending_vertices = vertices;
+    rs->pending_draws = draws;
+    rs->draw_counter = batch->drawCounter;
+    rs->depth = batch->currentDepth;
 }
 
-void snake_grow(Snake *snake) {
-    Vector3 head = snake_head(snake);
-    snake_push_tail(snake, Vector3Subtract(head, snake->dir));
+// Call right before anything that flushes the batch on purpose
+void render_stats_flush(void) {
+    render_stats_sample();
+    if (render_stats.pending_vertices > 0) {
+        render_stats.frame.flushes++;
+        render_stats.frame.draw_calls += render_stats.pending_draws;
+    }
+    render_stats_reset_pending();
 }
 
-bool snake_contains(const Snake *snake, Vector3 point) {
-    for (size_t i = 0; i < snake->size; i++) {
-        if (vector3_near_eq(point, SNAKE_AT(snake, i))) {
-            return true;
-        }
+// Draw calls issued directly rather than through the batch
+void render_stats_direct_draw(size_t vertices, size_t state_changes) {
+    render_stats.frame.draw_calls++;
+    render_stats.frame.vertices += vertices;
+    render_stats.frame.state_changes += state_changes;
+}
+
+void render_stats_end_frame(void) {
+    render_stats.last = render_stats.frame;
+    render_stats.frame = (Render_Counters) {0};
+    profile_trace_counter("batch flushes", render_stats.last.flushes);
+    profile_trace_counter("draw calls", render_stats.last.draw_calls);
+    profile_trace_counter("vertices", render_stats.last.vertices);
+    profile_trace_counter("state changes", render_stats.last.state_changes);
+}
+
+void begin_mode_3d(Camera camera) {
+    render_stats_flush();
+    BeginMode3D(camera);
+}
+
+void end_mode_3d(void) {
+    render_stats_flush();
+    EndMode3D();
+}
+
+// Startup timeline, from the process being started up to the first frame being presented.
+// Every stage is the time since the end of the previous one, in the order they happen.
+typedef enum {
+    STARTUP_PROCESS,     // From exec until main(), loading the executable and its libraries
+    STARTUP_SETUP,       // Arguments, the snapshots and libsnake.so in the hot reload build
+    STARTUP_GAME_INIT,
+    STARTUP_INIT_WINDOW, // The window, the GL context and raylib's own shader and batch
+    STARTUP_RENDERER,    // Our shaders, buffers and textures
+    STARTUP_FIRST_FRAME, // Until the first EndDrawing() returns
+    COUNT_STARTUP_STAGES,
+} Startup_Stage;
+
+const char *startup_stage_name(Startup_Stage stage) {
+    static_assert(COUNT_STARTUP_STAGES == 6, "Please update after adding a new startup stage");
+    switch (stage) {
+        case STARTUP_PROCESS: return "process start";
+        case STARTUP_SETUP: return "setup";
+        case STARTUP_GAME_INIT: return "game_init";
+        case STARTUP_INIT_WINDOW: return "InitWindow";
+        case STARTUP_RENDERER: return "renderer setup";
+        case STARTUP_FIRST_FRAME: return "first frame";
+        default: UNREACHABLE("invalid startup stage");
     }
-    return false;
 }
 
-bool snake_update(Snake *snake) {
-    snake_pop(snake);
-    Vector3 point = Vector3Add(SNAKE_AT(snake, snake->size - 1), snake->dir);
-    point.x = ((int)point.x + GRID_SIZE) % GRID_SIZE;
-    point.y = ((int)point.y + GRID_SIZE) % GRID_SIZE;
-    point.z = ((int)point.z + GRID_SIZE) % GRID_SIZE;
-    if (snake_contains(snake, point)) {
+typedef struct {
+    uint64_t stage_ns[COUNT_STARTUP_STAGES];
+    bool process_known; // The process start time is not available everywhere
+    uint64_t last_ns;   // End of the last finished stage
+    Startup_Stage next;
+} Startup;
+
+Startup startup;
+
+// How long ago the process was started. /proc only counts in clock ticks, usually 10ms.
+bool process_age_ns(uint64_t *age_ns) {
+#ifdef __linux__
+    FILE *f = fopen("/proc/self/stat", "r");
+    if (f == NULL) return false;
+    char line[1024];
+    bool ok = fgets(line, sizeof(line), f) != NULL;
+    fclose(f);
+    if (!ok) return false;
+
+    // The name of the executable may contain spaces, so fields are counted from the closing paren.
+    // starttime is the 22nd field, the 20th after it.
+    char *p = strrchr(line, ')');
+    if (p == NULL) return false;
+    unsigned long long start_ticks;
+    if (sscanf(p + 2, "%*c %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %llu", &start_ticks) != 1) {
         return false;
     }
-    snake_push_head(snake, point);
+    struct timespec boot;
+    if (clock_gettime(CLOCK_BOOTTIME, &boot) != 0) return false;
+    uint64_t now_ns = (uint64_t)boot.tv_sec*1000000000 + boot.tv_nsec;
+    uint64_t start_ns = start_ticks*1000000000/sysconf(_SC_CLK_TCK);
+    *age_ns = now_ns > start_ns ? now_ns - start_ns : 0;
     return true;
+#else
+    UNUSED(age_ns);
+    return false;
+#endif // __linux__
+}
+
+void startup_begin(Startup *startup) {
+    startup->last_ns = clock_now_ns();
+    startup->process_known = process_age_ns(&startup->stage_ns[STARTUP_PROCESS]);
+    startup->next = STARTUP_PROCESS + 1;
+}
+
+void startup_stage_end(Startup *startup, Startup_Stage stage) {
+    assert(stage == startup->next && "Startup stages out of order");
+    uint64_t now = clock_now_ns();
+    startup->stage_ns[stage] = now - startup->last_ns;
+    startup->last_ns = now;
+    startup->next++;
+}
+
+void startup_report(FILE *stream, const Startup *startup) {
+    if (startup->next != COUNT_STARTUP_STAGES) return;
+    uint64_t total = 0;
+    fprintf(stream, "Startup:\n");
+    for (Startup_Stage stage = 0; stage < COUNT_STARTUP_STAGES; stage++) {
+        if (stage == STARTUP_PROCESS && !startup->process_known) {
+            fprintf(stream, "  %-16s %10s\n", startup_stage_name(stage), "unknown");
+            continue;
+        }
+        total += startup->stage_ns[stage];
+        fprintf(stream, "  %-16s %10.2fms\n", startup_stage_name(stage), startup->stage_ns[stage]*1e-6);
+    }
+    fprintf(stream, "  %-16s %10.2fms\n", "to first frame", total*1e-6);
+}
+
+Alloc_Track frame_allocs = { .name = "frame" };
+Perf_Track frame_perf = { .name = "frame" };
+
+void present(void) {
+    render_stats_flush();
+    Profile("present") EndDrawing();
+    render_stats_end_frame();
+#ifdef ALLOC_STATS
+    // A frame is everything the render thread did since the previous one was presented
+    alloc_track_end(&frame_allocs);
+    profile_trace_counter("allocations", frame_allocs.last);
+    alloc_track_begin(&frame_allocs);
+#endif // ALLOC_STATS
+    perf_track_end(&frame_perf);
+    perf_track_begin(&frame_perf);
+    profile_mark("frame boundary");
+    if (startup.next == STARTUP_FIRST_FRAME) startup_stage_end(&startup, STARTUP_FIRST_FRAME);
 }
 
 Vector3 get_keyboard_dir(void) {
@@ -98,191 +260,1188 @@ Vector3 get_keyboard_dir(void) {
     return Vector3Zero();
 }
 
-Vector3 gen_fruit(void) {
-    int x = GetRandomValue(0, GRID_SIZE-1);
-    int y = GetRandomValue(0, GRID_SIZE-1);
-    int z = GetRandomValue(0, GRID_SIZE-1);
-    return (Vector3) { x, y, z };
+// Lifetime of a key press that turned the snake, for measuring input latency. The press is only
+// seen once raylib polls events at the end of a frame, so that part of the wait is not counted.
+typedef struct {
+    uint64_t pressed_ns;  // When the render thread saw the key press
+    uint64_t dequeued_ns; // When the simulation thread took it off the input queue
+    uint64_t applied_ns;  // When the tick that turned the snake started
+    uint64_t tick;        // That tick, the press is visible in the first frame that shows it
+    bool bot;             // Turned by the bot rather than a key, kept only so steering stays in step with the dir queue
+} Input_Latency;
+
+typedef struct {
+    Vector3 dir;
+    uint64_t pressed_ns;
+} Input_Event;
+
+// Lock-free single producer (render thread), single consumer (simulation thread) ring
+// of the raw directions pressed on the keyboard
+#define INPUT_QUEUE_CAPACITY 64
+
+typedef struct {
+    Input_Event items[INPUT_QUEUE_CAPACITY];
+    _Atomic size_t head; // Next item to pop, only advanced by the consumer
+    _Atomic size_t tail; // Next slot to push into, only advanced by the producer
+} Input_Queue;
+
+bool input_queue_push(Input_Queue *q, Input_Event event) {
+    size_t tail = atomic_load_explicit(&q->tail, memory_order_relaxed);
+    size_t head = atomic_load_explicit(&q->head, memory_order_acquire);
+    if (tail - head == INPUT_QUEUE_CAPACITY) return false;
+    q->items[tail % INPUT_QUEUE_CAPACITY] = event;
+    atomic_store_explicit(&q->tail, tail + 1, memory_order_release);
+    return true;
 }
 
+bool input_queue_pop(Input_Queue *q, Input_Event *event) {
+    size_t head = atomic_load_explicit(&q->head, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&q->tail, memory_order_acquire);
+    if (head == tail) return false;
+    *event = q->items[head % INPUT_QUEUE_CAPACITY];
+    atomic_store_explicit(&q->head, head + 1, memory_order_release);
+    return true;
+}
+
+// The same kind of ring in the other direction: turns the simulation has applied, on their way
+// back to the render thread which finds out when they got on the screen
+#define LATENCY_QUEUE_CAPACITY 64
+
 typedef struct {
-    Vector3 *items;
-    size_t count, capacity;
-} Dir_Queue;
+    Input_Latency items[LATENCY_QUEUE_CAPACITY];
+    _Atomic size_t head;
+    _Atomic size_t tail;
+} Latency_Queue;
 
-Vector3 dir_queue_pop(Dir_Queue *dirq) {
-    Vector3 dir = dirq->items[0];
-    memmove(dirq->items, dirq->items + 1, sizeof(*dirq->items));
-    dirq->count--;
-    return dir;
+bool latency_queue_push(Latency_Queue *q, Input_Latency latency) {
+    size_t tail = atomic_load_explicit(&q->tail, memory_order_relaxed);
+    size_t head = atomic_load_explicit(&q->head, memory_order_acquire);
+    if (tail - head == LATENCY_QUEUE_CAPACITY) return false;
+    q->items[tail % LATENCY_QUEUE_CAPACITY] = latency;
+    atomic_store_explicit(&q->tail, tail + 1, memory_order_release);
+    return true;
 }
 
-Vector3 last_dir(Dir_Queue dir_queue, const Snake *snake) {
-    return dir_queue.count == 0 ? snake->dir : dir_queue.items[dir_queue.count - 1];
+bool latency_queue_pop(Latency_Queue *q, Input_Latency *latency) {
+    size_t head = atomic_load_explicit(&q->head, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&q->tail, memory_order_acquire);
+    if (head == tail) return false;
+    *latency = q->items[head % LATENCY_QUEUE_CAPACITY];
+    atomic_store_explicit(&q->head, head + 1, memory_order_release);
+    return true;
 }
 
+// Latencies of the turns sitting in Game.dir_queue, kept in the same order
 typedef struct {
-    Snake snake;
+    Input_Latency *items;
+    size_t count, capacity;
+} Steering;
+
+// Where a segment of the snake was before the last tick and where it is now. Laid out
+// exactly like the per-instance attributes of the segment shader.
+typedef struct {
+    Vector3 prev;
+    Vector3 curr;
+} Segment;
+
+// Immutable copy of everything the renderer needs to draw one state of the game
+typedef struct {
+    uint64_t tick;
+    double tick_time; // clock_now() at the moment the tick happened
+    uint64_t tick_duration_ns;
     Vector3 fruit;
-    Camera camera;
-    Dir_Queue dir_queue;
     int score;
-    float time;
     bool game_over;
-} Game;
+    size_t segment_count;
+    Segment segments[GRID_SIZE*GRID_SIZE*GRID_SIZE]; // From the tail to the head
+    unsigned char footprint[GRID_SIZE*GRID_SIZE];
+} Snapshot;
 
-void game_init(Game *game) {
-    memset(game, 0, sizeof(*game));
-    game->snake = (Snake) { .dir = {-1, 0, 0} };
-    for (int i = 0; i < 4; i++) {
-        snake_push_head(&game->snake, (Vector3) { GRID_SIZE / 2 + 4 - i, GRID_SIZE / 2, GRID_SIZE / 2 });
+void snapshot_take(Snapshot *snapshot, const Game *game, double tick_time) {
+    snapshot->tick = game->tick;
+    snapshot->tick_time = tick_time;
+    snapshot->tick_duration_ns = game->tick_duration_ns;
+    snapshot->fruit = game->fruit;
+    snapshot->score = game->score;
+    snapshot->game_over = game->game_over;
+
+    // Every segment moved into the cell of the one in front of it, so it came from where the
+    // segment behind it is now. The oldest tail came from the vacated cell, and a segment
+    // added by snake_grow() did not move at all.
+    const Snake *snake = &game->snake;
+    size_t first_moved = game->grew ? 1 : 0;
+    snapshot->segment_count = 0;
+    for (size_t i = 0; i < snake->size; i++) {
+        Vector3 curr = SNAKE_AT(snake, i);
+        Vector3 prev;
+        if (game->tick == 0 || i < first_moved) {
+            prev = curr;
+        } else if (i == first_moved) {
+            prev = game->vacated;
+        } else {
+            prev = SNAKE_AT(snake, i - 1);
+        }
+        if (!cell_in_grid(curr)) continue;
+        snapshot->segments[snapshot->segment_count++] = (Segment) { prev, curr };
     }
-    SetRandomSeed(time(0));
-    game->fruit = gen_fruit();
-    game->camera = (Camera) {
-        .position = { 0, GRID_SIZE / 2 + 2, GRID_SIZE / 2 + 2 },
-        .target = Vector3Zero(),
-        .up = { 0.0f, 1.0f, 0.0f },
-        .fovy = 100.0f,
-        .projection = CAMERA_PERSPECTIVE,
-    };
+
+    memcpy(snapshot->footprint, game->shadow.footprint, sizeof(snapshot->footprint));
 }
 
+// Lock-free triple buffer handing snapshots from the simulation thread over to the render thread.
+// The writer and the reader each own one buffer, and atomically swap theirs with the one in the
+// middle. Neither side ever waits for the other, and the reader always gets the latest snapshot.
+#define TRIPLE_BUFFER_FRESH 4 // Set on `middle` when it holds a snapshot the reader has not seen yet
+
+typedef struct {
+    Snapshot buffers[3];
+    _Atomic int middle;
+    int write_index; // Only touched by the writer
+    int read_index;  // Only touched by the reader
+} Triple_Buffer;
+
+void triple_buffer_init(Triple_Buffer *tb) {
+    tb->write_index = 0;
+    atomic_init(&tb->middle, 1);
+    tb->read_index = 2;
+}
+
+Snapshot *triple_buffer_write_slot(Triple_Buffer *tb) {
+    return &tb->buffers[tb->write_index];
+}
+
+void triple_buffer_publish(Triple_Buffer *tb) {
+    int prev = atomic_exchange_explicit(&tb->middle, tb->write_index | TRIPLE_BUFFER_FRESH, memory_order_acq_rel);
+    tb->write_index = prev & ~TRIPLE_BUFFER_FRESH;
+}
+
+const Snapshot *triple_buffer_read(Triple_Buffer *tb) {
+    if (atomic_load_explicit(&tb->middle, memory_order_relaxed) & TRIPLE_BUFFER_FRESH) {
+        int prev = atomic_exchange_explicit(&tb->middle, tb->read_index, memory_order_acq_rel);
+        tb->read_index = prev & ~TRIPLE_BUFFER_FRESH;
+    }
+    return &tb->buffers[tb->read_index];
+}
+
+Game game;
+Steering steering;
+Input_Queue input_queue;
+Latency_Queue latency_queue;
+Triple_Buffer snapshots;
+Bot bot;
+bool bot_enabled;
+
+void sim_publish(const Game *game, double tick_time) {
+    snapshot_take(triple_buffer_write_slot(&snapshots), game, tick_time);
+    triple_buffer_publish(&snapshots);
+}
+
+Alloc_Track tick_allocs = { .name = "tick" };
+Perf_Track tick_perf = { .name = "tick" };
+
+// Applies the queued input and runs the tick if it is due by `now`
+void sim_advance(Game *game, double now) {
+    Input_Event event;
+    while (input_queue_pop(&input_queue, &event)) {
+        if (game_steer(game, event.dir)) {
+            da_append(&steering, ((Input_Latency) { .pressed_ns = event.pressed_ns, .dequeued_ns = clock_now_ns() }));
+        }
+    }
+
+    if (game->game_over || now < game->next_tick) return;
+    // The bot plans on the state right before the tick and turns the same way a key press would.
+    // Like in the server it stays out of the tick counters, those measure the tick alone.
+    bool bot_turned = false;
+    if (bot_enabled) Profile("bot") bot_turned = bot_steer(&bot, game);
+    if (bot_turned) da_append(&steering, ((Input_Latency) { .bot = true }));
+    profile_mark("tick boundary");
+    alloc_track_begin(&tick_allocs);
+    perf_track_begin(&tick_perf);
+    uint64_t tick_start = clock_now_ns();
+    bool turning = game->dir_queue.count > 0;
+    Profile("tick") game_tick(game);
+    game->tick_duration_ns = clock_now_ns() - tick_start;
+    if (turning) {
+        Input_Latency latency = steering.items[0];
+        memmove(steering.items, steering.items + 1, (steering.count - 1)*sizeof(*steering.items));
+        steering.count--;
+        latency.applied_ns = tick_start;
+        latency.tick = game->tick;
+        // Not worth stalling the simulation over, the render thread would catch up eventually
+        if (!latency.bot) latency_queue_push(&latency_queue, latency);
+    }
+    game->next_tick += TICK_INTERVAL;
+    // Do not try to catch up on ticks missed during a stall, that would just teleport the snake
+    if (game->next_tick <= now) game->next_tick = now + TICK_INTERVAL;
+    Profile("publish") sim_publish(game, now);
+    perf_track_end(&tick_perf);
+    alloc_track_end(&tick_allocs);
+}
+
+#ifdef SIM_THREADED
+// Upper bound on how long the simulation thread sleeps, so it notices shutdown quickly
+#define SIM_MAX_SLEEP 0.05
+
+atomic_bool sim_running;
+
+void *sim_thread(void *arg) {
+    Game *game = arg;
+    profile_set_thread_name("simulation");
+    perf_track_open(&tick_perf);
+    while (atomic_load(&sim_running)) {
+        sim_advance(game, clock_now());
+        double wait = game->game_over ? SIM_MAX_SLEEP : game->next_tick - clock_now();
+        sleep_seconds(wait < SIM_MAX_SLEEP ? wait : SIM_MAX_SLEEP);
+    }
+    return NULL;
+}
+#endif // SIM_THREADED
+
 #define BACKGROUND_COLOR SKYBLUE
 #define GRID_COLOR WHITE
 #define SNAKE_COLOR RED
 #define FRUIT_COLOR BLUE
+#define SHADOW_ALPHA 0.5f
 
-void game_update(Game *game) {
-    if (IsKeyPressed(KEY_F)) ToggleBorderlessWindowed();
-    if (game->game_over) {
-        Drawing {
-            ClearBackground(RED);
-            int width = GetScreenWidth();
-            int height = GetScreenHeight();
+#define SHADOW_BOTTOM_Y (-GRID_SIZE / 2 - 3/2)
+#define SHADOW_TOP_Y (GRID_SIZE / 2)
 
-            const char *text = "Game Over";
-            int font_size = (width + height) / (strlen(text) * 2);
-            int w = MeasureText(text, font_size);
-            DrawText(text, (width - w) / 2, 50, font_size, WHITE);
+#define LATTICE_COLOR ColorAlpha(GRID_COLOR, 0.25f)
+#define LATTICE_THICKNESS 0.02f
+
+// Which part of the grid lattice is shown as a visual guide
+typedef enum {
+    LATTICE_NONE,
+    LATTICE_FLOOR, // Only the bottom plane
+    LATTICE_SHELL, // Only the lines lying on the faces of the grid
+    LATTICE_FULL,  // Every cell boundary
+    COUNT_LATTICES,
+} Lattice;
+
+bool lattice_has_line(Lattice lattice, int axis, int i, int j) {
+    static_assert(COUNT_LATTICES == 4, "Please update after adding a new lattice");
+    switch (lattice) {
+        case LATTICE_NONE: return false;
+        // y is the `u` coordinate of x-lines and the `v` coordinate of z-lines
+        case LATTICE_FLOOR: return (axis == 0 && i == 0) || (axis == 2 && j == 0);
+        case LATTICE_SHELL: return i == 0 || i == GRID_SIZE || j == 0 || j == GRID_SIZE;
+        case LATTICE_FULL: return true;
+        default: UNREACHABLE("invalid lattice");
+    }
+}
+
+// Builds every line of the lattice into a single static mesh, so the whole thing is one draw call.
+// GL lines are not exposed through raylib meshes, so each line is a thin square prism instead.
+Mesh gen_mesh_lattice(Lattice lattice) {
+    const int verts_per_line = 4*6; // 4 sides, 2 triangles each
+    const float lo = -GRID_SIZE / 2 - 0.5f;
+    const float t = LATTICE_THICKNESS / 2;
+    const float corners[5][2] = { {t, -t}, {t, t}, {-t, t}, {-t, -t}, {t, -t} };
 
-            text = TextFormat("Score: %d", game->score);
-            font_size = (width + height) / (strlen(text) * 3);
-            w = MeasureText(text, font_size);
-            DrawText(text, (width - w) / 2, height / 2, font_size, WHITE);
+    int lines = 0;
+    for (int axis = 0; axis < 3; axis++) {
+        for (int i = 0; i <= GRID_SIZE; i++) {
+            for (int j = 0; j <= GRID_SIZE; j++) {
+                if (lattice_has_line(lattice, axis, i, j)) lines++;
+            }
         }
-        return;
     }
 
-    // TODO: better camera controls that don't conflict with snake WASD
-    if (IsKeyDown(KEY_SPACE)) UpdateCamera(&game->camera, CAMERA_ORBITAL);
+    Mesh mesh = {0};
+    mesh.vertexCount = lines*verts_per_line;
+    mesh.triangleCount = mesh.vertexCount / 3;
+    mesh.vertices = MemAlloc(mesh.vertexCount*3*sizeof(float));
 
-    Vector3 new_dir = get_keyboard_dir();
-    if (!vector3_near_eq(new_dir, Vector3Zero())) {
-        Vector3 last = last_dir(game->dir_queue, &game->snake);
-        if (!vector3_near_eq(new_dir, last) && !vector3_near_eq(new_dir, Vector3Scale(last, -1))) {
-            da_append(&game->dir_queue, new_dir);
+    float *v = mesh.vertices;
+    for (int axis = 0; axis < 3; axis++) {
+        // (u, v, axis) form a right-handed basis, which keeps the winding below facing outwards
+        int u_axis = (axis + 1) % 3;
+        int v_axis = (axis + 2) % 3;
+        for (int i = 0; i <= GRID_SIZE; i++) {
+            for (int j = 0; j <= GRID_SIZE; j++) {
+                if (!lattice_has_line(lattice, axis, i, j)) continue;
+                for (int k = 0; k < 4; k++) {
+                    float quad[4][3]; // A0, A1, B1, B0
+                    for (int q = 0; q < 4; q++) {
+                        const float *c = corners[k + (q == 1 || q == 2)];
+                        quad[q][axis] = q < 2 ? lo : lo + GRID_SIZE;
+                        quad[q][u_axis] = lo + i + c[0];
+                        quad[q][v_axis] = lo + j + c[1];
+                    }
+                    const int order[6] = { 0, 1, 2, 0, 2, 3 };
+                    for (int o = 0; o < 6; o++) {
+                        memcpy(v, quad[order[o]], sizeof(quad[0]));
+                        v += 3;
+                    }
+                }
+            }
         }
     }
 
-    game->time += GetFrameTime();
-    if (game->time >= 0.5) {
-        game->time = 0;
+    UploadMesh(&mesh, false);
+    return mesh;
+}
+
+// Segments are drawn with a single instanced draw call. The vertex shader moves each instance
+// from its previous cell to its current one, so sub-tick motion costs one uniform per frame.
+#if defined(PLATFORM_WEB)
+const char *segment_vs =
+    "#version 100\n"
+    "attribute vec3 vertexPosition;\n"
+    "attribute vec3 instancePrev;\n"
+    "attribute vec3 instanceCurr;\n"
+    "uniform mat4 mvp;\n"
+    "uniform float alpha;\n"
+    "uniform float gridSize;\n"
+    "uniform float gridOffset;\n"
+    "void main() {\n"
+    "    vec3 d = instanceCurr - instancePrev;\n"
+    "    d -= gridSize*floor(d/gridSize + 0.5);\n" // Go the short way around the torus
+    "    vec3 cell = mod(instancePrev + d*alpha + 0.5, gridSize) - 0.5;\n"
+    "    gl_Position = mvp*vec4(vertexPosition + cell - gridOffset, 1.0);\n"
+    "}\n";
+const char *segment_fs =
+    "#version 100\n"
+    "precision mediump float;\n"
+    "uniform vec4 color;\n"
+    "void main() {\n"
+    "    gl_FragColor = color;\n"
+    "}\n";
+#else
+const char *segment_vs =
+    "#version 330\n"
+    "in vec3 vertexPosition;\n"
+    "in vec3 instancePrev;\n"
+    "in vec3 instanceCurr;\n"
+    "uniform mat4 mvp;\n"
+    "uniform float alpha;\n"
+    "uniform float gridSize;\n"
+    "uniform float gridOffset;\n"
+    "void main() {\n"
+    "    vec3 d = instanceCurr - instancePrev;\n"
+    "    d -= gridSize*round(d/gridSize);\n" // Go the short way around the torus
+    "    vec3 cell = mod(instancePrev + d*alpha + 0.5, gridSize) - 0.5;\n"
+    "    gl_Position = mvp*vec4(vertexPosition + cell - gridOffset, 1.0);\n"
+    "}\n";
+const char *segment_fs =
+    "#version 330\n"
+    "uniform vec4 color;\n"
+    "out vec4 finalColor;\n"
+    "void main() {\n"
+    "    finalColor = color;\n"
+    "}\n";
+#endif // PLATFORM_WEB
+
+// Unit cube as 12 counter-clockwise triangles
+const float cube_vertices[] = {
+    -0.5f, -0.5f,  0.5f,   0.5f, -0.5f,  0.5f,   0.5f,  0.5f,  0.5f,  -0.5f, -0.5f,  0.5f,   0.5f,  0.5f,  0.5f,  -0.5f,  0.5f,  0.5f,
+     0.5f, -0.5f, -0.5f,  -0.5f, -0.5f, -0.5f,  -0.5f,  0.5f, -0.5f,   0.5f, -0.5f, -0.5f,  -0.5f,  0.5f, -0.5f,   0.5f,  0.5f, -0.5f,
+     0.5f, -0.5f,  0.5f,   0.5f, -0.5f, -0.5f,   0.5f,  0.5f, -0.5f,   0.5f, -0.5f,  0.5f,   0.5f,  0.5f, -0.5f,   0.5f,  0.5f,  0.5f,
+    -0.5f, -0.5f, -0.5f,  -0.5f, -0.5f,  0.5f,  -0.5f,  0.5f,  0.5f,  -0.5f, -0.5f, -0.5f,  -0.5f,  0.5f,  0.5f,  -0.5f,  0.5f, -0.5f,
+    -0.5f,  0.5f,  0.5f,   0.5f,  0.5f,  0.5f,   0.5f,  0.5f, -0.5f,  -0.5f,  0.5f,  0.5f,   0.5f,  0.5f, -0.5f,  -0.5f,  0.5f, -0.5f,
+    -0.5f, -0.5f, -0.5f,   0.5f, -0.5f, -0.5f,   0.5f, -0.5f,  0.5f,  -0.5f, -0.5f, -0.5f,   0.5f, -0.5f,  0.5f,  -0.5f, -0.5f,  0.5f,
+};
+
+typedef struct {
+    Shader shader;
+    int loc_position, loc_prev, loc_curr;
+    int loc_mvp, loc_alpha, loc_grid_size, loc_grid_offset, loc_color;
+    unsigned int vao;
+    unsigned int cube_vbo;
+    unsigned int instance_vbo;
+    size_t instance_count;
+    uint64_t instance_tick; // Tick of the snapshot currently uploaded to instance_vbo
+} Segment_Renderer;
+
+void segment_renderer_bind_attributes(Segment_Renderer *sr) {
+    rlEnableVertexBuffer(sr->cube_vbo);
+    rlSetVertexAttribute(sr->loc_position, 3, RL_FLOAT, false, 0, 0);
+    rlEnableVertexAttribute(sr->loc_position);
+
+    rlEnableVertexBuffer(sr->instance_vbo);
+    rlSetVertexAttribute(sr->loc_prev, 3, RL_FLOAT, false, sizeof(Segment), offsetof(Segment, prev));
+    rlSetVertexAttributeDivisor(sr->loc_prev, 1);
+    rlEnableVertexAttribute(sr->loc_prev);
+    rlSetVertexAttribute(sr->loc_curr, 3, RL_FLOAT, false, sizeof(Segment), offsetof(Segment, curr));
+    rlSetVertexAttributeDivisor(sr->loc_curr, 1);
+    rlEnableVertexAttribute(sr->loc_curr);
+    rlDisableVertexBuffer();
+}
+
+void segment_renderer_init(Segment_Renderer *sr) {
+    sr->shader = LoadShaderFromMemory(segment_vs, segment_fs);
+    sr->loc_position = GetShaderLocationAttrib(sr->shader, "vertexPosition");
+    sr->loc_prev = GetShaderLocationAttrib(sr->shader, "instancePrev");
+    sr->loc_curr = GetShaderLocationAttrib(sr->shader, "instanceCurr");
+    sr->loc_mvp = GetShaderLocation(sr->shader, "mvp");
+    sr->loc_alpha = GetShaderLocation(sr->shader, "alpha");
+    sr->loc_grid_size = GetShaderLocation(sr->shader, "gridSize");
+    sr->loc_grid_offset = GetShaderLocation(sr->shader, "gridOffset");
+    sr->loc_color = GetShaderLocation(sr->shader, "color");
+
+    sr->cube_vbo = rlLoadVertexBuffer(cube_vertices, sizeof(cube_vertices), false);
+    sr->instance_vbo = rlLoadVertexBuffer(NULL, sizeof(((Snapshot*)0)->segments), true);
+    sr->instance_tick = UINT64_MAX;
+
+    // Without VAO support (plain GLES2) the attributes are bound again on every draw instead
+    sr->vao = rlLoadVertexArray();
+    if (rlEnableVertexArray(sr->vao)) {
+        segment_renderer_bind_attributes(sr);
+        rlDisableVertexArray();
+    }
+}
+
+void segment_renderer_deinit(Segment_Renderer *sr) {
+    rlUnloadVertexArray(sr->vao);
+    rlUnloadVertexBuffer(sr->cube_vbo);
+    rlUnloadVertexBuffer(sr->instance_vbo);
+    UnloadShader(sr->shader);
+}
+
+// Only happens once per tick, frames in between just change the alpha uniform
+void segment_renderer_upload(Segment_Renderer *sr, const Snapshot *snapshot) {
+    if (sr->instance_tick == snapshot->tick) return;
+    sr->instance_tick = snapshot->tick;
+    sr->instance_count = snapshot->segment_count;
+    rlUpdateVertexBuffer(sr->instance_vbo, snapshot->segments, sr->instance_count*sizeof(Segment), 0);
+}
 
-        if (game->dir_queue.count > 0) {
-            Vector3 new_dir = dir_queue_pop(&game->dir_queue);
-            game->snake.dir = new_dir;
+void segment_renderer_draw(Segment_Renderer *sr, float alpha, Color color) {
+    if (sr->instance_count == 0) return;
+
+    // Whatever is queued in the immediate mode batch has to go out before our own draw call
+    render_stats_flush();
+    rlDrawRenderBatchActive();
+
+    rlEnableShader(sr->shader.id);
+    float grid_size = GRID_SIZE;
+    float grid_offset = GRID_SIZE / 2;
+    Vector4 color_normalized = ColorNormalize(color);
+    rlSetUniformMatrix(sr->loc_mvp, MatrixMultiply(rlGetMatrixModelview(), rlGetMatrixProjection()));
+    rlSetUniform(sr->loc_alpha, &alpha, RL_SHADER_UNIFORM_FLOAT, 1);
+    rlSetUniform(sr->loc_grid_size, &grid_size, RL_SHADER_UNIFORM_FLOAT, 1);
+    rlSetUniform(sr->loc_grid_offset, &grid_offset, RL_SHADER_UNIFORM_FLOAT, 1);
+    rlSetUniform(sr->loc_color, &color_normalized, RL_SHADER_UNIFORM_VEC4, 1);
+
+    if (!rlEnableVertexArray(sr->vao)) segment_renderer_bind_attributes(sr);
+    rlDrawVertexArrayInstanced(0, ARRAY_LEN(cube_vertices)/3, sr->instance_count);
+    rlDisableVertexArray();
+    rlDisableShader();
+    render_stats_direct_draw(ARRAY_LEN(cube_vertices)/3*sr->instance_count, 2);
+}
+
+// Rolling window of durations with a histogram kept in sync with it, so percentiles can be
+// read every frame without sorting or allocating anything
+#define TIME_STATS_WINDOW 256
+#define TIME_STATS_BUCKET_NS 50000 // 0.05ms
+#define TIME_STATS_BUCKETS 2000    // Up to 100ms, anything slower lands in the last bucket
+
+typedef struct {
+    uint64_t samples[TIME_STATS_WINDOW];
+    size_t count;
+    size_t next;
+    uint32_t histogram[TIME_STATS_BUCKETS];
+} Time_Stats;
+
+size_t time_stats_bucket(uint64_t ns) {
+    size_t bucket = ns / TIME_STATS_BUCKET_NS;
+    return bucket < TIME_STATS_BUCKETS ? bucket : TIME_STATS_BUCKETS - 1;
+}
+
+void time_stats_add(Time_Stats *ts, uint64_t ns) {
+    if (ts->count == TIME_STATS_WINDOW) {
+        ts->histogram[time_stats_bucket(ts->samples[ts->next])]--;
+    } else {
+        ts->count++;
+    }
+    ts->samples[ts->next] = ns;
+    ts->histogram[time_stats_bucket(ns)]++;
+    ts->next = (ts->next + 1) % TIME_STATS_WINDOW;
+}
+
+// Upper edge of the bucket holding the p-th percentile (0..1) of the window
+uint64_t time_stats_percentile(const Time_Stats *ts, double p) {
+    if (ts->count == 0) return 0;
+    size_t rank = p*ts->count;
+    if (rank >= ts->count) rank = ts->count - 1;
+    size_t seen = 0;
+    for (size_t i = 0; i < TIME_STATS_BUCKETS; i++) {
+        seen += ts->histogram[i];
+        if (seen > rank) return (i + 1)*TIME_STATS_BUCKET_NS;
+    }
+    UNREACHABLE("histogram out of sync with the samples");
+}
+
+uint64_t time_stats_max(const Time_Stats *ts) {
+    uint64_t max = 0;
+    for (size_t i = 0; i < ts->count; i++) {
+        if (ts->samples[i] > max) max = ts->samples[i];
+    }
+    return max;
+}
+
+// i-th sample from the oldest one in the window
+uint64_t time_stats_at(const Time_Stats *ts, size_t i) {
+    size_t oldest = ts->count == TIME_STATS_WINDOW ? ts->next : 0;
+    return ts->samples[(oldest + i) % TIME_STATS_WINDOW];
+}
+
+// Input latency over the whole session, split into where the time went
+#define LATENCY_BUCKET_NS 5000000 // 5ms
+#define LATENCY_BUCKETS 400       // Up to 2s, anything slower lands in the last bucket
+#define LATENCY_PENDING_CAPACITY 64
+
+typedef enum {
+    LATENCY_QUEUED,     // Pressed until the simulation picked it up
+    LATENCY_TICK_WAIT,  // Picked up until the tick that applied it
+    LATENCY_FRAME_WAIT, // Applied until the first frame showing it was presented
+    LATENCY_TOTAL,
+    COUNT_LATENCY_STAGES,
+} Latency_Stage;
+
+const char *latency_stage_name(Latency_Stage stage) {
+    static_assert(COUNT_LATENCY_STAGES == 4, "Please update after adding a new stage");
+    switch (stage) {
+        case LATENCY_QUEUED: return "queued";
+        case LATENCY_TICK_WAIT: return "tick wait";
+        case LATENCY_FRAME_WAIT: return "frame wait";
+        case LATENCY_TOTAL: return "total";
+        default: UNREACHABLE("invalid latency stage");
+    }
+}
+
+typedef struct {
+    uint32_t histogram[COUNT_LATENCY_STAGES][LATENCY_BUCKETS];
+    uint64_t max_ns[COUNT_LATENCY_STAGES];
+    size_t count;
+    size_t dropped; // Turns the render thread lost track of before they were shown
+    // Applied turns waiting for a frame to show them
+    Input_Latency pending[LATENCY_PENDING_CAPACITY];
+    size_t pending_count;
+} Latency_Stats;
+
+void latency_stats_add_stage(Latency_Stats *ls, Latency_Stage stage, uint64_t ns) {
+    size_t bucket = ns / LATENCY_BUCKET_NS;
+    ls->histogram[stage][bucket < LATENCY_BUCKETS ? bucket : LATENCY_BUCKETS - 1]++;
+    if (ns > ls->max_ns[stage]) ls->max_ns[stage] = ns;
+}
+
+void latency_stats_collect(Latency_Stats *ls, Latency_Queue *q) {
+    Input_Latency latency;
+    while (latency_queue_pop(q, &latency)) {
+        if (ls->pending_count == LATENCY_PENDING_CAPACITY) {
+            ls->dropped++;
+            continue;
         }
+        ls->pending[ls->pending_count++] = latency;
+    }
+}
 
-        if (!snake_update(&game->snake)) {
-            game->game_over = true;
-            return;
+// A frame showing `tick` was presented at `presented_ns`
+void latency_stats_presented(Latency_Stats *ls, uint64_t tick, uint64_t presented_ns) {
+    size_t kept = 0;
+    for (size_t i = 0; i < ls->pending_count; i++) {
+        Input_Latency *l = &ls->pending[i];
+        if (l->tick > tick) {
+            ls->pending[kept++] = *l;
+            continue;
         }
-        if (vector3_near_eq(snake_head(&game->snake), game->fruit)) {
-            game->score++;
-            snake_grow(&game->snake);
-            do {
-                game->fruit = gen_fruit();
-            } while (snake_contains(&game->snake, game->fruit));
+        latency_stats_add_stage(ls, LATENCY_QUEUED, l->dequeued_ns - l->pressed_ns);
+        latency_stats_add_stage(ls, LATENCY_TICK_WAIT, l->applied_ns - l->dequeued_ns);
+        latency_stats_add_stage(ls, LATENCY_FRAME_WAIT, presented_ns - l->applied_ns);
+        latency_stats_add_stage(ls, LATENCY_TOTAL, presented_ns - l->pressed_ns);
+        ls->count++;
+    }
+    ls->pending_count = kept;
+}
+
+// Upper edge of the bucket holding the p-th percentile (0..1), clamped to the slowest sample
+uint64_t latency_stats_percentile(const Latency_Stats *ls, Latency_Stage stage, double p) {
+    if (ls->count == 0) return 0;
+    size_t rank = p*ls->count;
+    if (rank >= ls->count) rank = ls->count - 1;
+    size_t seen = 0;
+    for (size_t i = 0; i < LATENCY_BUCKETS; i++) {
+        seen += ls->histogram[stage][i];
+        if (seen > rank) {
+            uint64_t edge = (i + 1)*LATENCY_BUCKET_NS;
+            return edge < ls->max_ns[stage] ? edge : ls->max_ns[stage];
+        }
+    }
+    UNREACHABLE("histogram out of sync with the count");
+}
+
+#define LATENCY_REPORT_BIN_NS 50000000 // 50ms
+#define LATENCY_REPORT_BAR_WIDTH 50
+
+void latency_report(FILE *stream, const Latency_Stats *ls) {
+    fprintf(stream, "Input latency of %zu turns", ls->count);
+    if (ls->dropped > 0) fprintf(stream, " (%zu more were not tracked)", ls->dropped);
+    fprintf(stream, ":\n");
+    if (ls->count == 0) return;
+
+    fprintf(stream, "  %-10s %9s %9s %9s %9s\n", "", "p50 ms", "p95 ms", "p99 ms", "max ms");
+    for (Latency_Stage stage = 0; stage < COUNT_LATENCY_STAGES; stage++) {
+        fprintf(stream, "  %-10s %9.1f %9.1f %9.1f %9.1f\n", latency_stage_name(stage),
+                latency_stats_percentile(ls, stage, 0.50)*1e-6, latency_stats_percentile(ls, stage, 0.95)*1e-6,
+                latency_stats_percentile(ls, stage, 0.99)*1e-6, ls->max_ns[stage]*1e-6);
+    }
+
+    // Histogram of the total latency in coarser bins, up to the slowest one
+    size_t per_bin = LATENCY_REPORT_BIN_NS / LATENCY_BUCKET_NS;
+    size_t bins = (ls->max_ns[LATENCY_TOTAL] / LATENCY_BUCKET_NS) / per_bin + 1;
+    if (bins*per_bin > LATENCY_BUCKETS) bins = LATENCY_BUCKETS / per_bin;
+    size_t counts[LATENCY_BUCKETS] = {0};
+    size_t most = 0;
+    for (size_t bin = 0; bin < bins; bin++) {
+        for (size_t i = bin*per_bin; i < (bin + 1)*per_bin; i++) counts[bin] += ls->histogram[LATENCY_TOTAL][i];
+        if (counts[bin] > most) most = counts[bin];
+    }
+    for (size_t bin = 0; bin < bins; bin++) {
+        int width = (int)(counts[bin]*LATENCY_REPORT_BAR_WIDTH/most);
+        fprintf(stream, "  %4zu-%4zu ms %5zu |%.*s\n", bin*LATENCY_REPORT_BIN_NS/1000000, (bin + 1)*LATENCY_REPORT_BIN_NS/1000000,
+                counts[bin], width, "##################################################");
+    }
+}
+
+#define HUD_FONT_SIZE 10
+#define HUD_GRAPH_HEIGHT 40
+#define HUD_GRAPH_BAR_WIDTH 1
+#define HUD_GRAPH_BUDGET_NS 16666667 // Height of the graph is one 60Hz frame
+#define HUD_GRAPH_COLOR LIME
+#define HUD_GRAPH_OVER_BUDGET_COLOR RED
+
+int draw_time_stats_line(const char *label, const Time_Stats *ts, int x, int y) {
+    // Bucket edges can overshoot the actual slowest sample
+    uint64_t max = time_stats_max(ts);
+    uint64_t p50 = time_stats_percentile(ts, 0.50);
+    uint64_t p95 = time_stats_percentile(ts, 0.95);
+    uint64_t p99 = time_stats_percentile(ts, 0.99);
+    DrawText(TextFormat("%-5s p50 %5.2f  p95 %5.2f  p99 %5.2f  max %5.2f ms", label,
+                        (p50 < max ? p50 : max)*1e-6, (p95 < max ? p95 : max)*1e-6,
+                        (p99 < max ? p99 : max)*1e-6, max*1e-6),
+             x, y, HUD_FONT_SIZE, WHITE);
+    return y + HUD_FONT_SIZE + 2;
+}
+
+int draw_latency_line(const Latency_Stats *ls, int x, int y) {
+    DrawText(TextFormat("%-5s p50 %5.0f  p95 %5.0f  p99 %5.0f  max %5.0f ms", "input",
+                        latency_stats_percentile(ls, LATENCY_TOTAL, 0.50)*1e-6,
+                        latency_stats_percentile(ls, LATENCY_TOTAL, 0.95)*1e-6,
+                        latency_stats_percentile(ls, LATENCY_TOTAL, 0.99)*1e-6,
+                        ls->max_ns[LATENCY_TOTAL]*1e-6),
+             x, y, HUD_FONT_SIZE, WHITE);
+    return y + HUD_FONT_SIZE + 2;
+}
+
+void draw_frame_time_graph(const Time_Stats *ts, int x, int y) {
+    DrawRectangle(x, y, TIME_STATS_WINDOW*HUD_GRAPH_BAR_WIDTH, HUD_GRAPH_HEIGHT, Fade(BLACK, 0.4f));
+    for (size_t i = 0; i < ts->count; i++) {
+        uint64_t ns = time_stats_at(ts, i);
+        bool over_budget = ns > HUD_GRAPH_BUDGET_NS;
+        int h = over_budget ? HUD_GRAPH_HEIGHT : (int)(ns*HUD_GRAPH_HEIGHT/HUD_GRAPH_BUDGET_NS);
+        if (h < 1) h = 1;
+        DrawRectangle(x + i*HUD_GRAPH_BAR_WIDTH, y + HUD_GRAPH_HEIGHT - h, HUD_GRAPH_BAR_WIDTH, h,
+                      over_budget ? HUD_GRAPH_OVER_BUDGET_COLOR : HUD_GRAPH_COLOR);
+    }
+}
+
+// Render-on-change: a frame is only drawn when something visible changed since the last one
+#define IDLE_POLL_INTERVAL (1.0/60.0)
+// Redraw every now and then anyway in case the window system lost the contents of the window
+#define IDLE_REDRAW_INTERVAL 1.0
+// While the segments glide between cells, a new frame is only worth it once they moved this much
+// of a cell. At the usual tick interval that is about 48 frames per second rather than every one.
+#define SMOOTH_ALPHA_STEP (1.0f/24.0f)
+
+typedef struct {
+    Camera camera;
+    Texture2D shadow_texture;
+    unsigned char shadow_footprint[GRID_SIZE*GRID_SIZE]; // What is currently uploaded to shadow_texture
+    Model lattice_models[COUNT_LATTICES];
+    Lattice lattice;
+    Segment_Renderer segments;
+
+    bool smooth;     // Interpolate the segments between ticks
+    bool continuous; // Draw every iteration regardless of the dirty flag
+    bool dirty;
+    bool was_focused;
+    double last_frame_time;
+    uint64_t drawn_tick;
+    float drawn_alpha;
+
+    bool show_render_stats;
+    Time_Stats frame_stats; // Time from the start of a frame until it is presented
+    Time_Stats tick_stats;
+    uint64_t stats_tick;    // Last tick whose duration went into tick_stats
+    Latency_Stats latency;
+} Renderer;
+
+void renderer_init(Renderer *renderer) {
+    renderer->camera = (Camera) {
+        .position = { 0, GRID_SIZE / 2 + 2, GRID_SIZE / 2 + 2 },
+        .target = Vector3Zero(),
+        .up = { 0.0f, 1.0f, 0.0f },
+        .fovy = 100.0f,
+        .projection = CAMERA_PERSPECTIVE,
+    };
+
+    Image image = GenImageColor(GRID_SIZE, GRID_SIZE, BLANK);
+    renderer->shadow_texture = LoadTextureFromImage(image);
+    UnloadImage(image);
+    memset(renderer->shadow_footprint, FOOTPRINT_NONE, sizeof(renderer->shadow_footprint));
+
+    segment_renderer_init(&renderer->segments);
+    render_stats_init();
+
+    renderer->dirty = true;
+    renderer->was_focused = IsWindowFocused();
+}
+
+void renderer_deinit(Renderer *renderer) {
+    UnloadTexture(renderer->shadow_texture);
+    for (Lattice lattice = LATTICE_NONE + 1; lattice < COUNT_LATTICES; lattice++) {
+        if (renderer->lattice_models[lattice].meshCount > 0) UnloadModel(renderer->lattice_models[lattice]);
+    }
+    segment_renderer_deinit(&renderer->segments);
+    render_stats_deinit();
+}
+
+// The lattices start out hidden, so each mesh is only built the first time it is shown instead of
+// holding up the first frame
+Model *renderer_lattice_model(Renderer *renderer, Lattice lattice) {
+    Model *model = &renderer->lattice_models[lattice];
+    if (model->meshCount == 0) *model = LoadModelFromMesh(gen_mesh_lattice(lattice));
+    return model;
+}
+
+// How far the segments are between the previous tick and the current one
+float renderer_tick_alpha(const Renderer *renderer, const Snapshot *snapshot) {
+    if (!renderer->smooth) return 1.0f;
+    return Clamp((clock_now() - snapshot->tick_time) / TICK_INTERVAL, 0.0f, 1.0f);
+}
+
+Color footprint_color(Footprint footprint) {
+    switch (footprint) {
+        case FOOTPRINT_NONE: return BLANK;
+        case FOOTPRINT_SNAKE: return ColorAlpha(SNAKE_COLOR, SHADOW_ALPHA);
+        case FOOTPRINT_FRUIT: return ColorAlpha(FRUIT_COLOR, SHADOW_ALPHA);
+        default: UNREACHABLE("invalid footprint");
+    }
+}
+
+// The renderer may skip snapshots, so diff against what was uploaded last rather than
+// relying on per-tick change lists. Still GRID_SIZE^2 bytes at most, whatever the snake length.
+void renderer_sync_shadow(Renderer *renderer, const Snapshot *snapshot) {
+    for (size_t i = 0; i < ARRAY_LEN(snapshot->footprint); i++) {
+        if (snapshot->footprint[i] == renderer->shadow_footprint[i]) continue;
+        renderer->shadow_footprint[i] = snapshot->footprint[i];
+        Color color = footprint_color(snapshot->footprint[i]);
+        Rectangle rec = { i % GRID_SIZE, i / GRID_SIZE, 1, 1 };
+        UpdateTextureRec(renderer->shadow_texture, rec, &color);
+    }
+}
+
+void draw_shadow_quad(Texture2D texture, float y, bool facing_up) {
+    float x0 = -GRID_SIZE / 2 - 0.5f, x1 = x0 + GRID_SIZE;
+    float z0 = -GRID_SIZE / 2 - 0.5f, z1 = z0 + GRID_SIZE;
+    Vector2 uv[4]  = { {0, 0}, {0, 1}, {1, 1}, {1, 0} };
+    Vector3 pos[4] = { {x0, y, z0}, {x0, y, z1}, {x1, y, z1}, {x1, y, z0} };
+
+    rlSetTexture(texture.id);
+    rlBegin(RL_QUADS);
+        rlColor4ub(255, 255, 255, 255);
+        for (int k = 0; k < 4; k++) {
+            // Reverse the winding for the ceiling so it survives backface culling from below
+            int j = facing_up ? k : 3 - k;
+            rlTexCoord2f(uv[j].x, uv[j].y);
+            rlVertex3f(pos[j].x, pos[j].y, pos[j].z);
         }
+    rlEnd();
+    rlSetTexture(0);
+}
+
+// Decides whether the current iteration has to draw a frame. When it does not, the frame on
+// screen is reused and the iteration just polls input and sleeps a little instead.
+bool renderer_should_draw(Renderer *renderer) {
+    bool focused = IsWindowFocused();
+    if (IsWindowResized() || focused != renderer->was_focused) renderer->dirty = true;
+    renderer->was_focused = focused;
+
+    double now = GetTime();
+    if (renderer->continuous || renderer->dirty || now - renderer->last_frame_time >= IDLE_REDRAW_INTERVAL) {
+        renderer->dirty = false;
+        renderer->last_frame_time = now;
+        return true;
+    }
+
+    // EndDrawing() is what normally polls input, so it has to be done by hand for skipped frames
+    PollInputEvents();
+#ifndef PLATFORM_WEB
+    // On the web the browser already paces us with requestAnimationFrame
+    WaitTime(IDLE_POLL_INTERVAL);
+#endif // PLATFORM_WEB
+    return false;
+}
+
+void draw_game_over(const Snapshot *snapshot) {
+    Drawing {
+        ClearBackground(RED);
+        int width = GetScreenWidth();
+        int height = GetScreenHeight();
+
+        const char *text = "Game Over";
+        int font_size = (width + height) / (strlen(text) * 2);
+        int w = MeasureText(text, font_size);
+        DrawText(text, (width - w) / 2, 50, font_size, WHITE);
+
+        text = TextFormat("Score: %d", snapshot->score);
+        font_size = (width + height) / (strlen(text) * 3);
+        w = MeasureText(text, font_size);
+        DrawText(text, (width - w) / 2, height / 2, font_size, WHITE);
     }
+}
 
+void draw_game(Renderer *renderer, const Snapshot *snapshot, float alpha) {
     Drawing {
         ClearBackground(BACKGROUND_COLOR);
-        Mode3D(game->camera) {
+        Mode3D(renderer->camera) {
             // Main grid
-            for (int x = 0; x < GRID_SIZE; x++) {
-                for (int y = 0; y < GRID_SIZE; y++) {
-                    for (int z = 0; z < GRID_SIZE; z++) {
-                        Vector3 pos = {x, y, z};
-                        Vector3 draw_pos = Vector3SubtractValue(pos, GRID_SIZE / 2);
-                        //DrawCubeWires(draw_pos, 1, 1, 1, GRID_COLOR);
-
-                        if (vector3_near_eq(pos, game->fruit)) {
-                            DrawCube(draw_pos, 1, 1, 1, FRUIT_COLOR);
-                        } else if (snake_contains(&game->snake, pos)) {
-                            DrawCube(draw_pos, 1, 1, 1, SNAKE_COLOR);
-                        }
-                    }
+            Profile("draw segments") segment_renderer_draw(&renderer->segments, alpha, SNAKE_COLOR);
+            Profile("draw fruit") DrawCube(Vector3SubtractValue(snapshot->fruit, GRID_SIZE / 2), 1, 1, 1, FRUIT_COLOR);
+            render_stats_sample();
+
+            Profile("draw lattice") {
+                if (renderer->lattice != LATTICE_NONE) {
+                    Model *model = renderer_lattice_model(renderer, renderer->lattice);
+                    DrawModel(*model, Vector3Zero(), 1.0f, LATTICE_COLOR);
+                    render_stats_direct_draw(model->meshes[0].vertexCount, 2);
                 }
+                DrawCubeWires(Vector3Zero(), GRID_SIZE, GRID_SIZE, GRID_SIZE, GRID_COLOR);
             }
+            render_stats_sample();
 
             // """Shadows"""
-            for (int x = 0; x < GRID_SIZE; x++) {
-                for (int y = 0; y < GRID_SIZE; y++) {
-                    for (int z = 0; z < GRID_SIZE; z++) {
-                        Vector3 pos = {x, y, z};
-                        Vector3 draw_pos_bottom = { x - GRID_SIZE / 2, -GRID_SIZE / 2 - 3/2, z - GRID_SIZE / 2};
-                        Vector3 draw_pos_top = { x - GRID_SIZE / 2, GRID_SIZE / 2, z - GRID_SIZE / 2};
-
-                        if (snake_contains(&game->snake, pos)) {
-                            DrawCubeWires(draw_pos_bottom, 1, 0, 1, SNAKE_COLOR);
-                            DrawCubeWires(draw_pos_top, 1, 0, 1, SNAKE_COLOR);
-                        }
-                    }
-                }
+            // Drawn last: the blank texels still write depth and would hide anything behind them
+            Profile("draw shadows") {
+                draw_shadow_quad(renderer->shadow_texture, SHADOW_BOTTOM_Y, true);
+                draw_shadow_quad(renderer->shadow_texture, SHADOW_TOP_Y, false);
             }
-            for (int x = 0; x < GRID_SIZE; x++) {
-                for (int y = 0; y < GRID_SIZE; y++) {
-                    for (int z = 0; z < GRID_SIZE; z++) {
-                        Vector3 pos = {x, y, z};
-                        Vector3 draw_pos_bottom = { x - GRID_SIZE / 2, -GRID_SIZE / 2 - 3/2, z - GRID_SIZE / 2};
-                        Vector3 draw_pos_top = { x - GRID_SIZE / 2, GRID_SIZE / 2, z - GRID_SIZE / 2};
-
-                        if (vector3_near_eq(game->fruit, pos)) {
-                            DrawCubeWires(draw_pos_bottom, 1, 0, 1, FRUIT_COLOR);
-                            DrawCubeWires(draw_pos_top, 1, 0, 1, FRUIT_COLOR);
-                        }
-                    }
-                }
+        }
+
+        Profile("draw hud") {
+            const char *text = TextFormat("Score: %d", snapshot->score);
+            int font_size = 20;
+            int w = MeasureText(text, font_size);
+            DrawText(text, GetScreenWidth() / 2 - w / 2, 10, font_size, WHITE);
+
+            render_stats_sample();
+
+            int y = 10;
+            y = draw_time_stats_line("frame", &renderer->frame_stats, 10, y);
+            y = draw_time_stats_line("tick", &renderer->tick_stats, 10, y);
+            y = draw_latency_line(&renderer->latency, 10, y);
+            render_stats_sample();
+            draw_frame_time_graph(&renderer->frame_stats, 10, y + 2);
+            y += HUD_GRAPH_HEIGHT + 4;
+            render_stats_sample();
+
+            if (renderer->show_render_stats) {
+                const Render_Counters *rc = &render_stats.last;
+                DrawText(TextFormat("batch flushes %zu  draw calls %zu", rc->flushes, rc->draw_calls),
+                         10, y, HUD_FONT_SIZE, WHITE);
+                y += HUD_FONT_SIZE + 2;
+                DrawText(TextFormat("vertices %zu  state changes %zu", rc->vertices, rc->state_changes),
+                         10, y, HUD_FONT_SIZE, WHITE);
+                render_stats_sample();
             }
-            DrawCubeWires(Vector3Zero(), GRID_SIZE, GRID_SIZE, GRID_SIZE, GRID_COLOR);
         }
+    }
+}
 
-        const char *text = TextFormat("Score: %d", game->score);
-        int font_size = 20;
-        int w = MeasureText(text, font_size);
-        DrawText(text, GetScreenWidth() / 2 - w / 2, 10, font_size, WHITE);
+void render_update(Renderer *renderer) {
+#ifndef SIM_THREADED
+    sim_advance(&game, clock_now());
+#endif // SIM_THREADED
+    profile_collect();
+
+    if (IsKeyPressed(KEY_F)) {
+        ToggleBorderlessWindowed();
+        renderer->dirty = true;
+    }
+
+    latency_stats_collect(&renderer->latency, &latency_queue);
+    const Snapshot *snapshot = triple_buffer_read(&snapshots);
+    if (snapshot->tick != renderer->drawn_tick) renderer->dirty = true;
+    if (snapshot->tick != renderer->stats_tick) {
+        renderer->stats_tick = snapshot->tick;
+        time_stats_add(&renderer->tick_stats, snapshot->tick_duration_ns);
+    }
+
+    if (snapshot->game_over) {
+        if (!renderer_should_draw(renderer)) return;
+        renderer->drawn_tick = snapshot->tick;
+        draw_game_over(snapshot);
+        latency_stats_presented(&renderer->latency, snapshot->tick, clock_now_ns());
+        return;
+    }
+
+    Profile("input") {
+        if (IsKeyPressed(KEY_G)) {
+            renderer->lattice = (renderer->lattice + 1) % COUNT_LATTICES;
+            renderer->dirty = true;
+        }
+        if (IsKeyPressed(KEY_R)) {
+            renderer->show_render_stats = !renderer->show_render_stats;
+            renderer->dirty = true;
+        }
+
+        // TODO: better camera controls that don't conflict with snake WASD
+        if (IsKeyDown(KEY_SPACE)) {
+            UpdateCamera(&renderer->camera, CAMERA_ORBITAL);
+            renderer->dirty = true;
+        }
+
+        Vector3 new_dir = get_keyboard_dir();
+        if (!vector3_near_eq(new_dir, Vector3Zero())) {
+            input_queue_push(&input_queue, (Input_Event) { .dir = new_dir, .pressed_ns = clock_now_ns() });
+        }
+    }
 
-        DrawFPS(10, 10);
+    // Once the segments have arrived, nothing moves until the next tick
+    float alpha = renderer_tick_alpha(renderer, snapshot);
+    if (alpha - renderer->drawn_alpha >= SMOOTH_ALPHA_STEP || (alpha == 1.0f && renderer->drawn_alpha < 1.0f)) {
+        renderer->dirty = true;
     }
+
+    if (!renderer_should_draw(renderer)) return;
+    renderer->drawn_tick = snapshot->tick;
+    renderer->drawn_alpha = alpha;
+    uint64_t frame_start = clock_now_ns();
+    Profile("frame") {
+        Profile("upload") {
+            renderer_sync_shadow(renderer, snapshot);
+            segment_renderer_upload(&renderer->segments, snapshot);
+        }
+        draw_game(renderer, snapshot, alpha);
+    }
+    uint64_t presented = clock_now_ns();
+    time_stats_add(&renderer->frame_stats, presented - frame_start);
+    latency_stats_presented(&renderer->latency, snapshot->tick, presented);
 }
 
-Game game;
+Renderer renderer;
 
-int main(void) {
-    game_init(&game);
+// --mem-report: what the big structures take, next to what the OS says the process takes
+#define MEM_REPORT_GPU_BATCH_INDEX_SIZE sizeof(unsigned int) // Indices of the batch are 32-bit on desktop GL
+
+// Resident set of the process and its high water mark, from /proc on Linux
+bool process_memory(size_t *resident, size_t *peak) {
+#ifdef __linux__
+    FILE *f = fopen("/proc/self/status", "r");
+    if (f == NULL) return false;
+    char line[256];
+    size_t found = 0;
+    while (fgets(line, sizeof(line), f) != NULL) {
+        size_t kib;
+        if (sscanf(line, "VmRSS: %zu kB", &kib) == 1) *resident = kib*1024, found++;
+        if (sscanf(line, "VmHWM: %zu kB", &kib) == 1) *peak = kib*1024, found++;
+    }
+    fclose(f);
+    return found == 2;
+#else
+    UNUSED(resident);
+    UNUSED(peak);
+    return false;
+#endif // __linux__
+}
 
+size_t mesh_bytes(Mesh mesh) {
+    size_t bytes = 0;
+    if (mesh.vertices != NULL) bytes += mesh.vertexCount*3*sizeof(float);
+    if (mesh.texcoords != NULL) bytes += mesh.vertexCount*2*sizeof(float);
+    if (mesh.normals != NULL) bytes += mesh.vertexCount*3*sizeof(float);
+    if (mesh.colors != NULL) bytes += mesh.vertexCount*4;
+    if (mesh.indices != NULL) bytes += mesh.triangleCount*3*sizeof(unsigned short);
+    return bytes;
+}
+
+// Vertex data of a batch: a quad per element with positions, texcoords, colors and 6 indices
+size_t render_batch_bytes(const rlRenderBatch *batch) {
+    size_t per_element = 4*(3*sizeof(float) + 2*sizeof(float) + 4) + 6*MEM_REPORT_GPU_BATCH_INDEX_SIZE;
+    size_t bytes = 0;
+    for (int i = 0; i < batch->bufferCount; i++) bytes += batch->vertexBuffer[i].elementCount*per_element;
+    return bytes;
+}
+
+void mem_report_line(FILE *stream, const char *name, size_t bytes) {
+    fprintf(stream, "    %-26s %10.1f KiB\n", name, bytes/1024.0);
+}
+
+void mem_report(FILE *stream, const char *when) {
+    size_t resident = 0, peak = 0;
+    if (process_memory(&resident, &peak)) {
+        fprintf(stream, "Memory %s: %.1f MiB resident, %.1f MiB at peak\n", when, resident/1048576.0, peak/1048576.0);
+    } else {
+        fprintf(stream, "Memory %s (resident size unavailable):\n", when);
+    }
+
+    // Arrays sized by GRID_SIZE are what grows with the grid
+    fprintf(stream, "  CPU:\n");
+    mem_report_line(stream, "snake storage", sizeof(game.snake));
+    mem_report_line(stream, "shadow", sizeof(game.shadow));
+    mem_report_line(stream, "dir queue", game.dir_queue.capacity*sizeof(*game.dir_queue.items)
+                                         + steering.capacity*sizeof(*steering.items));
+    mem_report_line(stream, "rest of the game state", sizeof(game) - sizeof(game.snake) - sizeof(game.shadow));
+    mem_report_line(stream, "snapshots", sizeof(snapshots));
+    mem_report_line(stream, "input and latency queues", sizeof(input_queue) + sizeof(latency_queue));
+    mem_report_line(stream, "bot", sizeof(bot));
+    mem_report_line(stream, "renderer state", sizeof(renderer));
+    // Only the pages the arena actually touched are resident
+    fprintf(stream, "    %-26s %10.1f KiB of %.0f KiB\n", "nob temp arena", nob_temp_save()/1024.0, NOB_TEMP_CAPACITY/1024.0);
+    // raylib keeps a default batch of the same size next to ours
+    size_t batch = render_batch_bytes(&render_stats.batch);
+    size_t draw_calls = render_stats.batch.bufferCount > 0 ? RL_DEFAULT_BATCH_DRAWCALLS*sizeof(rlDrawCall) : 0;
+    mem_report_line(stream, "render batches", 2*(batch + draw_calls));
+    size_t lattice = 0;
+    for (Lattice l = LATTICE_NONE + 1; l < COUNT_LATTICES; l++) {
+        for (int i = 0; i < renderer.lattice_models[l].meshCount; i++) lattice += mesh_bytes(renderer.lattice_models[l].meshes[i]);
+    }
+    mem_report_line(stream, "lattice meshes", lattice);
+#ifdef PROFILE_ZONES
+    mem_report_line(stream, "profiling zones", profile_memory());
+#endif // PROFILE_ZONES
+
+    // GL has no portable way to ask how much memory a buffer takes, so these are the sizes we asked for
+    fprintf(stream, "  GPU:\n");
+    mem_report_line(stream, "render batches", 2*batch);
+    mem_report_line(stream, "segment instances", sizeof(cube_vertices) + sizeof(((Snapshot*)0)->segments));
+    mem_report_line(stream, "shadow texture", renderer.shadow_texture.width*renderer.shadow_texture.height*4);
+    mem_report_line(stream, "lattice meshes", lattice);
+}
+
+void usage(FILE *stream, const char *program_name) {
+    fprintf(stream, "Usage: %s [OPTIONS]\n", program_name);
+    fprintf(stream, "    OPTIONS:\n");
+    fprintf(stream, "      -h, --help - Print this help message\n");
+    fprintf(stream, "      --continuous - Draw every frame instead of only when something changed\n");
+    fprintf(stream, "      --no-smooth - Move the snake a whole cell per tick instead of gliding from cell to cell\n");
+    fprintf(stream, "      --trace <out.json> - Write profiling zones, ticks and frames as Chrome trace events\n");
+    fprintf(stream, "      --bot <bfs|astar> - Let the bot steer towards the fruit with the given planner. The keys still work on top of it\n");
+    fprintf(stream, "      --mem-report - Print the memory taken by each subsystem at startup and at exit, along with the peak resident size\n");
+}
+
+int main(int argc, char **argv) {
+    startup_begin(&startup);
+    renderer.smooth = true;
+    bool show_mem_report = false;
+
+    const char *program_name = shift(argv, argc);
+    while (argc > 0) {
+        const char *arg = shift(argv, argc);
+        if (strcmp(arg, "-h") == 0 || strcmp(arg, "--help") == 0) {
+            usage(stdout, program_name);
+            return 0;
+        } else if (strcmp(arg, "--continuous") == 0) {
+            renderer.continuous = true;
+        } else if (strcmp(arg, "--no-smooth") == 0) {
+            renderer.smooth = false;
+        } else if (strcmp(arg, "--bot") == 0) {
+            if (argc == 0) {
+                usage(stderr, program_name);
+                nob_log(ERROR, "--bot flag requires an argument");
+                return 1;
+            }
+            const char *name = shift(argv, argc);
+            if (!bot_planner_by_name(name, &bot.planner)) {
+                usage(stderr, program_name);
+                nob_log(ERROR, "unknown planner %s", name);
+                return 1;
+            }
+            bot_enabled = true;
+        } else if (strcmp(arg, "--mem-report") == 0) {
+            show_mem_report = true;
+        } else if (strcmp(arg, "--trace") == 0) {
+            if (argc == 0) {
+                usage(stderr, program_name);
+                nob_log(ERROR, "--trace flag requires an argument");
+                return 1;
+            }
+            const char *trace_path = shift(argv, argc);
+#ifdef PROFILE_ZONES
+            if (!profile_trace_open(trace_path)) return 1;
+#else
+            UNUSED(trace_path);
+            nob_log(ERROR, "--trace needs profiling zones, rebuild with `./nob --zones`");
+            return 1;
+#endif // PROFILE_ZONES
+        } else {
+            usage(stderr, program_name);
+            nob_log(ERROR, "unknown flag %s", arg);
+            return 1;
+        }
+    }
+
+    if (!libsnake_reload()) return 1;
+    triple_buffer_init(&snapshots);
+    startup_stage_end(&startup, STARTUP_SETUP);
+    game_init(&game, time(0));
+    startup_stage_end(&startup, STARTUP_GAME_INIT);
+
+    profile_set_thread_name("render");
     InitWindow(640, 480, "3D Snake Game");
     DisableCursor();
+    startup_stage_end(&startup, STARTUP_INIT_WINDOW);
+    renderer_init(&renderer);
+    startup_stage_end(&startup, STARTUP_RENDERER);
+
+    double now = clock_now();
+    game.next_tick = now + TICK_INTERVAL;
+    sim_publish(&game, now);
+    if (show_mem_report) mem_report(stdout, "at startup");
+
+    alloc_track_begin(&frame_allocs);
+    perf_track_open(&frame_perf);
+    perf_track_begin(&frame_perf);
+#ifdef SIM_THREADED
+    pthread_t sim;
+    atomic_store(&sim_running, true);
+    if (pthread_create(&sim, NULL, sim_thread, &game) != 0) {
+        nob_log(ERROR, "could not start the simulation thread");
+        return 1;
+    }
+#endif // SIM_THREADED
 
 #ifdef PLATFORM_WEB
-    emscripten_set_main_loop_arg((em_arg_callback_func)game_update, &game, 0, true);
+    emscripten_set_main_loop_arg((em_arg_callback_func)render_update, &renderer, 0, true);
 #else
-    while (!WindowShouldClose()) game_update(&game);
+    while (!WindowShouldClose()) {
+        if (!libsnake_update()) break;
+        render_update(&renderer);
+    }
+#ifdef SIM_THREADED
+    atomic_store(&sim_running, false);
+    pthread_join(sim, NULL);
+#endif // SIM_THREADED
+    // Nothing is ever given back before exit, so the structures are at their largest here
+    if (show_mem_report) mem_report(stdout, "at exit");
+    renderer_deinit(&renderer);
     CloseWindow();
+    perf_track_close(&tick_perf);
+    perf_track_close(&frame_perf);
 #endif // PLATFORM_WEB
 
     printf("Final Score: %d\n", game.score);
+    startup_report(stdout, &startup);
+    latency_report(stdout, &renderer.latency);
+    profile_collect();
+    profile_report(stdout);
+    alloc_report(stdout, &tick_allocs);
+    alloc_report(stdout, &frame_allocs);
+    perf_report(stdout, &tick_perf);
+    perf_report(stdout, &frame_perf);
+#ifdef PROFILE_ZONES
+    profile_trace_close();
+#endif // PROFILE_ZONES
     return 0;
 }
@@ -0,0 +1,4 @@
+// nob.h is implemented in a translation unit of its own, so it is only compiled once instead of
+// every time one of the sources that use it changes
+#define NOB_IMPLEMENTATION
+#include "nob.h"
@@ -0,0 +1,126 @@
+#define NOB_STRIP_PREFIX
+#include "nob.h"
+
+#include "perf.h"
+
+#ifdef PERF_COUNTERS
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+const char *perf_event_name(Perf_Event event) {
+    static_assert(COUNT_PERF_EVENTS == 4, "Please update after adding a new event");
+    switch (event) {
+        case PERF_CYCLES: return "cycles";
+        case PERF_INSTRUCTIONS: return "instructions";
+        case PERF_CACHE_MISSES: return "cache misses";
+        case PERF_BRANCH_MISSES: return "branch misses";
+        default: return "unknown";
+    }
+}
+
+uint64_t perf_event_config(Perf_Event event) {
+    static_assert(COUNT_PERF_EVENTS == 4, "Please update after adding a new event");
+    switch (event) {
+        case PERF_CYCLES: return PERF_COUNT_HW_CPU_CYCLES;
+        case PERF_INSTRUCTIONS: return PERF_COUNT_HW_INSTRUCTIONS;
+        case PERF_CACHE_MISSES: return PERF_COUNT_HW_CACHE_MISSES;
+        case PERF_BRANCH_MISSES: return PERF_COUNT_HW_BRANCH_MISSES;
+        default: return 0;
+    }
+}
+
+int perf_event_open(Perf_Event event, int group) {
+    struct perf_event_attr attr = {0};
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = perf_event_config(event);
+    attr.disabled = group == -1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+    return syscall(SYS_perf_event_open, &attr, 0, -1, group, 0);
+}
+
+void perf_track_open(Perf_Track *track) {
+    int group = -1;
+    int errors[COUNT_PERF_EVENTS] = {0};
+    for (Perf_Event event = 0; event < COUNT_PERF_EVENTS; event++) {
+        int fd = perf_event_open(event, group);
+        if (fd < 0) {
+            errors[event] = errno;
+            continue;
+        }
+        if (group == -1) group = fd;
+        track->fds[event] = fd;
+        track->opened[event] = true;
+    }
+    if (group == -1) {
+        nob_log(WARNING, "no performance counters for the %s: %s", track->name, strerror(errors[0]));
+        return;
+    }
+    // Missing events are left out of the group, the rest is still worth having
+    for (Perf_Event event = 0; event < COUNT_PERF_EVENTS; event++) {
+        if (!track->opened[event]) nob_log(WARNING, "no %s counter for the %s: %s", perf_event_name(event), track->name, strerror(errors[event]));
+    }
+    track->group = group;
+    track->available = true;
+    ioctl(group, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(group, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+void perf_track_close(Perf_Track *track) {
+    if (!track->available) return;
+    for (Perf_Event event = 0; event < COUNT_PERF_EVENTS; event++) {
+        if (track->opened[event]) close(track->fds[event]);
+    }
+    track->available = false;
+}
+
+// Reads the current value of every opened event into `values`
+bool perf_track_read(const Perf_Track *track, uint64_t values[COUNT_PERF_EVENTS]) {
+    // PERF_FORMAT_GROUP: the amount of events followed by their values in the order they were opened
+    uint64_t buffer[1 + COUNT_PERF_EVENTS];
+    if (read(track->group, buffer, sizeof(buffer)) < (ssize_t)sizeof(uint64_t)) return false;
+    size_t i = 1;
+    for (Perf_Event event = 0; event < COUNT_PERF_EVENTS; event++) {
+        values[event] = track->opened[event] && i <= buffer[0] ? buffer[i++] : 0;
+    }
+    return true;
+}
+
+void perf_track_begin(Perf_Track *track) {
+    if (!track->available) return;
+    if (!perf_track_read(track, track->begin)) perf_track_close(track);
+}
+
+void perf_track_end(Perf_Track *track) {
+    if (!track->available) return;
+    uint64_t end[COUNT_PERF_EVENTS];
+    if (!perf_track_read(track, end)) {
+        perf_track_close(track);
+        return;
+    }
+    for (Perf_Event event = 0; event < COUNT_PERF_EVENTS; event++) {
+        track->last[event] = end[event] - track->begin[event];
+        track->total[event] += track->last[event];
+    }
+    track->samples++;
+}
+
+void perf_report(FILE *stream, const Perf_Track *track) {
+    if (track->samples == 0) {
+        fprintf(stream, "Performance counters per %s: unavailable\n", track->name);
+        return;
+    }
+    fprintf(stream, "Performance counters per %s (average of %llu):\n", track->name, (unsigned long long)track->samples);
+    for (Perf_Event event = 0; event < COUNT_PERF_EVENTS; event++) {
+        if (!track->opened[event]) continue;
+        fprintf(stream, "  %-14s %14.0f\n", perf_event_name(event), (double)track->total[event]/track->samples);
+    }
+    if (track->opened[PERF_CYCLES] && track->opened[PERF_INSTRUCTIONS] && track->total[PERF_CYCLES] > 0) {
+        fprintf(stream, "  %-14s %14.2f\n", "IPC", (double)track->total[PERF_INSTRUCTIONS]/track->total[PERF_CYCLES]);
+    }
+}
+#endif // PERF_COUNTERS
@@ -0,0 +1,46 @@
+#ifndef PERF_H_
+#define PERF_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// Hardware performance counters of the calling thread, read through perf_event_open(2). Built with
+// -DPERF_COUNTERS only (`./nob --perf`, Linux only). When the kernel refuses to hand out counters
+// (perf_event_paranoid, virtual machines without a PMU) a track simply stays unavailable.
+typedef enum {
+    PERF_CYCLES,
+    PERF_INSTRUCTIONS,
+    PERF_CACHE_MISSES,
+    PERF_BRANCH_MISSES,
+    COUNT_PERF_EVENTS,
+} Perf_Event;
+
+typedef struct {
+    const char *name;
+    bool available; // Whether any of the events could be opened at all
+    bool opened[COUNT_PERF_EVENTS];
+    int fds[COUNT_PERF_EVENTS]; // The first opened event leads the group
+    int group;
+    uint64_t begin[COUNT_PERF_EVENTS];
+    uint64_t total[COUNT_PERF_EVENTS];
+    uint64_t last[COUNT_PERF_EVENTS]; // Counts of the last finished sample
+    uint64_t samples;
+} Perf_Track;
+
+#ifdef PERF_COUNTERS
+// Must be called from the thread the track is going to measure
+void perf_track_open(Perf_Track *track);
+void perf_track_close(Perf_Track *track);
+void perf_track_begin(Perf_Track *track);
+void perf_track_end(Perf_Track *track);
+void perf_report(FILE *stream, const Perf_Track *track);
+#else
+#define perf_track_open(track)
+#define perf_track_close(track)
+#define perf_track_begin(track)
+#define perf_track_end(track)
+#define perf_report(stream, track)
+#endif // PERF_COUNTERS
+
+#endif // PERF_H_
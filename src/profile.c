@@ -0,0 +1,218 @@
+#define NOB_STRIP_PREFIX
+#include "nob.h"
+
+#include <stdatomic.h>
+
+#include "profile.h"
+
+#ifdef PROFILE_ZONES
+#define PROFILE_MAX_THREADS 8
+#define PROFILE_BUFFER_CAPACITY 4096
+#define PROFILE_MAX_DEPTH 16
+#define PROFILE_MAX_STATS 64
+
+typedef struct {
+    const char *name;
+    uint64_t begin_ns;
+    uint64_t end_ns;
+    bool instant; // A single point in time rather than a span, see profile_mark()
+} Profile_Zone;
+
+// Finished zones of a single thread. The thread is the only producer and profile_collect()
+// the only consumer, so this is a lock-free SPSC ring. Zones are dropped when it is full.
+typedef struct {
+    const char *thread_name;
+    Profile_Zone zones[PROFILE_BUFFER_CAPACITY];
+    _Atomic size_t head;
+    _Atomic size_t tail;
+    atomic_size_t dropped;
+} Profile_Buffer;
+
+Profile_Buffer profile_buffers[PROFILE_MAX_THREADS];
+atomic_size_t profile_buffer_count;
+
+_Thread_local Profile_Buffer *profile_buffer;
+_Thread_local Profile_Zone profile_stack[PROFILE_MAX_DEPTH];
+_Thread_local size_t profile_depth;
+
+Profile_Buffer *profile_this_thread(void) {
+    if (profile_buffer == NULL) {
+        size_t i = atomic_fetch_add(&profile_buffer_count, 1);
+        assert(i < PROFILE_MAX_THREADS && "Too many profiled threads");
+        profile_buffer = &profile_buffers[i];
+    }
+    return profile_buffer;
+}
+
+void profile_set_thread_name(const char *name) {
+    profile_this_thread()->thread_name = name;
+}
+
+void profile_begin(const char *name) {
+    if (profile_depth < PROFILE_MAX_DEPTH) {
+        profile_stack[profile_depth] = (Profile_Zone) { .name = name, .begin_ns = clock_now_ns() };
+    }
+    profile_depth++;
+}
+
+void profile_push(Profile_Zone zone) {
+    Profile_Buffer *pb = profile_this_thread();
+    size_t tail = atomic_load_explicit(&pb->tail, memory_order_relaxed);
+    size_t head = atomic_load_explicit(&pb->head, memory_order_acquire);
+    if (tail - head == PROFILE_BUFFER_CAPACITY) {
+        atomic_fetch_add_explicit(&pb->dropped, 1, memory_order_relaxed);
+        return;
+    }
+    pb->zones[tail % PROFILE_BUFFER_CAPACITY] = zone;
+    atomic_store_explicit(&pb->tail, tail + 1, memory_order_release);
+}
+
+void profile_end(void) {
+    assert(profile_depth > 0 && "Profile zone underflow");
+    profile_depth--;
+    if (profile_depth >= PROFILE_MAX_DEPTH) return;
+
+    Profile_Zone zone = profile_stack[profile_depth];
+    zone.end_ns = clock_now_ns();
+    profile_push(zone);
+}
+
+// Records a boundary such as the start of a tick or of a frame
+void profile_mark(const char *name) {
+    uint64_t now = clock_now_ns();
+    profile_push((Profile_Zone) { .name = name, .begin_ns = now, .end_ns = now, .instant = true });
+}
+
+// Chrome trace-event export (--trace). The events are streamed to the file in chunks as they
+// are collected, so memory stays bounded however long the session is. The resulting JSON can be
+// opened in Perfetto or chrome://tracing.
+#define PROFILE_TRACE_CHUNK_SIZE (64*1024)
+
+FILE *profile_trace;
+String_Builder profile_trace_chunk;
+uint64_t profile_trace_epoch_ns;
+bool profile_trace_empty;
+
+bool profile_trace_open(const char *path) {
+    profile_trace = fopen(path, "wb");
+    if (profile_trace == NULL) {
+        nob_log(ERROR, "could not open trace file %s: %s", path, strerror(errno));
+        return false;
+    }
+    profile_trace_epoch_ns = clock_now_ns();
+    profile_trace_empty = true;
+    sb_append_cstr(&profile_trace_chunk, "[\n");
+    return true;
+}
+
+void profile_trace_flush(void) {
+    fwrite(profile_trace_chunk.items, 1, profile_trace_chunk.count, profile_trace);
+    profile_trace_chunk.count = 0;
+}
+
+void profile_trace_append_separator(void) {
+    if (!profile_trace_empty) sb_append_cstr(&profile_trace_chunk, ",\n");
+    profile_trace_empty = false;
+}
+
+void profile_trace_zone(size_t tid, const Profile_Zone *zone) {
+    double ts_us = (double)(int64_t)(zone->begin_ns - profile_trace_epoch_ns)*1e-3;
+    profile_trace_append_separator();
+    if (zone->instant) {
+        sb_appendf(&profile_trace_chunk, "{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%zu,\"ts\":%.3f}",
+                   zone->name, tid, ts_us);
+    } else {
+        sb_appendf(&profile_trace_chunk, "{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%zu,\"ts\":%.3f,\"dur\":%.3f}",
+                   zone->name, tid, ts_us, (zone->end_ns - zone->begin_ns)*1e-3);
+    }
+    if (profile_trace_chunk.count >= PROFILE_TRACE_CHUNK_SIZE) profile_trace_flush();
+}
+
+// Value of a counter track at the current time. Only call this from the thread running profile_collect().
+void profile_trace_counter(const char *name, uint64_t value) {
+    if (profile_trace == NULL) return;
+    double ts_us = (double)(int64_t)(clock_now_ns() - profile_trace_epoch_ns)*1e-3;
+    profile_trace_append_separator();
+    sb_appendf(&profile_trace_chunk, "{\"name\":\"%s\",\"ph\":\"C\",\"pid\":1,\"ts\":%.3f,\"args\":{\"value\":%llu}}",
+               name, ts_us, (unsigned long long)value);
+    if (profile_trace_chunk.count >= PROFILE_TRACE_CHUNK_SIZE) profile_trace_flush();
+}
+
+void profile_trace_close(void) {
+    if (profile_trace == NULL) return;
+    size_t count = atomic_load(&profile_buffer_count);
+    for (size_t t = 0; t < count; t++) {
+        if (profile_buffers[t].thread_name == NULL) continue;
+        profile_trace_append_separator();
+        sb_appendf(&profile_trace_chunk, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%zu,\"args\":{\"name\":\"%s\"}}",
+                   t + 1, profile_buffers[t].thread_name);
+    }
+    sb_append_cstr(&profile_trace_chunk, "\n]\n");
+    profile_trace_flush();
+    fclose(profile_trace);
+    profile_trace = NULL;
+    sb_free(profile_trace_chunk);
+}
+
+typedef struct {
+    const char *name;
+    size_t count;
+    uint64_t total_ns;
+    uint64_t max_ns;
+} Profile_Stat;
+
+Profile_Stat profile_stats[PROFILE_MAX_STATS];
+size_t profile_stat_count;
+
+Profile_Stat *profile_stat(const char *name) {
+    for (size_t i = 0; i < profile_stat_count; i++) {
+        if (profile_stats[i].name == name || strcmp(profile_stats[i].name, name) == 0) return &profile_stats[i];
+    }
+    if (profile_stat_count >= PROFILE_MAX_STATS) return NULL;
+    profile_stats[profile_stat_count].name = name;
+    return &profile_stats[profile_stat_count++];
+}
+
+// Drains the buffers of all the threads. Must always be called from the same thread.
+void profile_collect(void) {
+    size_t count = atomic_load(&profile_buffer_count);
+    for (size_t t = 0; t < count; t++) {
+        Profile_Buffer *pb = &profile_buffers[t];
+        size_t head = atomic_load_explicit(&pb->head, memory_order_relaxed);
+        size_t tail = atomic_load_explicit(&pb->tail, memory_order_acquire);
+        for (; head != tail; head++) {
+            const Profile_Zone *zone = &pb->zones[head % PROFILE_BUFFER_CAPACITY];
+            if (profile_trace != NULL) profile_trace_zone(t + 1, zone);
+            if (zone->instant) continue;
+            Profile_Stat *stat = profile_stat(zone->name);
+            if (stat == NULL) continue;
+            uint64_t ns = zone->end_ns - zone->begin_ns;
+            stat->count++;
+            stat->total_ns += ns;
+            if (ns > stat->max_ns) stat->max_ns = ns;
+        }
+        atomic_store_explicit(&pb->head, head, memory_order_release);
+    }
+}
+
+size_t profile_memory(void) {
+    return sizeof(profile_buffers) + sizeof(profile_stats) + profile_trace_chunk.capacity;
+}
+
+void profile_report(FILE *stream) {
+    fprintf(stream, "%-20s %10s %12s %12s %12s\n", "zone", "count", "total ms", "avg ms", "max ms");
+    for (size_t i = 0; i < profile_stat_count; i++) {
+        const Profile_Stat *stat = &profile_stats[i];
+        fprintf(stream, "%-20s %10zu %12.3f %12.4f %12.4f\n", stat->name, stat->count,
+                stat->total_ns*1e-6, stat->total_ns*1e-6/stat->count, stat->max_ns*1e-6);
+    }
+    size_t count = atomic_load(&profile_buffer_count);
+    for (size_t t = 0; t < count; t++) {
+        size_t dropped = atomic_load(&profile_buffers[t].dropped);
+        if (dropped > 0) {
+            const char *thread_name = profile_buffers[t].thread_name ? profile_buffers[t].thread_name : "?";
+            fprintf(stream, "%zu zones dropped on thread %s\n", dropped, thread_name);
+        }
+    }
+}
+#endif // PROFILE_ZONES
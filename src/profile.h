@@ -0,0 +1,39 @@
+#ifndef PROFILE_H_
+#define PROFILE_H_
+
+#include <stdio.h>
+
+#include "common.h"
+
+// Profiling zones. `Profile("name") { ... }` records when the block started and ended on the
+// calling thread. Built with -DPROFILE_ZONES only, otherwise the macro leaves a plain block behind.
+// NOTE: like the rest of the BEGIN_END family, returning out of the block skips the end.
+#ifdef PROFILE_ZONES
+void profile_set_thread_name(const char *name);
+void profile_begin(const char *name);
+void profile_end(void);
+// Records a boundary such as the start of a tick or of a frame
+void profile_mark(const char *name);
+// Drains the buffers of all the threads. Must always be called from the same thread.
+void profile_collect(void);
+void profile_report(FILE *stream);
+// Bytes taken by the zone buffers, the statistics and the trace chunk
+size_t profile_memory(void);
+
+// Chrome trace-event export (--trace)
+bool profile_trace_open(const char *path);
+// Value of a counter track at the current time. Only call this from the thread running profile_collect().
+void profile_trace_counter(const char *name, uint64_t value);
+void profile_trace_close(void);
+
+#define Profile(name) BEGIN_END(profile_begin(name), profile_end())
+#else
+#define Profile(name)
+#define profile_set_thread_name(name)
+#define profile_mark(name)
+#define profile_trace_counter(name, value)
+#define profile_collect()
+#define profile_report(stream)
+#endif // PROFILE_ZONES
+
+#endif // PROFILE_H_
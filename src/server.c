@@ -0,0 +1,243 @@
+// Headless simulation for machines without a display, built with `./nob -t server`. Turns come in
+// on stdin and the state of the game goes out on stdout after every tick, one line each, so any
+// transport that carries lines (a pipe, socat, ssh) can connect a client to it.
+#define NOB_STRIP_PREFIX
+#include "nob.h"
+
+#include <inttypes.h>
+#include <poll.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "raylib.h"
+
+#include "alloc.h"
+#include "bot.h"
+#include "common.h"
+#include "perf.h"
+#include "profile.h"
+#include "snake.h"
+
+typedef struct {
+    const char *name;
+    Vector3 dir;
+} Server_Turn;
+
+// Same keys as the game
+Server_Turn server_turns[] = {
+    { "w",    { 0, 0, -1 } },
+    { "a",    { -1, 0, 0 } },
+    { "s",    { 0, 0, 1 } },
+    { "d",    { 1, 0, 0 } },
+    { "up",   { 0, 1, 0 } },
+    { "down", { 0, -1, 0 } },
+};
+
+typedef struct {
+    Game game;
+    String_Builder input; // Bytes read from stdin that do not make up a whole line yet
+    bool input_open;
+    bool quit;
+    bool bot; // Let the bot steer, on top of whatever commands come in
+
+    uint64_t ticks;
+    uint64_t tick_total_ns;
+    uint64_t tick_max_ns;
+    uint64_t plan_total_ns;
+    uint64_t plan_max_ns;
+} Server;
+
+Server server;
+Bot server_bot;
+Alloc_Track tick_allocs = { .name = "tick" };
+Perf_Track tick_perf = { .name = "tick" };
+
+volatile sig_atomic_t server_interrupted = 0;
+
+void server_interrupt(int sig) {
+    UNUSED(sig);
+    server_interrupted = 1;
+}
+
+void server_command(Server *server, String_View command) {
+    if (command.count == 0) return;
+    if (sv_eq(command, sv_from_cstr("quit"))) {
+        server->quit = true;
+        return;
+    }
+    for (size_t i = 0; i < ARRAY_LEN(server_turns); i++) {
+        if (sv_eq(command, sv_from_cstr(server_turns[i].name))) {
+            game_steer(&server->game, server_turns[i].dir);
+            return;
+        }
+    }
+    nob_log(WARNING, "unknown command "SV_Fmt, SV_Arg(command));
+}
+
+// Applies the commands that arrive within `timeout` seconds
+void server_poll_input(Server *server, double timeout) {
+    if (!server->input_open) {
+        sleep_seconds(timeout);
+        return;
+    }
+
+    struct pollfd pfd = { .fd = STDIN_FILENO, .events = POLLIN };
+    int timeout_ms = timeout > 0 ? (int)(timeout*1000) + 1 : 0;
+    // Interrupted by a signal or timed out, either way there is nothing to read
+    if (poll(&pfd, 1, timeout_ms) <= 0) return;
+
+    char buffer[4096];
+    ssize_t n = read(STDIN_FILENO, buffer, sizeof(buffer));
+    if (n <= 0) {
+        // The client went away, the snake keeps going where it was heading
+        server->input_open = false;
+        return;
+    }
+    sb_append_buf(&server->input, buffer, n);
+
+    String_View rest = sb_to_sv(server->input);
+    while (memchr(rest.data, '\n', rest.count) != NULL) {
+        server_command(server, sv_trim(sv_chop_by_delim(&rest, '\n')));
+    }
+    memmove(server->input.items, rest.data, rest.count);
+    server->input.count = rest.count;
+}
+
+void server_tick(Server *server) {
+    Game *game = &server->game;
+    if (server->bot) {
+        uint64_t plan_start = clock_now_ns();
+        Profile("bot") bot_steer(&server_bot, game);
+        uint64_t plan_ns = clock_now_ns() - plan_start;
+        server->plan_total_ns += plan_ns;
+        if (plan_ns > server->plan_max_ns) server->plan_max_ns = plan_ns;
+    }
+    profile_mark("tick boundary");
+    alloc_track_begin(&tick_allocs);
+    perf_track_begin(&tick_perf);
+    uint64_t tick_start = clock_now_ns();
+    Profile("tick") game_tick(game);
+    uint64_t tick_ns = clock_now_ns() - tick_start;
+    perf_track_end(&tick_perf);
+    alloc_track_end(&tick_allocs);
+
+    server->ticks++;
+    server->tick_total_ns += tick_ns;
+    if (tick_ns > server->tick_max_ns) server->tick_max_ns = tick_ns;
+
+    if (game->game_over) {
+        printf("game over score %d\n", game->score);
+        return;
+    }
+    Vector3 head = snake_head(&game->snake);
+    printf("tick %"PRIu64" score %d head %d %d %d fruit %d %d %d\n", game->tick, game->score,
+           (int)head.x, (int)head.y, (int)head.z, (int)game->fruit.x, (int)game->fruit.y, (int)game->fruit.z);
+}
+
+void usage(FILE *stream, const char *program_name) {
+    fprintf(stream, "Usage: %s [OPTIONS]\n", program_name);
+    fprintf(stream, "    Reads one command per line from stdin: w, a, s, d, up, down to turn, quit to stop.\n");
+    fprintf(stream, "    Writes `tick <n> score <n> head <x> <y> <z> fruit <x> <y> <z>` to stdout after every tick,\n");
+    fprintf(stream, "    and `game over score <n>` once the snake bites itself.\n");
+    fprintf(stream, "    OPTIONS:\n");
+    fprintf(stream, "      -h, --help - Print this help message\n");
+    fprintf(stream, "      --seed <n> - Seed of the fruit, the current time by default\n");
+    fprintf(stream, "      --ticks <n> - Stop after this many ticks\n");
+    fprintf(stream, "      --fast - Run the ticks back to back instead of one every %gs\n", TICK_INTERVAL);
+    fprintf(stream, "      --bot <bfs|astar> - Let the bot steer towards the fruit with the given planner, commands other than quit still apply on top\n");
+}
+
+int main(int argc, char **argv) {
+    const char *program_name = shift(argv, argc);
+
+    uint64_t seed = time(0);
+    uint64_t max_ticks = 0;
+    bool fast = false;
+    while (argc > 0) {
+        const char *arg = shift(argv, argc);
+        if (strcmp(arg, "-h") == 0 || strcmp(arg, "--help") == 0) {
+            usage(stdout, program_name);
+            return 0;
+        } else if (strcmp(arg, "--seed") == 0 || strcmp(arg, "--ticks") == 0) {
+            if (argc == 0) {
+                usage(stderr, program_name);
+                nob_log(ERROR, "%s flag requires an argument", arg);
+                return 1;
+            }
+            const char *value = shift(argv, argc);
+            char *end;
+            uint64_t n = strtoull(value, &end, 10);
+            if (*value == '\0' || *end != '\0') {
+                usage(stderr, program_name);
+                nob_log(ERROR, "%s flag expects a number, got %s", arg, value);
+                return 1;
+            }
+            if (strcmp(arg, "--seed") == 0) seed = n; else max_ticks = n;
+        } else if (strcmp(arg, "--fast") == 0) {
+            fast = true;
+        } else if (strcmp(arg, "--bot") == 0) {
+            if (argc == 0) {
+                usage(stderr, program_name);
+                nob_log(ERROR, "--bot flag requires an argument");
+                return 1;
+            }
+            const char *name = shift(argv, argc);
+            if (!bot_planner_by_name(name, &server_bot.planner)) {
+                usage(stderr, program_name);
+                nob_log(ERROR, "unknown planner %s", name);
+                return 1;
+            }
+            server.bot = true;
+        } else {
+            usage(stderr, program_name);
+            nob_log(ERROR, "unknown flag %s", arg);
+            return 1;
+        }
+    }
+
+    signal(SIGINT, server_interrupt);
+    signal(SIGTERM, server_interrupt);
+    profile_set_thread_name("simulation");
+    perf_track_open(&tick_perf);
+
+    game_init(&server.game, seed);
+    server.input_open = true;
+    double next_tick = clock_now() + (fast ? 0 : TICK_INTERVAL);
+    uint64_t begin = clock_now_ns();
+    while (!server.quit && !server_interrupted && !server.game.game_over) {
+        if (max_ticks > 0 && server.ticks >= max_ticks) break;
+        double now = clock_now();
+        if (now < next_tick) {
+            server_poll_input(&server, next_tick - now);
+            continue;
+        }
+        // Whatever already arrived still applies to this tick
+        server_poll_input(&server, 0);
+        server_tick(&server);
+        profile_collect();
+        next_tick = fast ? now : next_tick + TICK_INTERVAL;
+        // Do not try to catch up on ticks missed during a stall, like the game
+        if (next_tick < now) next_tick = now + TICK_INTERVAL;
+        // Clients should see every tick as soon as it happens, unless nobody is waiting for them
+        if (!fast) fflush(stdout);
+    }
+    double elapsed = (clock_now_ns() - begin)*1e-9;
+    fflush(stdout);
+    perf_track_close(&tick_perf);
+
+    // stdout belongs to the clients, so everything else goes to stderr
+    fprintf(stderr, "Final Score: %d\n", server.game.score);
+    fprintf(stderr, "Ticks: %"PRIu64" in %.3fs, %.0f ticks/s\n", server.ticks, elapsed, elapsed > 0 ? server.ticks/elapsed : 0.0);
+    fprintf(stderr, "Tick time: %.2fus on average, %.2fus at most\n",
+            server.ticks > 0 ? server.tick_total_ns*1e-3/server.ticks : 0.0, server.tick_max_ns*1e-3);
+    if (server.bot) {
+        fprintf(stderr, "Bot planning (%s): %.2fus on average, %.2fus at most\n", bot_planner_as_cstr(server_bot.planner),
+                server.ticks > 0 ? server.plan_total_ns*1e-3/server.ticks : 0.0, server.plan_max_ns*1e-3);
+    }
+    profile_collect();
+    profile_report(stderr);
+    alloc_report(stderr, &tick_allocs);
+    perf_report(stderr, &tick_perf);
+    return 0;
+}
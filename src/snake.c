@@ -0,0 +1,178 @@
+#define NOB_STRIP_PREFIX
+#include "nob.h"
+
+#include "raylib.h"
+#include "raymath.h"
+
+#include "grid.h"
+#include "profile.h"
+#include "snake.h"
+
+bool vector3_near_eq(Vector3 a, Vector3 b) {
+    return Vector3LengthSqr(Vector3Subtract(a, b)) < 0.01;
+}
+
+bool cell_in_grid(Vector3 cell) {
+    return cell.x >= 0 && cell.x < GRID_SIZE
+        && cell.y >= 0 && cell.y < GRID_SIZE
+        && cell.z >= 0 && cell.z < GRID_SIZE;
+}
+
+void snake_push_head(Snake *snake, Vector3 point) {
+    assert(snake->size < ARRAY_LEN(snake->points) && "Snake Overflow");
+    SNAKE_AT(snake, snake->size) = point;
+    snake->size++;
+}
+
+void snake_push_tail(Snake *snake, Vector3 point) {
+    assert(snake->size < ARRAY_LEN(snake->points) && "Snake Overflow");
+    SNAKE_AT(snake, -1) = point;
+    snake->size++;
+    snake->begin--;
+}
+
+Vector3 snake_pop(Snake *snake) {
+    assert(snake->size > 0 && "Snake Underflow");
+    Vector3 point = SNAKE_AT(snake, 0);
+    snake->size--;
+    snake->begin++;
+    if (snake->begin == ARRAY_LEN(snake->points)) snake->begin = 0;
+    return point;
+}
+
+Vector3 snake_head(const Snake *snake) {
+    return SNAKE_AT(snake, snake->size - 1);
+}
+
+void snake_grow(Snake *snake) {
+    Vector3 head = snake_head(snake);
+    snake_push_tail(snake, Vector3Subtract(head, snake->dir));
+}
+
+bool snake_contains(const Snake *snake, Vector3 point) {
+    for (size_t i = 0; i < snake->size; i++) {
+        if (vector3_near_eq(point, SNAKE_AT(snake, i))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool snake_update(Snake *snake) {
+    snake_pop(snake);
+    Vector3 point = Vector3Add(SNAKE_AT(snake, snake->size - 1), snake->dir);
+    point.x = ((int)point.x + GRID_SIZE) % GRID_SIZE;
+    point.y = ((int)point.y + GRID_SIZE) % GRID_SIZE;
+    point.z = ((int)point.z + GRID_SIZE) % GRID_SIZE;
+    if (snake_contains(snake, point)) {
+        return false;
+    }
+    snake_push_head(snake, point);
+    return true;
+}
+
+uint64_t rng_next(uint64_t *state) {
+    uint64_t z = (*state += 0x9E3779B97F4A7C15);
+    z = (z ^ (z >> 30))*0xBF58476D1CE4E5B9;
+    z = (z ^ (z >> 27))*0x94D049BB133111EB;
+    return z ^ (z >> 31);
+}
+
+// One draw picks the whole cell instead of one per coordinate
+Vector3 gen_fruit(uint64_t *rng) {
+    return grid_point(rng_next(rng) % GRID_CELLS);
+}
+
+Vector3 dir_queue_pop(Dir_Queue *dirq) {
+    Vector3 dir = dirq->items[0];
+    memmove(dirq->items, dirq->items + 1, (dirq->count - 1)*sizeof(*dirq->items));
+    dirq->count--;
+    return dir;
+}
+
+Vector3 last_dir(Dir_Queue dir_queue, const Snake *snake) {
+    return dir_queue.count == 0 ? snake->dir : dir_queue.items[dir_queue.count - 1];
+}
+
+bool shadow_index(Vector3 point, size_t *index) {
+    // snake_grow() may put the new tail just outside the grid, where it is never drawn
+    if (!cell_in_grid(point)) return false;
+    *index = (int)point.z*GRID_SIZE + (int)point.x;
+    return true;
+}
+
+void shadow_add_segment(Shadow *shadow, Vector3 point, int delta) {
+    size_t i;
+    if (shadow_index(point, &i)) shadow->snake_count[i] += delta;
+}
+
+void shadow_update_column(Shadow *shadow, Vector3 point, Vector3 fruit) {
+    size_t i, fruit_i;
+    if (!shadow_index(point, &i)) return;
+    if (shadow_index(fruit, &fruit_i) && fruit_i == i) {
+        shadow->footprint[i] = FOOTPRINT_FRUIT;
+    } else {
+        shadow->footprint[i] = shadow->snake_count[i] > 0 ? FOOTPRINT_SNAKE : FOOTPRINT_NONE;
+    }
+}
+
+void game_init(Game *game, uint64_t seed) {
+    memset(game, 0, sizeof(*game));
+    game->rng = seed;
+    game->snake = (Snake) { .dir = {-1, 0, 0} };
+    for (int i = 0; i < 4; i++) {
+        snake_push_head(&game->snake, (Vector3) { GRID_SIZE / 2 + 4 - i, GRID_SIZE / 2, GRID_SIZE / 2 });
+    }
+    game->fruit = gen_fruit(&game->rng);
+
+    for (size_t i = 0; i < game->snake.size; i++) {
+        shadow_add_segment(&game->shadow, SNAKE_AT(&game->snake, i), 1);
+        shadow_update_column(&game->shadow, SNAKE_AT(&game->snake, i), game->fruit);
+    }
+    shadow_update_column(&game->shadow, game->fruit, game->fruit);
+}
+
+bool game_steer(Game *game, Vector3 new_dir) {
+    Vector3 last = last_dir(game->dir_queue, &game->snake);
+    if (vector3_near_eq(new_dir, last) || vector3_near_eq(new_dir, Vector3Scale(last, -1))) return false;
+    da_append(&game->dir_queue, new_dir);
+    return true;
+}
+
+void game_tick(Game *game) {
+    game->tick++;
+    game->grew = false;
+
+    if (game->dir_queue.count > 0) {
+        Vector3 new_dir = dir_queue_pop(&game->dir_queue);
+        game->snake.dir = new_dir;
+    }
+
+    Vector3 tail = SNAKE_AT(&game->snake, 0);
+    if (!snake_update(&game->snake)) {
+        game->game_over = true;
+        return;
+    }
+    Vector3 head = snake_head(&game->snake);
+    game->vacated = tail;
+    shadow_add_segment(&game->shadow, tail, -1);
+    shadow_add_segment(&game->shadow, head, 1);
+    shadow_update_column(&game->shadow, tail, game->fruit);
+    shadow_update_column(&game->shadow, head, game->fruit);
+
+    if (vector3_near_eq(head, game->fruit)) {
+        game->score++;
+        snake_grow(&game->snake);
+        game->grew = true;
+        Vector3 new_tail = SNAKE_AT(&game->snake, 0);
+        shadow_add_segment(&game->shadow, new_tail, 1);
+        Profile("fruit spawn") {
+            do {
+                game->fruit = gen_fruit(&game->rng);
+            } while (snake_contains(&game->snake, game->fruit));
+        }
+        shadow_update_column(&game->shadow, new_tail, game->fruit);
+        shadow_update_column(&game->shadow, head, game->fruit);
+        shadow_update_column(&game->shadow, game->fruit, game->fruit);
+    }
+}
@@ -0,0 +1,95 @@
+#ifndef SNAKE_H_
+#define SNAKE_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "raylib.h"
+
+#include "common.h"
+
+// Functions the game calls into the simulation core through. In the host of a hot reload build
+// they are pointers into libsnake.so instead, loaded by src/hotreload.c
+#ifdef HOTRELOAD
+#define SNAKE_FUNC(ret, name, ...) extern ret (*name)(__VA_ARGS__)
+#else
+#define SNAKE_FUNC(ret, name, ...) ret name(__VA_ARGS__)
+#endif // HOTRELOAD
+
+SNAKE_FUNC(bool, vector3_near_eq, Vector3 a, Vector3 b);
+SNAKE_FUNC(bool, cell_in_grid, Vector3 cell);
+
+typedef struct {
+    Vector3 points[GRID_SIZE*GRID_SIZE*GRID_SIZE];
+    size_t begin;
+    size_t size;
+
+    Vector3 dir;
+} Snake;
+#define SNAKE_AT_NO_PARENS(snake, i) snake->points[((snake->begin + i) + NOB_ARRAY_LEN(snake->points)) % NOB_ARRAY_LEN(snake->points)]
+#define SNAKE_AT(snake, i) SNAKE_AT_NO_PARENS((snake), (i))
+
+void snake_push_head(Snake *snake, Vector3 point);
+void snake_push_tail(Snake *snake, Vector3 point);
+Vector3 snake_pop(Snake *snake);
+Vector3 snake_head(const Snake *snake);
+void snake_grow(Snake *snake);
+bool snake_contains(const Snake *snake, Vector3 point);
+bool snake_update(Snake *snake);
+
+// splitmix64. The simulation has a generator of its own instead of raylib's, so it does not need
+// raylib linked in and every game can carry its own state.
+uint64_t rng_next(uint64_t *state);
+Vector3 gen_fruit(uint64_t *rng);
+
+typedef struct {
+    Vector3 *items;
+    size_t count, capacity;
+} Dir_Queue;
+
+Vector3 dir_queue_pop(Dir_Queue *dirq);
+Vector3 last_dir(Dir_Queue dir_queue, const Snake *snake);
+
+typedef enum {
+    FOOTPRINT_NONE,
+    FOOTPRINT_SNAKE,
+    FOOTPRINT_FRUIT,
+} Footprint;
+
+// Footprint of the snake and the fruit projected onto the floor and the ceiling.
+// Kept up to date incrementally on every tick so the renderer only has to upload
+// the texels that actually changed.
+typedef struct {
+    int snake_count[GRID_SIZE*GRID_SIZE]; // Amount of snake segments in each (x, z) column
+    unsigned char footprint[GRID_SIZE*GRID_SIZE]; // Footprint of each (x, z) column
+} Shadow;
+
+bool shadow_index(Vector3 point, size_t *index);
+void shadow_add_segment(Shadow *shadow, Vector3 point, int delta);
+void shadow_update_column(Shadow *shadow, Vector3 point, Vector3 fruit);
+
+// State of the simulation. Owned by the simulation thread once it is started;
+// the renderer only ever looks at the snapshots published from it.
+typedef struct {
+    Snake snake;
+    Vector3 fruit;
+    Dir_Queue dir_queue;
+    Shadow shadow;
+    int score;
+    uint64_t tick;
+    double next_tick;
+    uint64_t tick_duration_ns; // How long the last tick took to simulate
+    Vector3 vacated; // Cell the tail left on the last tick
+    bool grew;       // Whether the last tick made the snake longer
+    bool game_over;
+    uint64_t rng;    // Where the fruit comes from
+} Game;
+
+// The same seed gives the same fruit for the same moves
+SNAKE_FUNC(void, game_init, Game *game, uint64_t seed);
+// Queues a turn, unless it would not change anything or make the snake reverse into itself
+SNAKE_FUNC(bool, game_steer, Game *game, Vector3 new_dir);
+SNAKE_FUNC(void, game_tick, Game *game);
+
+#endif // SNAKE_H_